@@ -193,6 +193,22 @@ bf_add_config(
     SKIP_VALIDATION
 )
 
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_DEBUG_LOCK_STATS
+    CONFIG_TYPE BOOL
+    DEFAULT_VAL OFF
+    DESCRIPTION "Turns on/off recording contention statistics for the microkernel's locks"
+    SKIP_VALIDATION
+)
+
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_TRACE_RING_SIZE
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "0x2000"
+    DESCRIPTION "Defines the number of VM exit records each PP's trace ring can hold (must be a power of 2)"
+    SKIP_VALIDATION
+)
+
 bf_add_config(
     CONFIG_NAME HYPERVISOR_VMEXIT_LOG_SIZE
     CONFIG_TYPE STRING
@@ -201,6 +217,14 @@ bf_add_config(
     SKIP_VALIDATION
 )
 
+bf_add_config(
+    CONFIG_NAME HYPERVISOR_TLB_FLUSH_THRESHOLD
+    CONFIG_TYPE STRING
+    DEFAULT_VAL "32"
+    DESCRIPTION "Defines the largest range (in pages) bf_vs_op_tlb_flush_range invalidates one page at a time"
+    SKIP_VALIDATION
+)
+
 bf_add_config(
     CONFIG_NAME HYPERVISOR_MAX_ELF_FILE_SIZE
     CONFIG_TYPE STRING
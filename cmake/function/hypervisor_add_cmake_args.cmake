@@ -69,7 +69,9 @@ macro(hypervisor_add_cmake_args)
         -DHYPERVISOR_PAGE_SIZE=${HYPERVISOR_PAGE_SIZE}
         -DHYPERVISOR_PAGE_SHIFT=${HYPERVISOR_PAGE_SHIFT}
         -DHYPERVISOR_DEBUG_RING_SIZE=${HYPERVISOR_DEBUG_RING_SIZE}
+        -DHYPERVISOR_TRACE_RING_SIZE=${HYPERVISOR_TRACE_RING_SIZE}
         -DHYPERVISOR_VMEXIT_LOG_SIZE=${HYPERVISOR_VMEXIT_LOG_SIZE}
+        -DHYPERVISOR_TLB_FLUSH_THRESHOLD=${HYPERVISOR_TLB_FLUSH_THRESHOLD}
         -DHYPERVISOR_MAX_ELF_FILE_SIZE=${HYPERVISOR_MAX_ELF_FILE_SIZE}
         -DHYPERVISOR_MAX_SEGMENTS=${HYPERVISOR_MAX_SEGMENTS}
         -DHYPERVISOR_MAX_EXTENSIONS=${HYPERVISOR_MAX_EXTENSIONS}
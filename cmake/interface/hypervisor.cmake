@@ -32,11 +32,19 @@ else()
     )
 endif()
 
+if(HYPERVISOR_DEBUG_LOCK_STATS)
+    target_compile_definitions(hypervisor INTERFACE
+        HYPERVISOR_DEBUG_LOCK_STATS=true
+    )
+endif()
+
 target_compile_definitions(hypervisor INTERFACE
     HYPERVISOR_PAGE_SIZE=${HYPERVISOR_PAGE_SIZE}_umx
     HYPERVISOR_PAGE_SHIFT=${HYPERVISOR_PAGE_SHIFT}_umx
     HYPERVISOR_DEBUG_RING_SIZE=${HYPERVISOR_DEBUG_RING_SIZE}
+    HYPERVISOR_TRACE_RING_SIZE=${HYPERVISOR_TRACE_RING_SIZE}
     HYPERVISOR_VMEXIT_LOG_SIZE=${HYPERVISOR_VMEXIT_LOG_SIZE}_umx
+    HYPERVISOR_TLB_FLUSH_THRESHOLD=${HYPERVISOR_TLB_FLUSH_THRESHOLD}_umx
     HYPERVISOR_MAX_ELF_FILE_SIZE=${HYPERVISOR_MAX_ELF_FILE_SIZE}_umx
     HYPERVISOR_MAX_SEGMENTS=${HYPERVISOR_MAX_SEGMENTS}_umx
     HYPERVISOR_MAX_EXTENSIONS=${HYPERVISOR_MAX_EXTENSIONS}_umx
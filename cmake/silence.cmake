@@ -58,7 +58,9 @@ else()
 endif()
 
 hypervisor_silence(HYPERVISOR_DEBUG_RING_SIZE)
+hypervisor_silence(HYPERVISOR_TRACE_RING_SIZE)
 hypervisor_silence(HYPERVISOR_VMEXIT_LOG_SIZE)
+hypervisor_silence(HYPERVISOR_TLB_FLUSH_THRESHOLD)
 hypervisor_silence(HYPERVISOR_MAX_ELF_FILE_SIZE)
 hypervisor_silence(HYPERVISOR_MAX_SEGMENTS)
 hypervisor_silence(HYPERVISOR_MAX_EXTENSIONS)
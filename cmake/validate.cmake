@@ -37,10 +37,23 @@ if(HYPERVISOR_DEBUG_RING_SIZE LESS 0x1000)
     message(FATAL_ERROR "HYPERVISOR_DEBUG_RING_SIZE must be at least a page")
 endif()
 
+if(HYPERVISOR_TRACE_RING_SIZE LESS 1)
+    message(FATAL_ERROR "HYPERVISOR_TRACE_RING_SIZE must be at least 1")
+endif()
+
+math(EXPR HYPERVISOR_TRACE_RING_SIZE_MASK "${HYPERVISOR_TRACE_RING_SIZE} & (${HYPERVISOR_TRACE_RING_SIZE} - 1)")
+if(NOT HYPERVISOR_TRACE_RING_SIZE_MASK EQUAL 0)
+    message(FATAL_ERROR "HYPERVISOR_TRACE_RING_SIZE must be a power of 2")
+endif()
+
 if(HYPERVISOR_VMEXIT_LOG_SIZE LESS 1)
     message(FATAL_ERROR "HYPERVISOR_VMEXIT_LOG_SIZE must be at least 1")
 endif()
 
+if(HYPERVISOR_TLB_FLUSH_THRESHOLD LESS 1)
+    message(FATAL_ERROR "HYPERVISOR_TLB_FLUSH_THRESHOLD must be at least 1")
+endif()
+
 if(HYPERVISOR_MAX_SEGMENTS LESS 2)
     message(FATAL_ERROR "HYPERVISOR_MAX_SEGMENTS must be at least 2")
 endif()
@@ -153,10 +153,6 @@ namespace example
             bsl::discard(tls);
             bsl::discard(intrinsic);
 
-            constexpr auto guest_asid_val{0x1_u64};
-            constexpr auto guest_asid_idx{syscall::bf_reg_t::bf_reg_t_guest_asid};
-            bsl::expects(mut_sys.bf_vs_op_write(this->id(), guest_asid_idx, guest_asid_val));
-
             constexpr auto intercept1_val{0x00040000_u64};
             constexpr auto intercept1_idx{syscall::bf_reg_t::bf_reg_t_intercept_instruction1};
             bsl::expects(mut_sys.bf_vs_op_write(this->id(), intercept1_idx, intercept1_val));
@@ -25,6 +25,7 @@
 #ifndef DISPATCH_VMEXIT_CPUID_HPP
 #define DISPATCH_VMEXIT_CPUID_HPP
 
+#include <bf_control_ops.hpp>
 #include <bf_debug_ops.hpp>
 #include <bf_syscall_t.hpp>
 #include <cpuid_commands.hpp>
@@ -77,7 +78,9 @@ namespace example
                     /// - If this is the first PP to stop (which is the
                     ///   last PP in the list as we stop in reverse order),
                     ///   print out how much memory was used by the
-                    ///   hypervisor. This is optional of course.
+                    ///   hypervisor, as well as how contended the
+                    ///   microkernel's locks were (if the microkernel
+                    ///   records lock stats). This is optional of course.
                     ///
 
                     auto const last_online_ppid{(mut_sys.bf_tls_online_pps() - 1_u16).checked()};
@@ -85,11 +88,24 @@ namespace example
                         bsl::print() << bsl::endl;
                         syscall::bf_debug_op_dump_page_pool();
                         bsl::print() << bsl::endl;
+                        syscall::bf_debug_op_dump_locks();
+                        bsl::print() << bsl::endl;
                     }
                     else {
                         bsl::touch();
                     }
 
+                    /// NOTE:
+                    /// - Print out how many VMExits this PP has seen, and
+                    ///   how long they took, per exit reason. These stats
+                    ///   are always recorded by the microkernel, so this
+                    ///   works in release builds too. This is optional of
+                    ///   course.
+                    ///
+
+                    bsl::print() << bsl::endl;
+                    syscall::bf_debug_op_dump_vmexit_stats(mut_sys.bf_tls_ppid());
+
                     /// NOTE:
                     /// - The following is another optional debug feature that
                     ///   will show a log of the most recent VMExits that have
@@ -184,7 +200,19 @@ namespace example
         mut_sys.bf_tls_set_rbx(mut_rbx);
         mut_sys.bf_tls_set_rcx(mut_rcx);
         mut_sys.bf_tls_set_rdx(mut_rdx);
-        return mut_sys.bf_vs_op_advance_ip_and_run_current();
+
+        /// NOTE:
+        /// - This is the most common VMExit, so instead of asking the
+        ///   microkernel to advance the IP and run the current VS using
+        ///   bf_vs_op_advance_ip_and_run_current, we hand the VMExit
+        ///   straight back to the microkernel's VMExit loop, which skips
+        ///   the syscall dispatcher entirely. If all goes well, this will
+        ///   not return.
+        ///
+
+        syscall::bf_control_op_vmexit_return(
+            syscall::BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT);
+        return bsl::errc_success;
     }
 }
 
@@ -154,10 +154,6 @@ namespace example
             bsl::discard(tls);
             bsl::discard(intrinsic);
 
-            constexpr auto vmcs_vpid_val{0x1_u64};
-            constexpr auto vmcs_vpid_idx{syscall::bf_reg_t::bf_reg_t_virtual_processor_identifier};
-            bsl::expects(mut_sys.bf_vs_op_write(this->id(), vmcs_vpid_idx, vmcs_vpid_val));
-
             constexpr auto vmcs_link_ptr_val{0xFFFFFFFFFFFFFFFF_u64};
             constexpr auto vmcs_link_ptr_idx{syscall::bf_reg_t::bf_reg_t_vmcs_link_pointer};
             bsl::expects(mut_sys.bf_vs_op_write(this->id(), vmcs_link_ptr_idx, vmcs_link_ptr_val));
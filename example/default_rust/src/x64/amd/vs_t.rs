@@ -143,10 +143,6 @@ impl VsT {
         bsl::discard(tls);
         bsl::discard(intrinsic);
 
-        let guest_asid_val = bsl::SafeU64::new(0x1);
-        let guest_asid_idx = syscall::BF_REG_T_GUEST_ASID;
-        bsl::expects(sys.bf_vs_op_write(self.id(), guest_asid_idx, guest_asid_val));
-
         let intercept1_val = bsl::SafeU64::new(0x00040000);
         let intercept1_idx = syscall::BF_REG_T_INTERCEPT_INSTRUCTION1;
         bsl::expects(sys.bf_vs_op_write(self.id(), intercept1_idx, intercept1_val));
@@ -68,7 +68,9 @@ pub fn dispatch_vmexit_cpuid(
                 // - If this is the first PP to stop (which is the
                 //   last PP in the list as we stop in reverse order),
                 //   print out how much memory was used by the
-                //   hypervisor. This is optional of course.
+                //   hypervisor, as well as how contended the
+                //   microkernel's locks were (if the microkernel
+                //   records lock stats). This is optional of course.
                 //
 
                 let last_online_ppid =
@@ -77,10 +79,23 @@ pub fn dispatch_vmexit_cpuid(
                     print!("\n");
                     syscall::bf_debug_op_dump_page_pool();
                     print!("\n");
+                    syscall::bf_debug_op_dump_locks();
+                    print!("\n");
                 } else {
                     bsl::touch();
                 }
 
+                // NOTE:
+                // - Print out how many VMExits this PP has seen, and
+                //   how long they took, per exit reason. These stats
+                //   are always recorded by the microkernel, so this
+                //   works in release builds too. This is optional of
+                //   course.
+                //
+
+                print!("\n");
+                syscall::bf_debug_op_dump_vmexit_stats(syscall::BfSyscallT::bf_tls_ppid());
+
                 // NOTE:
                 // - The following is another optional debug feature that
                 //   will show a log of the most recent VMExits that have
@@ -175,5 +190,16 @@ pub fn dispatch_vmexit_cpuid(
     syscall::BfSyscallT::bf_tls_set_rbx(rbx);
     syscall::BfSyscallT::bf_tls_set_rcx(rcx);
     syscall::BfSyscallT::bf_tls_set_rdx(rdx);
-    return sys.bf_vs_op_advance_ip_and_run_current();
+
+    // NOTE:
+    // - This is the most common VMExit, so instead of asking the
+    //   microkernel to advance the IP and run the current VS using
+    //   bf_vs_op_advance_ip_and_run_current, we hand the VMExit
+    //   straight back to the microkernel's VMExit loop, which skips
+    //   the syscall dispatcher entirely. If all goes well, this will
+    //   not return.
+    //
+
+    syscall::bf_control_op_vmexit_return(syscall::BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT);
+    return bsl::errc_success;
 }
@@ -143,10 +143,6 @@ impl VsT {
         bsl::discard(tls);
         bsl::discard(intrinsic);
 
-        let vmcs_vpid_val = bsl::SafeU64::new(0x1);
-        let vmcs_vpid_idx = syscall::BF_REG_T_VIRTUAL_PROCESSOR_IDENTIFIER;
-        bsl::expects(sys.bf_vs_op_write(self.id(), vmcs_vpid_idx, vmcs_vpid_val));
-
         let vmcs_link_ptr_val = bsl::SafeU64::new(0xFFFFFFFFFFFFFFFF);
         let vmcs_link_ptr_idx = syscall::BF_REG_T_VMCS_LINK_POINTER;
         bsl::expects(sys.bf_vs_op_write(self.id(), vmcs_link_ptr_idx, vmcs_link_ptr_val));
@@ -26,6 +26,7 @@
 #define TLS_T_HPP
 
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -38,9 +39,7 @@
 namespace mk
 {
     /// @brief defines the size of the reserved1 field in the tls_t
-    constexpr auto TLS_T_RESERVED1_SIZE{0x020_umx};
-    /// @brief defines the size of the reserved2 field in the tls_t
-    constexpr auto TLS_T_RESERVED2_SIZE{0x008_umx};
+    constexpr auto TLS_T_RESERVED1_SIZE{0x010_umx};
     /// @brief defines the size of the reserved3 field in the tls_t
     constexpr auto TLS_T_RESERVED3_SIZE{0x007_umx};
     /// @brief defines the size of the reserved4 field in the tls_t
@@ -276,6 +275,11 @@ namespace mk
         /// @brief stores the vmexit loop stack (0x2D8)
         bsl::uintmx vmexit_loop_sp;
 
+        /// @brief stores how many TLB range flushes went page by page (0x2E0)
+        bsl::uintmx tlb_flush_range_pages;
+        /// @brief stores how many TLB range flushes flushed the VS (0x2E8)
+        bsl::uintmx tlb_flush_range_full;
+
         /// @brief reserve the rest of the TLS block for later use.
         bsl::array<bsl::uint8, TLS_T_RESERVED1_SIZE.get()> reserved1;
 
@@ -324,19 +328,21 @@ namespace mk
         /// @brief used to store a return address for unsafe ops (0x350)
         bsl::uintmx unsafe_rip;
 
-        /// @brief reserved (0x358)
-        bsl::uintmx reserved_padding2;
-        /// @brief reserved (0x360)
-        bsl::uintmx reserved_padding3;
+        /// @brief stores this PP's trace ring, or nullptr if disabled (0x358)
+        loader::trace_ring_t *trace_ring;
+        /// @brief stores how many bf_vs_op_run calls were fast (0x360)
+        bsl::uintmx run_fast_path_hits;
 
         /// @brief stores whether or not the first launch succeeded (0x368)
         bsl::uintmx first_launch_succeeded;
 
         /// @brief stores the currently active root page table (0x370)
         void *active_rpt;
+        /// @brief stores how many bf_vs_op_run calls were slow (0x378)
+        bsl::uintmx run_fast_path_misses;
 
-        /// @brief reserve the rest of the TLS block for later use.
-        bsl::array<bsl::uint8, TLS_T_RESERVED2_SIZE.get()> reserved2;
+        /// @brief stores the trace record of the VMExit being handled (0x380)
+        loader::trace_record_t trace_rec;
     };
 
     /// @brief make sure the tls_t is the size of a page
@@ -32,6 +32,15 @@ namespace mk
     /// @brief Returned when a VMExit is a success
     // NOLINTNEXTLINE(bsl-name-case)
     constexpr bsl::errc_type vmexit_success{1001};
+    /// @brief Returned when a VMExit is a success, and the IP of the
+    ///   active VS must be advanced before it is resumed. Note that this
+    ///   must always be vmexit_success + 1 (see dispatch_syscall_entry.S)
+    // NOLINTNEXTLINE(bsl-name-case)
+    constexpr bsl::errc_type vmexit_success_advance_ip{1002};
+    /// @brief Returned when another PP did not invalidate its TLB in time
+    ///   during a TLB shootdown. The operation can be retried.
+    // NOLINTNEXTLINE(bsl-name-case)
+    constexpr bsl::errc_type tlb_shootdown_timeout{-1001};
 }
 
 #endif
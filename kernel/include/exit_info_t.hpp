@@ -0,0 +1,134 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef EXIT_INFO_T_HPP
+#define EXIT_INFO_T_HPP
+
+#include <bf_constants.hpp>
+#include <bf_reg_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Stores the list of registers that a VS publishes into the
+    ///     extension's TLS block (starting at TLS_OFFSET_EXIT_INFO) on
+    ///     every VMExit. The registers are published in the order they
+    ///     were added.
+    ///
+    class exit_info_t final
+    {
+        /// @brief stores the registers to publish
+        bsl::array<syscall::bf_reg_t, syscall::BF_MAX_EXIT_INFO.get()> m_regs{};
+        /// @brief stores the number of registers in m_regs
+        bsl::safe_umx m_size{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Adds a register to the end of the list.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reg the register to add
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     if the list is full.
+        ///
+        [[nodiscard]] constexpr auto
+        add(syscall::bf_reg_t const reg) noexcept -> bsl::errc_type
+        {
+            bsl::expects(syscall::bf_reg_t::bf_reg_t_unsupported != reg);
+            bsl::expects(syscall::bf_reg_t::bf_reg_t_invalid != reg);
+
+            if (bsl::unlikely(bsl::to_u64(m_size) >= syscall::BF_MAX_EXIT_INFO)) {
+                bsl::error() << "unable to add exit info register as the list is full"    // --
+                             << bsl::endl                                                 // --
+                             << bsl::here();                                              // --
+
+                return bsl::errc_failure;
+            }
+
+            *m_regs.at_if(bsl::to_idx(m_size)) = reg;
+            ++m_size;
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the idx'th register in the list
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the register to return
+        ///   @return Returns the idx'th register in the list
+        ///
+        [[nodiscard]] constexpr auto
+        reg(bsl::safe_idx const &idx) const noexcept -> syscall::bf_reg_t
+        {
+            bsl::expects(idx < m_size);
+            return *m_regs.at_if(idx);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if no registers have been added
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if no registers have been added
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            return m_size.is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of registers that have been added
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of registers that have been added
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> bsl::safe_umx const &
+        {
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes all of the registers from the list
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            m_regs = {};
+            m_size = {};
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,184 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef FAST_PATH_T_HPP
+#define FAST_PATH_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief defines the max number of fast path rules an extension can
+    ///   register on each PP
+    constexpr auto MAX_FAST_PATH_RULES{16_umx};
+
+    /// <!-- description -->
+    ///   @brief Stores a single fast path rule. How key, val0 and val1
+    ///     are interpreted depends on the kind of rule (BF_FAST_PATH_xxx).
+    ///
+    struct fast_path_rule_t final
+    {
+        /// @brief stores the kind of rule (BF_FAST_PATH_xxx)
+        bsl::safe_u64 kind;
+        /// @brief stores the CPUID leaf/subleaf, MSR or exit reason to match
+        bsl::safe_u64 key;
+        /// @brief stores the first value associated with the rule
+        bsl::safe_u64 val0;
+        /// @brief stores the second value associated with the rule
+        bsl::safe_u64 val1;
+    };
+
+    /// <!-- description -->
+    ///   @brief Stores the fast path rules an extension registered on a
+    ///     single PP. The table is small and only ever touched by the PP
+    ///     that owns it, so a linear search with no locking is all that
+    ///     is needed.
+    ///
+    class fast_path_t final
+    {
+        /// @brief stores the fast path rules
+        bsl::array<fast_path_rule_t, MAX_FAST_PATH_RULES.get()> m_rules{};
+        /// @brief stores the number of rules in m_rules
+        bsl::safe_umx m_size{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Adds a rule to the table. If a rule with the same kind
+        ///     and key already exists, its values are replaced instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param kind the kind of rule to add (BF_FAST_PATH_xxx)
+        ///   @param key the CPUID leaf/subleaf, MSR or exit reason to match
+        ///   @param val0 the first value associated with the rule
+        ///   @param val1 the second value associated with the rule
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     if the table is full.
+        ///
+        [[nodiscard]] constexpr auto
+        add(bsl::safe_u64 const &kind,
+            bsl::safe_u64 const &key,
+            bsl::safe_u64 const &val0,
+            bsl::safe_u64 const &val1) noexcept -> bsl::errc_type
+        {
+            bsl::expects(kind.is_valid_and_checked());
+            bsl::expects(key.is_valid_and_checked());
+            bsl::expects(val0.is_valid_and_checked());
+            bsl::expects(val1.is_valid_and_checked());
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_size; ++mut_i) {
+                auto *const pmut_rule{m_rules.at_if(mut_i)};
+                if (pmut_rule->kind == kind && pmut_rule->key == key) {
+                    pmut_rule->val0 = val0;
+                    pmut_rule->val1 = val1;
+                    return bsl::errc_success;
+                }
+
+                bsl::touch();
+            }
+
+            if (bsl::unlikely(m_size >= MAX_FAST_PATH_RULES)) {
+                bsl::error() << "unable to add fast path rule as the table is full"    // --
+                             << bsl::endl                                              // --
+                             << bsl::here();                                           // --
+
+                return bsl::errc_failure;
+            }
+
+            *m_rules.at_if(bsl::to_idx(m_size)) = {kind, key, val0, val1};
+            ++m_size;
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns a pointer to the rule with the provided kind
+        ///     and key, or a nullptr if no such rule exists.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param kind the kind of rule to find (BF_FAST_PATH_xxx)
+        ///   @param key the CPUID leaf/subleaf, MSR or exit reason to find
+        ///   @return Returns a pointer to the rule with the provided kind
+        ///     and key, or a nullptr if no such rule exists.
+        ///
+        [[nodiscard]] constexpr auto
+        find(bsl::safe_u64 const &kind, bsl::safe_u64 const &key) const noexcept
+            -> fast_path_rule_t const *
+        {
+            for (bsl::safe_idx mut_i{}; mut_i < m_size; ++mut_i) {
+                auto const *const prule{m_rules.at_if(mut_i)};
+                if (prule->kind == kind && prule->key == key) {
+                    return prule;
+                }
+
+                bsl::touch();
+            }
+
+            return nullptr;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if no rules have been added
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if no rules have been added
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            return m_size.is_zero();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of rules that have been added
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of rules that have been added
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> bsl::safe_umx const &
+        {
+            return m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes all of the rules from the table
+        ///
+        constexpr void
+        clear() noexcept
+        {
+            m_rules = {};
+            m_size = {};
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,61 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef HUGE_POOL_NODE_T_HPP
+#define HUGE_POOL_NODE_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @brief defines the max number of pages the huge pool can manage
+    constexpr auto HUGE_POOL_MAX_PAGES{
+        (HYPERVISOR_MK_HUGE_POOL_SIZE / HYPERVISOR_PAGE_SIZE).checked()};
+    /// @brief defines the value of a huge_pool_node_t link that is unused
+    constexpr auto HUGE_POOL_INVALID_NODE{bsl::safe_umx::max_value()};
+
+    /// <!-- description -->
+    ///   @brief Stores the buddy allocator's bookkeeping for a single page
+    ///     in the huge pool. Only the node of the first page in a block is
+    ///     ever used, and since this metadata is stored outside of the pool
+    ///     itself, the memory handed out by the huge pool remains physically
+    ///     contiguous.
+    ///
+    struct huge_pool_node_t final
+    {
+        /// @brief the index of the next free block with the same order
+        bsl::safe_umx next;
+        /// @brief the index of the previous free block with the same order
+        bsl::safe_umx prev;
+        /// @brief the order of the block that starts with this page
+        bsl::safe_umx order;
+        /// @brief the number of pages that were asked for (if allocated)
+        bsl::safe_umx requested;
+        /// @brief set to true if this page starts a free block
+        bool free;
+    };
+}
+
+#endif
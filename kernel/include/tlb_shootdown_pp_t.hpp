@@ -0,0 +1,52 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef TLB_SHOOTDOWN_PP_T_HPP
+#define TLB_SHOOTDOWN_PP_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @brief stores the alignment of a tlb_shootdown_pp_t (a cache line)
+    constexpr auto TLB_SHOOTDOWN_PP_ALIGNMENT{64_umx};
+
+    /// <!-- description -->
+    ///   @brief Defines the per-PP state of a tlb_shootdown_t. Each PP is
+    ///     given its own cache line as the PP that initiates a shootdown
+    ///     spins on this state while the PP that owns it updates it.
+    ///
+    struct alignas(TLB_SHOOTDOWN_PP_ALIGNMENT.get()) tlb_shootdown_pp_t final
+    {
+        /// @brief stores true while the PP is executing extension code
+        _Atomic bool exposed;
+        /// @brief stores the generation this PP has invalidated up to
+        _Atomic(bsl::uint64) acked;
+    };
+}
+
+#endif
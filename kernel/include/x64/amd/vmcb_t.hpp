@@ -62,6 +62,33 @@ namespace mk
     /// @brief defines the size of the reserved13 field in the VMCB
     constexpr auto VMCB_GIB_SIZE{0xF_umx};
 
+    /// @brief VMCB clean bit: intercepts, TSC offset, pause filter
+    constexpr auto VMCB_CLEAN_BITS_I{0x00000001_u32};
+    /// @brief VMCB clean bit: IOPM_BASE_PA and MSRPM_BASE_PA
+    constexpr auto VMCB_CLEAN_BITS_IOPM{0x00000002_u32};
+    /// @brief VMCB clean bit: ASID
+    constexpr auto VMCB_CLEAN_BITS_ASID{0x00000004_u32};
+    /// @brief VMCB clean bit: V_TPR, V_IRQ, V_INTR_PRIO, V_IGN_TPR
+    constexpr auto VMCB_CLEAN_BITS_TPR{0x00000008_u32};
+    /// @brief VMCB clean bit: nested paging (NP_ENABLE, N_CR3, G_PAT)
+    constexpr auto VMCB_CLEAN_BITS_NP{0x00000010_u32};
+    /// @brief VMCB clean bit: CR0, CR3, CR4 and EFER
+    constexpr auto VMCB_CLEAN_BITS_CRX{0x00000020_u32};
+    /// @brief VMCB clean bit: DR6 and DR7
+    constexpr auto VMCB_CLEAN_BITS_DRX{0x00000040_u32};
+    /// @brief VMCB clean bit: GDT and IDT
+    constexpr auto VMCB_CLEAN_BITS_DT{0x00000080_u32};
+    /// @brief VMCB clean bit: CS, DS, SS, ES and CPL
+    constexpr auto VMCB_CLEAN_BITS_SEG{0x00000100_u32};
+    /// @brief VMCB clean bit: CR2
+    constexpr auto VMCB_CLEAN_BITS_CR2{0x00000200_u32};
+    /// @brief VMCB clean bit: DbgCtlMsr, br_from/to, lastexcpfrom/to
+    constexpr auto VMCB_CLEAN_BITS_LBR{0x00000400_u32};
+    /// @brief VMCB clean bit: AVIC APIC_BAR and table pointers
+    constexpr auto VMCB_CLEAN_BITS_AVIC{0x00000800_u32};
+    /// @brief all of the VMCB clean bits defined above
+    constexpr auto VMCB_CLEAN_BITS_ALL{0x00000FFF_u32};
+
     /// <!-- description -->
     ///   @brief The following defines the structure of the VMCB used by AMD's
     ///     hypervisor extensions.
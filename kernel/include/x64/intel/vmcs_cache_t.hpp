@@ -0,0 +1,273 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMCS_CACHE_T_HPP
+#define VMCS_CACHE_T_HPP
+
+#include <bf_reg_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of VMCS fields that are never changed by hardware
+    constexpr auto VMCS_CACHE_NUM_CONTROLS{9_umx};
+    /// @brief defines the total number of VMCS fields that are cached
+    constexpr auto VMCS_CACHE_SIZE{26_umx};
+
+    /// @brief each cached field needs a bit in vmcs_cache_t::m_valid
+    static_assert(VMCS_CACHE_SIZE <= 64_umx);
+
+    /// <!-- description -->
+    ///   @brief Defines a software cache of the VMCS fields that are
+    ///     accessed the most. The cache is write-through, so the VMCS is
+    ///     always up to date. A VMWRITE is only skipped if it would not
+    ///     change the field, and a VMREAD is only skipped if the field was
+    ///     already read (or written) since the cache was last invalidated.
+    ///     The first VMCS_CACHE_NUM_CONTROLS slots hold control fields,
+    ///     which hardware never changes, so they stay valid across VMExits.
+    ///     The remaining slots hold guest state and exit information, which
+    ///     change on every VMExit, and must be invalidated using
+    ///     invalidate_guest_state() every time the VS is run. Everything
+    ///     must be invalidated using invalidate() any time the VMCS is
+    ///     cleared or loaded.
+    ///
+    class vmcs_cache_t final
+    {
+        /// @brief stores the cached value of each field
+        bsl::array<bsl::safe_u64, VMCS_CACHE_SIZE.get()> m_vals{};
+        /// @brief stores a bit for each field, set if the cached value is valid
+        bsl::safe_u64 m_valid{};
+
+        /// <!-- description -->
+        ///   @brief Returns the slot that caches reg, or
+        ///     bsl::safe_umx::failure() if reg is not cached.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reg the bf_reg_t to query
+        ///   @return Returns the slot that caches reg, or
+        ///     bsl::safe_umx::failure() if reg is not cached.
+        ///
+        [[nodiscard]] static constexpr auto
+        slot(syscall::bf_reg_t const reg) noexcept -> bsl::safe_umx
+        {
+            switch (reg) {
+                case syscall::bf_reg_t::bf_reg_t_address_of_msr_bitmaps: {
+                    return 0_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_tsc_offset: {
+                    return 1_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_ept_pointer: {
+                    return 2_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_exception_bitmap: {
+                    return 3_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_tpr_threshold: {
+                    return 4_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_cr0_guest_host_mask: {
+                    return 5_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_cr4_guest_host_mask: {
+                    return 6_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_cr0_read_shadow: {
+                    return 7_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_cr4_read_shadow: {
+                    return 8_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_vmentry_interrupt_information_field: {
+                    return 9_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_exit_reason: {
+                    return 10_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_vmexit_interruption_information: {
+                    return 11_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_vmexit_interruption_error_code: {
+                    return 12_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_idt_vectoring_information_field: {
+                    return 13_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_idt_vectoring_error_code: {
+                    return 14_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_vmexit_instruction_length: {
+                    return 15_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_vmexit_instruction_information: {
+                    return 16_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_interruptibility_state: {
+                    return 17_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_activity_state: {
+                    return 18_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_exit_qualification: {
+                    return 19_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_physical_address: {
+                    return 20_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_linear_address: {
+                    return 21_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_cr3: {
+                    return 22_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_rsp: {
+                    return 23_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_rip: {
+                    return 24_umx;
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_rflags: {
+                    return 25_umx;
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return bsl::safe_umx::failure();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the bit in m_valid that is associated with a slot
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pos the slot to query
+        ///   @return Returns the bit in m_valid that is associated with a slot
+        ///
+        [[nodiscard]] static constexpr auto
+        mask(bsl::safe_umx const &pos) noexcept -> bsl::safe_u64
+        {
+            return bsl::safe_u64::magic_1() << bsl::to_u64(pos);
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Returns the cached value of reg, or
+        ///     bsl::safe_u64::failure() if reg is not cached, or if the
+        ///     cached value is no longer valid.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reg the bf_reg_t to look up
+        ///   @return Returns the cached value of reg, or
+        ///     bsl::safe_u64::failure() if reg is not cached, or if the
+        ///     cached value is no longer valid.
+        ///
+        [[nodiscard]] constexpr auto
+        get(syscall::bf_reg_t const reg) const noexcept -> bsl::safe_u64
+        {
+            auto const pos{slot(reg)};
+            if (pos.is_invalid()) {
+                return bsl::safe_u64::failure();
+            }
+
+            if ((m_valid & mask(pos)).is_zero()) {
+                return bsl::safe_u64::failure();
+            }
+
+            return *m_vals.at_if(bsl::to_idx(pos));
+        }
+
+        /// <!-- description -->
+        ///   @brief Stores the value of reg that is currently in the VMCS.
+        ///     If reg is not cached, this function does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param reg the bf_reg_t to store
+        ///   @param val the value of reg that is currently in the VMCS
+        ///
+        constexpr void
+        set(syscall::bf_reg_t const reg, bsl::safe_u64 const &val) noexcept
+        {
+            auto const pos{slot(reg)};
+            if (pos.is_invalid()) {
+                return;
+            }
+
+            *m_vals.at_if(bsl::to_idx(pos)) = val;
+            m_valid |= mask(pos);
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates the cached guest state and exit information.
+        ///     Cached control fields remain valid.
+        ///
+        constexpr void
+        invalidate_guest_state() noexcept
+        {
+            constexpr auto controls{(mask(VMCS_CACHE_NUM_CONTROLS) - 1_u64).checked()};
+            m_valid &= controls;
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates everything that is cached
+        ///
+        constexpr void
+        invalidate() noexcept
+        {
+            m_valid = {};
+        }
+    };
+}
+
+#endif
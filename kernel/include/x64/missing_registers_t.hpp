@@ -55,8 +55,9 @@ namespace mk
         bsl::uintmx guest_dr3;
         /// @brief stores the value of dr6 (0x038)
         bsl::uintmx guest_dr6;
-        /// @brief reserved (0x040)
-        bsl::uintmx reserved1;
+        /// @brief stores the TLS block of the PP whose hardware still has
+        ///   this VS's MSRs loaded, or 0 if they must be reloaded (0x040)
+        bsl::uintmx loaded_on;
         /// @brief reserved (0x048)
         bsl::uintmx reserved2;
         /// @brief reserved (0x050)
@@ -26,6 +26,7 @@
 #define VMEXIT_LOG_PP_T
 
 #include <vmexit_log_record_t.hpp>
+#include <vmexit_stats_record_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>    // IWYU pragma: keep
@@ -43,6 +44,10 @@ namespace mk
         bsl::array<vmexit_log_record_t, HYPERVISOR_VMEXIT_LOG_SIZE.get()> log;
         /// @brief stores the VMExit log circular cursor
         bsl::safe_idx crsr;
+        /// @brief stores the VMExit stats, hashed by exit reason
+        bsl::array<vmexit_stats_record_t, VMEXIT_STATS_SIZE.get()> stats;
+        /// @brief stores the number of VMExits that did not fit in stats
+        bsl::safe_u64 stats_dropped;
     };
 }
 
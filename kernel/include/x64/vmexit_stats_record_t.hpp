@@ -0,0 +1,59 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VMEXIT_STATS_RECORD_T
+#define VMEXIT_STATS_RECORD_T
+
+#include <vmexit_stats_size.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of log2 buckets in each latency histogram
+    constexpr auto VMEXIT_STATS_HISTOGRAM_SIZE{24_umx};
+
+    /// @brief the stats table is hashed by masking, so its size must be a power of 2
+    static_assert((VMEXIT_STATS_SIZE & (VMEXIT_STATS_SIZE - bsl::safe_umx::magic_1())).is_zero());
+    /// @brief exit reasons only hash to themselves if the fold leaves their bits alone
+    static_assert(VMEXIT_STATS_SIZE <= 256_umx);
+
+    /// <!-- description -->
+    ///   @brief Stores the statistics of a single exit reason
+    ///
+    struct vmexit_stats_record_t final
+    {
+        /// @brief stores the exit reason these stats belong to
+        bsl::safe_u64 exit_reason;
+        /// @brief stores the number of VMExits seen (0 if unused)
+        bsl::safe_u64 count;
+        /// @brief stores the total number of cycles from VMExit to VMEntry
+        bsl::safe_u64 cycles;
+        /// @brief bucket n counts VMExits that took [2^n, 2^(n+1)) cycles
+        bsl::array<bsl::safe_u64, VMEXIT_STATS_HISTOGRAM_SIZE.get()> histogram;
+    };
+}
+
+#endif
@@ -26,9 +26,11 @@ hypervisor_add_integration_target(bf_callback_op_register_fail)
 hypervisor_add_integration_target(bf_callback_op_register_vmexit)
 hypervisor_add_integration_target(bf_debug_op_dump_ext)
 hypervisor_add_integration_target(bf_debug_op_dump_huge_pool)
+hypervisor_add_integration_target(bf_debug_op_dump_locks)
 hypervisor_add_integration_target(bf_debug_op_dump_page_pool)
 hypervisor_add_integration_target(bf_debug_op_dump_vm)
 hypervisor_add_integration_target(bf_debug_op_dump_vmexit_log)
+hypervisor_add_integration_target(bf_debug_op_dump_vmexit_stats)
 hypervisor_add_integration_target(bf_debug_op_dump_vp)
 hypervisor_add_integration_target(bf_debug_op_dump_vs)
 hypervisor_add_integration_target(bf_debug_op_out)
@@ -57,11 +59,15 @@ hypervisor_add_integration_target(bf_vs_op_init_as_root)
 hypervisor_add_integration_target(bf_vs_op_migrate)
 hypervisor_add_integration_target(bf_vs_op_promote)
 hypervisor_add_integration_target(bf_vs_op_read)
+hypervisor_add_integration_target(bf_vs_op_read_many)
 hypervisor_add_integration_target(bf_vs_op_run_current)
 hypervisor_add_integration_target(bf_vs_op_run)
 hypervisor_add_integration_target(bf_vs_op_set_active)
+hypervisor_add_integration_target(bf_vs_op_set_exit_info)
 hypervisor_add_integration_target(bf_vs_op_tlb_flush)
+hypervisor_add_integration_target(bf_vs_op_tlb_flush_range)
 hypervisor_add_integration_target(bf_vs_op_write)
+hypervisor_add_integration_target(bf_vs_op_write_many)
 hypervisor_add_integration_target(fast_fail_exit_from_bootstrap_with_no_syscall)
 hypervisor_add_integration_target(fast_fail_exit_from_bootstrap_with_segfault)
 hypervisor_add_integration_target(fast_fail_exit_from_bootstrap_with_wait)
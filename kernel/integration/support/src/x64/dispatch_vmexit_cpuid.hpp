@@ -77,7 +77,9 @@ namespace syscall
                     /// - If this is the first PP to stop (which is the
                     ///   last PP in the list as we stop in reverse order),
                     ///   print out how much memory was used by the
-                    ///   hypervisor. This is optional of course.
+                    ///   hypervisor, as well as how contended the
+                    ///   microkernel's locks were (if the microkernel
+                    ///   records lock stats). This is optional of course.
                     ///
 
                     auto const last_online_ppid{(mut_sys.bf_tls_online_pps() - 1_u16).checked()};
@@ -85,11 +87,24 @@ namespace syscall
                         bsl::print() << bsl::endl;
                         bf_debug_op_dump_page_pool();
                         bsl::print() << bsl::endl;
+                        bf_debug_op_dump_locks();
+                        bsl::print() << bsl::endl;
                     }
                     else {
                         bsl::touch();
                     }
 
+                    /// NOTE:
+                    /// - Print out how many VMExits this PP has seen, and
+                    ///   how long they took, per exit reason. These stats
+                    ///   are always recorded by the microkernel, so this
+                    ///   works in release builds too. This is optional of
+                    ///   course.
+                    ///
+
+                    bsl::print() << bsl::endl;
+                    bf_debug_op_dump_vmexit_stats(mut_sys.bf_tls_ppid());
+
                     /// NOTE:
                     /// - The following is another optional debug feature that
                     ///   will show a log of the most recent VMExits that have
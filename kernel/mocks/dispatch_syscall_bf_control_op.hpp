@@ -27,8 +27,10 @@
 
 #include <bf_constants.hpp>
 #include <bf_types.hpp>
+#include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/discard.hpp>
 #include <bsl/errc_type.hpp>
 
 namespace mk
@@ -41,11 +43,15 @@ namespace mk
     ///
     /// <!-- inputs/outputs -->
     ///   @param tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
-    dispatch_syscall_bf_control_op(tls_t const &tls) noexcept -> syscall::bf_status_t
+    dispatch_syscall_bf_control_op(tls_t const &tls, page_pool_t &mut_page_pool) noexcept
+        -> syscall::bf_status_t
     {
+        bsl::discard(mut_page_pool);
+
         if (SYSCALL_BF_CONTROL_OP_FAILS == tls.test_ret) {
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
         }
@@ -28,6 +28,7 @@
 #include <bf_constants.hpp>
 #include <bf_types.hpp>
 #include <huge_pool_t.hpp>
+#include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
@@ -46,15 +47,19 @@ namespace mk
     ///   @param tls the current TLS block
     ///   @param page_pool the page_pool_t to use
     ///   @param huge_pool the huge pool to use
+    ///   @param intrinsic the intrinsic_t to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
     dispatch_syscall_bf_mem_op(
-        tls_t const &tls, page_pool_t const &page_pool, huge_pool_t const &huge_pool) noexcept
-        -> syscall::bf_status_t
+        tls_t const &tls,
+        page_pool_t const &page_pool,
+        huge_pool_t const &huge_pool,
+        intrinsic_t const &intrinsic) noexcept -> syscall::bf_status_t
     {
         bsl::discard(page_pool);
         bsl::discard(huge_pool);
+        bsl::discard(intrinsic);
 
         if (SYSCALL_BF_MEM_OP_FAILS == tls.test_ret) {
             return syscall::BF_STATUS_FAILURE_UNKNOWN;
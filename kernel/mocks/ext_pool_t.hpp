@@ -220,6 +220,13 @@ namespace mk
             bsl::discard(tls);
             bsl::discard(extid);
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the ext_pool_t's locks
+        ///
+        static constexpr void
+        dump_locks() noexcept
+        {}
     };
 }
 
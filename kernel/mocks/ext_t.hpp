@@ -28,6 +28,7 @@
 #include <alloc_huge_t.hpp>
 #include <alloc_page_t.hpp>
 #include <bf_constants.hpp>
+#include <fast_path_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
 #include <mk_args_t.hpp>
@@ -35,6 +36,8 @@
 #include <root_page_table_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/discard.hpp>
 #include <bsl/ensures.hpp>
@@ -113,6 +116,8 @@ namespace mk
         bsl::safe_u64 m_vmexit_ip{};
         /// @brief stores the fail IP registered by the extension
         bsl::safe_u64 m_fail_ip{};
+        /// @brief stores the fast path rules registered on each PP
+        bsl::array<fast_path_t, HYPERVISOR_MAX_PPS.get()> m_fast_paths{};
 
     public:
         /// <!-- description -->
@@ -163,6 +168,10 @@ namespace mk
             bsl::discard(page_pool);
             bsl::discard(huge_pool);
 
+            for (auto &mut_fast_path : m_fast_paths) {
+                mut_fast_path.clear();
+            }
+
             m_fail_ip = {};
             m_vmexit_ip = {};
             m_bootstrap_ip = {};
@@ -279,6 +288,53 @@ namespace mk
             m_fail_ip = ip;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the fast path rules this extension registered
+        ///     on the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the fast path rules this extension registered
+        ///     on the current PP.
+        ///
+        [[nodiscard]] constexpr auto
+        fast_path(tls_t const &tls) const noexcept -> fast_path_t const &
+        {
+            auto const *const pfast_path{m_fast_paths.at_if(bsl::to_idx(tls.ppid))};
+            bsl::expects(nullptr != pfast_path);
+
+            return *pfast_path;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a fast path rule for the current PP. This should
+        ///     be called by the syscall dispatcher as the result of a
+        ///     syscall from the extension defining which VMExits the
+        ///     microkernel can handle on its behalf.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param kind the kind of rule to add (BF_FAST_PATH_xxx)
+        ///   @param key the CPUID leaf/subleaf, MSR or exit reason to match
+        ///   @param val0 the first value associated with the rule
+        ///   @param val1 the second value associated with the rule
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        add_fast_path(
+            tls_t const &tls,
+            bsl::safe_u64 const &kind,
+            bsl::safe_u64 const &key,
+            bsl::safe_u64 const &val0,
+            bsl::safe_u64 const &val1) noexcept -> bsl::errc_type
+        {
+            auto *const pmut_fast_path{m_fast_paths.at_if(bsl::to_idx(tls.ppid))};
+            bsl::expects(nullptr != pmut_fast_path);
+
+            return pmut_fast_path->add(kind, key, val0, val1);
+        }
+
         /// <!-- description -->
         ///   @brief Opens a handle and returns the resulting handle
         ///
@@ -361,6 +417,30 @@ namespace mk
             return m_is_executing_fail;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided page is mapped into this
+        ///     extension's main RPT, meaning it is a page that was given to
+        ///     this extension and not some other part of the address space.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address of the page to check
+        ///   @return Returns true if the provided page is mapped into this
+        ///     extension's main RPT, false otherwise.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_page_owned(
+            tls_t const &tls, page_pool_t const &page_pool, bsl::safe_u64 const &page_virt) noexcept
+            -> bool
+        {
+            bsl::expects(page_virt.is_valid_and_checked());
+            bsl::expects(page_virt.is_pos());
+
+            bsl::discard(page_pool);
+            return bsl::errc_success == tls.test_ret;
+        }
+
         /// <!-- description -->
         ///   @brief Allocates a page and maps it into the extension's
         ///     address space.
@@ -408,6 +488,37 @@ namespace mk
             return {tls.test_virt, tls.test_phys};
         }
 
+        /// <!-- description -->
+        ///   @brief Frees a huge allocation that was previously allocated
+        ///     using alloc_huge().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param huge_pool the huge_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param huge_virt the virtual address returned by alloc_huge()
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        free_huge(
+            tls_t const &tls,
+            page_pool_t const &page_pool,
+            huge_pool_t const &huge_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &huge_virt) noexcept -> bsl::errc_type
+        {
+            bsl::expects(huge_virt.is_valid_and_checked());
+            bsl::expects(huge_virt.is_pos());
+
+            bsl::discard(page_pool);
+            bsl::discard(huge_pool);
+            bsl::discard(intrinsic);
+
+            return tls.test_ret;
+        }
+
         /// <!-- description -->
         ///   @brief Maps a page into the direct map portion of the requested
         ///     VM's direct map RPT given a physical address to map.
@@ -464,6 +575,64 @@ namespace mk
             return tls.test_ret;
         }
 
+        /// <!-- description -->
+        ///   @brief Unmaps a page from the direct map portion of the requested
+        ///     VM's direct map RPT given a virtual address to unmap, and
+        ///     removes it from the TLB of every PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param vmid the ID of the VM to unmap page_virt from
+        ///   @param page_virt the virtual address to unmap
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        unmap_page_direct_broadcast(
+            tls_t const &tls,
+            page_pool_t const &page_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &page_virt) noexcept -> bsl::errc_type
+        {
+            bsl::discard(page_pool);
+            bsl::discard(intrinsic);
+            bsl::discard(vmid);
+            bsl::discard(page_virt);
+
+            return tls.test_ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the extension that the current PP is about to
+        ///     return to it from a syscall.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        static constexpr void
+        enter_direct_map(tls_t const &tls, intrinsic_t const &intrinsic) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(intrinsic);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the extension that the current PP has stopped
+        ///     executing it because of a syscall.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        static constexpr void
+        leave_direct_map(tls_t const &tls) noexcept
+        {
+            bsl::discard(tls);
+        }
+
         /// <!-- description -->
         ///   @brief Tells the extension that a VM was created so that it
         ///     can initialize it's VM specific resources.
@@ -640,6 +809,13 @@ namespace mk
         {
             bsl::discard(tls);
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the ext_t's locks
+        ///
+        static constexpr void
+        dump_locks() noexcept
+        {}
     };
 }
 
@@ -255,6 +255,13 @@ namespace mk
         {
             bsl::discard(tls);
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the huge_pool_t's locks
+        ///
+        static constexpr void
+        dump_locks() noexcept
+        {}
     };
 }
 
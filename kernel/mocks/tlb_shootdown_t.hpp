@@ -0,0 +1,161 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef MOCKS_TLB_SHOOTDOWN_T_HPP
+#define MOCKS_TLB_SHOOTDOWN_T_HPP
+
+#include <intrinsic_t.hpp>
+#include <root_page_table_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Invalidates an extension's direct map on every PP that
+    ///     might still hold a stale translation for it.
+    ///
+    class tlb_shootdown_t final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Activates the provided RPT on the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param mut_rpt the RPT this tlb_shootdown_t belongs to
+        ///
+        static constexpr void
+        activate(tls_t &mut_tls, intrinsic_t &mut_intrinsic, root_page_table_t &mut_rpt) noexcept
+        {
+            mut_rpt.activate(mut_tls, mut_intrinsic);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the current PP as exposed and then invalidates
+        ///     everything that was queued since the last time the current
+        ///     PP did so.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param mut_rpt the RPT this tlb_shootdown_t belongs to
+        ///
+        static constexpr void
+        enter(tls_t &mut_tls, intrinsic_t &mut_intrinsic, root_page_table_t &mut_rpt) noexcept
+        {
+            bsl::discard(mut_tls);
+            bsl::discard(mut_intrinsic);
+            bsl::discard(mut_rpt);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the current PP as no longer exposed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        static constexpr void
+        leave(tls_t const &tls) noexcept
+        {
+            bsl::discard(tls);
+        }
+
+        /// <!-- description -->
+        ///   @brief Queues the provided address so that every PP will
+        ///     invalidate it, and returns the generation the address was
+        ///     given.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param virt the virtual address to invalidate
+        ///   @return Returns the generation the address was given
+        ///
+        [[nodiscard]] static constexpr auto
+        queue(tls_t const &tls, bsl::safe_u64 const &virt) noexcept -> bsl::safe_u64
+        {
+            bsl::discard(tls);
+            bsl::expects(virt.is_valid_and_checked());
+
+            return bsl::safe_u64::magic_1();
+        }
+
+        /// <!-- description -->
+        ///   @brief Queues a flush of the whole TLB on every PP, and
+        ///     returns the generation it was given.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the generation the flush was given
+        ///
+        [[nodiscard]] static constexpr auto
+        queue_flush_all(tls_t const &tls) noexcept -> bsl::safe_u64
+        {
+            bsl::discard(tls);
+            return bsl::safe_u64::magic_1();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every other online PP that is exposed
+        ///     has invalidated everything up to the provided generation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param gen the generation returned by queue() or
+        ///     queue_flush_all()
+        ///   @return Returns bsl::errc_success == tls.test_ret
+        ///
+        [[nodiscard]] static constexpr auto
+        is_acked(tls_t const &tls, bsl::safe_u64 const &gen) noexcept -> bool
+        {
+            bsl::expects(gen.is_valid_and_checked());
+            return bsl::errc_success == tls.test_ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Waits until every other online PP that is exposed has
+        ///     invalidated everything up to the provided generation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param gen the generation returned by queue() or
+        ///     queue_flush_all()
+        ///   @return Returns tls.test_ret
+        ///
+        [[nodiscard]] static constexpr auto
+        wait(tls_t const &tls, bsl::safe_u64 const &gen) noexcept -> bsl::errc_type
+        {
+            bsl::expects(gen.is_valid_and_checked());
+            return tls.test_ret;
+        }
+    };
+}
+
+#endif
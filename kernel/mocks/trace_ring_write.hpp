@@ -0,0 +1,50 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_TRACE_RING_WRITE_HPP
+#define MOCKS_TRACE_RING_WRITE_HPP
+
+#include <trace_record_t.hpp>
+#include <trace_ring_t.hpp>
+
+#include <bsl/discard.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Adds a record to a PP's trace ring.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ring the trace ring to add the record to
+    ///   @param rec the record to add
+    ///
+    constexpr void
+    trace_ring_write(loader::trace_ring_t const &ring, loader::trace_record_t const &rec) noexcept
+    {
+        bsl::discard(ring);
+        bsl::discard(rec);
+    }
+}
+
+#endif
@@ -56,6 +56,37 @@ namespace mk
             bsl::discard(rec);
         }
 
+        /// <!-- description -->
+        ///   @brief Adds a VMExit to the stats of the requested PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the id of the PP whose stats should be added to
+        ///   @param exit_reason the exit reason of the VMExit
+        ///   @param cycles the number of cycles from VMExit to VMEntry
+        ///
+        static constexpr void
+        add_stats(
+            bsl::safe_u16 const &ppid,
+            bsl::safe_u64 const &exit_reason,
+            bsl::safe_u64 const &cycles) noexcept
+        {
+            bsl::discard(ppid);
+            bsl::discard(exit_reason);
+            bsl::discard(cycles);
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the VMExit stats for the requested PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP whose stats should be dumped
+        ///
+        static constexpr void
+        dump_stats(bsl::safe_u16 const &ppid) noexcept
+        {
+            bsl::discard(ppid);
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the contents of the VMExit log for the requested PP
         ///
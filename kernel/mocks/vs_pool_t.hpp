@@ -27,6 +27,8 @@
 
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <exit_info_t.hpp>
+#include <fast_path_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <state_save_t.hpp>
@@ -488,6 +490,35 @@ namespace mk
             return this->get_vs(vsid)->write(tls, intrinsic, reg, val);
         }
 
+        /// <!-- description -->
+        ///   @brief Sets the list of registers that the requested vs_t
+        ///     publishes into the extension's TLS block on every VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param info the list of registers to publish
+        ///   @param vsid the ID of the vs_t to set the list of
+        ///
+        constexpr void
+        set_exit_info(exit_info_t const &info, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->set_exit_info(info);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the list of registers that the requested vs_t
+        ///     publishes into the extension's TLS block on every VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to get the list of
+        ///   @return Returns the list of registers that the requested vs_t
+        ///     publishes into the extension's TLS block on every VMExit.
+        ///
+        [[nodiscard]] constexpr auto
+        exit_info(bsl::safe_u16 const &vsid) const noexcept -> exit_info_t const &
+        {
+            return this->get_vs(vsid)->exit_info();
+        }
+
         /// <!-- description -->
         ///   @brief Runs the vs_t. Note that this function does not
         ///     return until a VMExit occurs. Once complete, this function
@@ -525,6 +556,32 @@ namespace mk
             bsl::discard(vsid);
         }
 
+        /// <!-- description -->
+        ///   @brief Attempts to handle the current VMExit of the active
+        ///     vs_t using the provided fast path rules. The mock only
+        ///     honors "advance IP and resume" rules.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param rules the fast path rules to use
+        ///   @param exit_reason the exit reason of the current VMExit
+        ///   @return Returns true if the VMExit was handled, false otherwise
+        ///
+        [[nodiscard]] static constexpr auto
+        handle_fast_path(
+            tls_t const &tls,
+            intrinsic_t const &intrinsic,
+            fast_path_t const &rules,
+            bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            bsl::discard(tls);
+            bsl::discard(intrinsic);
+
+            auto const key{bsl::to_u64(exit_reason)};
+            return nullptr != rules.find(syscall::BF_FAST_PATH_ADVANCE_IP, key);
+        }
+
         /// <!-- description -->
         ///   @brief Clears the vs_t's internal cache. Note that this is a
         ///     hardware specific function and doesn't change the actual
@@ -585,6 +642,52 @@ namespace mk
             bsl::discard(vsid);
         }
 
+        /// <!-- description -->
+        ///   @brief Given a GLA and a number of pages, invalidates any TLB
+        ///     entries on this PP associated with this VS for each page
+        ///     in the provided range, one page at a time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param gla the guest linear address of the first page
+        ///   @param num_pages the number of pages to invalidate
+        ///   @param vsid the ID of the vs_t to flush
+        ///
+        static constexpr void
+        tlb_flush_range(
+            tls_t const &tls,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &gla,
+            bsl::safe_u64 const &num_pages,
+            bsl::safe_u16 const &vsid) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(intrinsic);
+            bsl::discard(vsid);
+
+            bsl::expects(gla.is_valid_and_checked());
+            bsl::expects(num_pages.is_valid_and_checked());
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates every TLB entry on this PP associated with
+        ///     the requested VS.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param vsid the ID of the vs_t to flush
+        ///
+        static constexpr void
+        tlb_flush_all(
+            tls_t const &tls, intrinsic_t const &intrinsic, bsl::safe_u16 const &vsid) noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(intrinsic);
+            bsl::discard(vsid);
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the requested vs_t
         ///
@@ -600,6 +703,13 @@ namespace mk
             bsl::discard(intrinsic);
             bsl::discard(vsid);
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the vs_pool_t's locks
+        ///
+        static constexpr void
+        dump_locks() noexcept
+        {}
     };
 }
 
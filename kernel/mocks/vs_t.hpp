@@ -28,6 +28,8 @@
 #include <allocated_status_t.hpp>
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <exit_info_t.hpp>
+#include <fast_path_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <state_save_t.hpp>
@@ -49,6 +51,9 @@ namespace mk
     constexpr bsl::errc_type UNIT_TEST_VS_FAIL_READ{-60001};
     /// @brief defines a unit testing specific error code
     constexpr bsl::errc_type UNIT_TEST_VS_FAIL_WRITE{-60002};
+    /// @brief defines a unit testing specific exit reason that is not
+    ///   caused by an instruction
+    constexpr auto UNIT_TEST_VS_EVENT_EXIT{0xFFFF_umx};
 
     /// <!-- description -->
     ///   @brief Defines the microkernel's notion of a VS.
@@ -70,6 +75,8 @@ namespace mk
 
         /// @brief stores the ID of the PP this vs_t is active on
         bsl::unordered_map<syscall::bf_reg_t, bsl::safe_u64> m_regs{};
+        /// @brief stores the registers to publish to the extension on VMExit
+        exit_info_t m_exit_info{};
 
     public:
         /// <!-- description -->
@@ -174,6 +181,7 @@ namespace mk
 
             bsl::expects(this->is_active().is_invalid());
 
+            m_exit_info.clear();
             m_assigned_ppid = {};
             m_assigned_vpid = {};
             m_assigned_vmid = {};
@@ -493,6 +501,34 @@ namespace mk
             return {};
         }
 
+        /// <!-- description -->
+        ///   @brief Sets the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param info the list of registers to publish
+        ///
+        constexpr void
+        set_exit_info(exit_info_t const &info) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_exit_info = info;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///
+        [[nodiscard]] constexpr auto
+        exit_info() const noexcept -> exit_info_t const &
+        {
+            return m_exit_info;
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the vs_t
         ///
@@ -509,6 +545,55 @@ namespace mk
             bsl::expects(tls.ppid == this->assigned_pp());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided exit reason is caused by
+        ///     the guest executing an instruction. The mock treats every
+        ///     exit reason as an instruction exit except for
+        ///     UNIT_TEST_VS_EVENT_EXIT.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit reason to check
+        ///   @return Returns true if the provided exit reason is caused by
+        ///     the guest executing an instruction.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_instruction_exit(bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            return exit_reason != UNIT_TEST_VS_EVENT_EXIT;
+        }
+
+        /// <!-- description -->
+        ///   @brief Attempts to handle the current VMExit using the
+        ///     provided fast path rules. The mock only honors "advance IP
+        ///     and resume" rules.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param rules the fast path rules to use
+        ///   @param exit_reason the exit reason of the current VMExit
+        ///   @return Returns true if the VMExit was handled, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        handle_fast_path(
+            tls_t const &tls,
+            intrinsic_t const &intrinsic,
+            fast_path_t const &rules,
+            bsl::safe_umx const &exit_reason) const noexcept -> bool
+        {
+            bsl::discard(intrinsic);
+
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(tls.ppid == this->assigned_pp());
+
+            if (!is_instruction_exit(exit_reason)) {
+                return false;
+            }
+
+            auto const key{bsl::to_u64(exit_reason)};
+            return nullptr != rules.find(syscall::BF_FAST_PATH_ADVANCE_IP, key);
+        }
+
         /// <!-- description -->
         ///   @brief Clears the vs_t's internal cache. Note that this is a
         ///     hardware specific function and doesn't change the actual
@@ -564,6 +649,23 @@ namespace mk
             bsl::expects(tls.ppid == this->assigned_pp());
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates every TLB entry on this PP that is tagged
+        ///     with this VS's VPID/ASID.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        tlb_flush_all(tls_t const &tls, intrinsic_t const &intrinsic) noexcept
+        {
+            bsl::discard(intrinsic);
+
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(tls.ppid == this->assigned_pp());
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the vs_t
         ///
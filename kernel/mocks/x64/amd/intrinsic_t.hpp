@@ -46,6 +46,8 @@ namespace mk
         bsl::unordered_map<bsl::safe_u64, bsl::safe_u64> m_tlss{};
         /// @brief stores values associated with MSRs
         bsl::unordered_map<bsl::safe_u32, bsl::safe_u64> m_msrs{};
+        /// @brief stores the number of ASIDs returned by nasid()
+        bsl::safe_u64 m_nasid{0x8000_u64};
 
     public:
         /// <!-- description -->
@@ -69,6 +71,33 @@ namespace mk
             bsl::expects(asid.is_pos());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the number of ASIDs supported by the current
+        ///     PP (including ASID 0, which belongs to the host) as
+        ///     reported by CPUID 0x8000000A.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of ASIDs supported by the current PP
+        ///
+        [[nodiscard]] constexpr auto
+        nasid() const noexcept -> bsl::safe_u64
+        {
+            return m_nasid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the value returned by nasid()
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param val the value to set the number of ASIDs to
+        ///
+        constexpr void
+        set_nasid(bsl::safe_u64 const &val) noexcept
+        {
+            bsl::expects(val.is_valid_and_checked());
+            m_nasid = val;
+        }
+
         /// <!-- description -->
         ///   @brief Sets the value of CR3
         ///
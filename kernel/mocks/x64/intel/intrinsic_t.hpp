@@ -57,6 +57,8 @@ namespace mk
         bsl::unordered_map<bsl::safe_u32, bsl::safe_u64> m_msrs{};
         /// @brief stores values associated with the VMCS
         bsl::unordered_map<bsl::safe_u64, bsl::safe_u64> m_vmcs{};
+        /// @brief stores the VPID last given to tlb_flush_vpid()
+        bsl::safe_u16 m_flushed_vpid{};
 
     public:
         /// <!-- description -->
@@ -81,6 +83,46 @@ namespace mk
             bsl::expects(vpid.is_valid_and_checked());
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates the TLB entries of the provided VPID on the
+        ///     current PP (i.e., a single-context INVVPID). Guest-physical
+        ///     mappings and extension addresses are not invalidated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpid the VPID (as defined by Intel) to flush.
+        ///
+        constexpr void
+        tlb_flush_vpid(bsl::safe_u16 const &vpid) noexcept
+        {
+            bsl::expects(vpid.is_valid_and_checked());
+            bsl::expects(vpid.is_pos());
+
+            m_flushed_vpid = vpid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the VPID last given to tlb_flush_vpid(), or 0
+        ///     if tlb_flush_vpid() was never called.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the VPID last given to tlb_flush_vpid(), or 0
+        ///     if tlb_flush_vpid() was never called.
+        ///
+        [[nodiscard]] constexpr auto
+        flushed_vpid() const noexcept -> bsl::safe_u16
+        {
+            return m_flushed_vpid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates the TLB entries of every VPID on the current
+        ///     PP (i.e., an all-context INVVPID). Extension addresses are
+        ///     not invalidated.
+        ///
+        static constexpr void
+        tlb_flush_all_vpids() noexcept
+        {}
+
         /// <!-- description -->
         ///   @brief Returns the value of ES
         ///
@@ -124,7 +124,8 @@ namespace mk
             }
 
             case syscall::BF_MEM_OP_VAL.get(): {
-                auto const ret{dispatch_syscall_bf_mem_op(mut_tls, mut_page_pool, mut_huge_pool)};
+                auto const ret{dispatch_syscall_bf_mem_op(
+                    mut_tls, mut_page_pool, mut_huge_pool, mut_intrinsic)};
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
@@ -172,7 +173,7 @@ namespace mk
             }
 
             case syscall::BF_CONTROL_OP_VAL.get(): {
-                auto const ret{dispatch_syscall_bf_control_op(mut_tls)};
+                auto const ret{dispatch_syscall_bf_control_op(mut_tls, mut_page_pool)};
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
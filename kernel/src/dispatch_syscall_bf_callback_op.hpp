@@ -32,6 +32,7 @@
 #include <ext_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
@@ -123,6 +124,49 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the bf_callback_op_register_fast_path syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_callback_op_register_fast_path(tls_t &mut_tls) noexcept -> syscall::bf_status_t
+    {
+        auto const kind{get_fast_path_kind(mut_tls.ext_reg1)};
+        if (bsl::unlikely(kind.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const key{get_fast_path_key(kind, mut_tls.ext_reg2)};
+        if (bsl::unlikely(key.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        /// NOTE:
+        /// - Fast path rules are only ever consulted for the extension that
+        ///   registered for VMExits, so any other extension is refused
+        ///   rather than silently registering rules that would never match.
+        ///
+
+        if (bsl::unlikely(!is_the_active_ext_the_vmexit_ext(mut_tls))) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_PERM_DENIED;
+        }
+
+        auto const ret{mut_tls.ext->add_fast_path(
+            mut_tls, kind, key, bsl::to_u64(mut_tls.ext_reg3), bsl::to_u64(mut_tls.ext_reg4))};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches the bf_callback_op syscalls
     ///
@@ -169,6 +213,16 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL.get(): {
+                auto const ret{syscall_bf_callback_op_register_fast_path(mut_tls)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
@@ -27,26 +27,68 @@
 
 #include "dispatch_syscall_helpers.hpp"
 
+#include <basic_page_pool_cache_t.hpp>
 #include <bf_constants.hpp>
 #include <bf_types.hpp>
+#include <errc_types.hpp>
 #include <ext_t.hpp>
+#include <page_pool_t.hpp>
 #include <return_to_mk.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
 
 namespace mk
 {
+    /// <!-- description -->
+    ///   @brief Returns true if bf_control_op_vmexit_return can be used,
+    ///     meaning the caller is the extension registered for VMExits and
+    ///     there is an active VM, VP and VS to return to. On x64, these
+    ///     are also the checks that dispatch_syscall_entry makes before
+    ///     it takes its fast path, so the two must always match.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @return Returns true if bf_control_op_vmexit_return can be used,
+    ///     false otherwise.
+    ///
+    [[nodiscard]] constexpr auto
+    is_vmexit_return_allowed(tls_t const &tls) noexcept -> bool
+    {
+        if (bsl::unlikely(tls.ext != tls.ext_vmexit)) {
+            return false;
+        }
+
+        if (bsl::unlikely(syscall::BF_INVALID_ID == bsl::to_u16(tls.active_vmid))) {
+            return false;
+        }
+
+        if (bsl::unlikely(syscall::BF_INVALID_ID == bsl::to_u16(tls.active_vpid))) {
+            return false;
+        }
+
+        if (bsl::unlikely(syscall::BF_INVALID_ID == bsl::to_u16(tls.active_vsid))) {
+            return false;
+        }
+
+        return true;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches the bf_callback_op syscalls
     ///
     /// <!-- inputs/outputs -->
     ///   @param tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
-    dispatch_syscall_bf_control_op(tls_t const &tls) noexcept -> syscall::bf_status_t
+    dispatch_syscall_bf_control_op(tls_t const &tls, page_pool_t &mut_page_pool) noexcept
+        -> syscall::bf_status_t
     {
         switch (syscall::bf_syscall_index(tls.ext_syscall).get()) {
             case syscall::BF_CONTROL_OP_EXIT_IDX_VAL.get(): {
@@ -61,6 +103,13 @@ namespace mk
                     return_to_mk(bsl::errc_failure);
                 }
                 else {
+                    /// NOTE:
+                    /// - The extension is done bootstrapping this PP, and
+                    ///   the PP is about to be handed back to the root VM,
+                    ///   so this is a good time to pre-zero some pages.
+                    ///
+
+                    mut_page_pool.zero_pages(tls, lib::BASIC_PAGE_POOL_CACHE_BATCH);
                     return_to_mk(bsl::errc_success);
                 }
 
@@ -80,6 +129,44 @@ namespace mk
                 return syscall::BF_STATUS_SUCCESS;
             }
 
+            case syscall::BF_CONTROL_OP_VMEXIT_RETURN_IDX_VAL.get(): {
+                /// NOTE:
+                /// - On x64, valid codes never make it this far as they are
+                ///   handled by dispatch_syscall_entry without saving the
+                ///   extension's state. This is the reference version of
+                ///   that fast path, and it is also what reports an
+                ///   invalid code, or a call made outside of a VMExit.
+                ///
+
+                if (bsl::unlikely(!is_vmexit_return_allowed(tls))) {
+                    bsl::error() << "vmexit return used outside of a vmexit\n" << bsl::here();
+
+                    return_to_mk(bsl::errc_failure);
+
+                    // Unreachable
+                    return syscall::BF_STATUS_SUCCESS;
+                }
+
+                auto const code{bsl::to_u64(tls.ext_reg0)};
+                if (syscall::BF_VMEXIT_RETURN_RUN_CURRENT == code) {
+                    return_to_mk(vmexit_success);
+                }
+                else if (syscall::BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT == code) {
+                    return_to_mk(vmexit_success_advance_ip);
+                }
+                else {
+                    bsl::error() << "invalid vmexit return code "    // --
+                                 << bsl::hex(code)                   // --
+                                 << bsl::endl                        // --
+                                 << bsl::here();                     // --
+
+                    return_to_mk(bsl::errc_failure);
+                }
+
+                // Unreachable
+                return syscall::BF_STATUS_SUCCESS;
+            }
+
             default: {
                 break;
             }
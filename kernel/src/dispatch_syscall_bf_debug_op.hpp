@@ -27,6 +27,7 @@
 
 #include "dispatch_syscall_helpers.hpp"
 
+#include <basic_lock_stats_t.hpp>
 #include <bf_constants.hpp>
 #include <bf_types.hpp>
 #include <ext_pool_t.hpp>
@@ -44,6 +45,7 @@
 #include <bsl/debug.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
@@ -181,6 +183,49 @@ namespace mk
                 return syscall::BF_STATUS_SUCCESS;
             }
 
+            case syscall::BF_DEBUG_OP_DUMP_LOCKS_IDX_VAL.get(): {
+                lib::basic_lock_stats_t<>::dump_header();
+                page_pool.dump_locks();
+                huge_pool.dump_locks();
+                vs_pool.dump_locks();
+                ext_pool.dump_locks();
+                lib::basic_lock_stats_t<>::dump_footer();
+                return syscall::BF_STATUS_SUCCESS;
+            }
+
+            case syscall::BF_DEBUG_OP_DUMP_VMEXIT_STATS_IDX_VAL.get(): {
+                auto const ppid{get_ppid(mut_tls, mut_tls.ext_reg0)};
+                if (bsl::unlikely(ppid.is_invalid())) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return syscall::BF_STATUS_INVALID_INPUT_REG0;
+                }
+
+                log.dump_stats(ppid);
+
+                /// NOTE:
+                /// - The bf_vs_op_run fast path counters live in the TLS
+                ///   block, so they can only be reported for this PP.
+                ///
+
+                if (bsl::to_u16(mut_tls.ppid) == ppid) {
+                    bsl::print() << bsl::ylw << "run fast path hits: ";
+                    bsl::print() << bsl::rst << bsl::to_u64(mut_tls.run_fast_path_hits);
+                    bsl::print() << bsl::ylw << ", misses: ";
+                    bsl::print() << bsl::rst << bsl::to_u64(mut_tls.run_fast_path_misses);
+                    bsl::print() << bsl::rst << bsl::endl;
+                    bsl::print() << bsl::ylw << "tlb range flushes by page: ";
+                    bsl::print() << bsl::rst << bsl::to_u64(mut_tls.tlb_flush_range_pages);
+                    bsl::print() << bsl::ylw << ", by vs: ";
+                    bsl::print() << bsl::rst << bsl::to_u64(mut_tls.tlb_flush_range_full);
+                    bsl::print() << bsl::rst << bsl::endl;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                return syscall::BF_STATUS_SUCCESS;
+            }
+
             default: {
                 break;
             }
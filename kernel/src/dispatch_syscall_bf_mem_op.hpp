@@ -33,6 +33,7 @@
 #include <bf_types.hpp>
 #include <ext_t.hpp>
 #include <huge_pool_t.hpp>
+#include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
@@ -98,6 +99,39 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the bf_mem_op_free_huge syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param mut_huge_pool the huge pool to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_mem_op_free_huge(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        huge_pool_t &mut_huge_pool,
+        intrinsic_t const &intrinsic) noexcept -> syscall::bf_status_t
+    {
+        auto const virt{get_huge_virt(mut_tls.ext_reg1)};
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const ret{
+            mut_tls.ext->free_huge(mut_tls, mut_page_pool, mut_huge_pool, intrinsic, virt)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches the bf_mem_op syscalls
     ///
@@ -105,12 +139,15 @@ namespace mk
     ///   @param mut_tls the current TLS block
     ///   @param mut_page_pool the page_pool_t to use
     ///   @param mut_huge_pool the huge pool to use
+    ///   @param intrinsic the intrinsic_t to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
     dispatch_syscall_bf_mem_op(
-        tls_t &mut_tls, page_pool_t &mut_page_pool, huge_pool_t &mut_huge_pool) noexcept
-        -> syscall::bf_status_t
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        huge_pool_t &mut_huge_pool,
+        intrinsic_t const &intrinsic) noexcept -> syscall::bf_status_t
     {
         if (bsl::unlikely(!verify_handle_for_current_ext(mut_tls))) {
             bsl::print<bsl::V>() << bsl::here();
@@ -138,6 +175,17 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_MEM_OP_FREE_HUGE_IDX_VAL.get(): {
+                auto const ret{
+                    syscall_bf_mem_op_free_huge(mut_tls, mut_page_pool, mut_huge_pool, intrinsic)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
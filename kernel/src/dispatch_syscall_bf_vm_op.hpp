@@ -29,6 +29,7 @@
 
 #include <bf_constants.hpp>
 #include <bf_types.hpp>
+#include <errc_types.hpp>
 #include <ext_pool_t.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
@@ -188,19 +189,45 @@ namespace mk
     ///   @brief Implements the bf_vm_op_unmap_direct_broadcast syscall
     ///
     /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param vm_pool the vm_pool_t to use
     ///   @return Returns a bf_status_t containing success or failure
     ///
     [[nodiscard]] constexpr auto
-    syscall_bf_vm_op_unmap_direct_broadcast() noexcept -> syscall::bf_status_t
+    syscall_bf_vm_op_unmap_direct_broadcast(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        intrinsic_t const &intrinsic,
+        vm_pool_t const &vm_pool) noexcept -> syscall::bf_status_t
     {
-        /// TODO:
-        /// - We need to implement this. The reason this exists is that an
-        ///   extension may wish to map memory, and then access it from any
-        ///   PP. When this happens, the TLB will then contain the memory
-        ///   associated with that PP.
-
-        bsl::error() << "bf_vm_op_unmap_direct_broadcast currently not supported\n";
-        return syscall::BF_STATUS_FAILURE_UNSUPPORTED;
+        auto const vmid{get_allocated_vmid(mut_tls.ext_reg1, vm_pool)};
+        if (bsl::unlikely(vmid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const virt{get_direct_map_virt(mut_tls.ext_reg2)};
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        auto const ret{mut_tls.ext->unmap_page_direct_broadcast(
+            mut_tls, mut_page_pool, intrinsic, vmid, virt)};
+
+        if (bsl::unlikely(tlb_shootdown_timeout == ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_RETRY;
+        }
+
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_FAILURE_UNKNOWN;
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
     }
 
     /// <!-- description -->
@@ -308,7 +335,8 @@ namespace mk
             }
 
             case syscall::BF_VM_OP_UNMAP_DIRECT_BROADCAST_IDX_VAL.get(): {
-                auto const ret{syscall_bf_vm_op_unmap_direct_broadcast()};
+                auto const ret{syscall_bf_vm_op_unmap_direct_broadcast(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vm_pool)};
                 if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return ret;
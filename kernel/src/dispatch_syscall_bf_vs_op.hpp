@@ -31,6 +31,7 @@
 #include <bf_reg_t.hpp>
 #include <bf_types.hpp>
 #include <errc_types.hpp>
+#include <exit_info_t.hpp>
 #include <ext_pool_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
@@ -45,6 +46,7 @@
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
@@ -237,6 +239,298 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Reads the first num registers listed in mut_regs from the
+    ///     requested VS, storing each value next to the bf_reg_t it was
+    ///     read from.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to read from
+    ///   @param mut_regs the list of bf_reg_t/value pairs to read
+    ///   @param num the number of entries in mut_regs to read
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    read_reg_vals(
+        tls_t &mut_tls,
+        intrinsic_t const &intrinsic,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        syscall::bf_reg_vals_t &mut_regs,
+        bsl::safe_u64 const &num) noexcept -> syscall::bf_status_t
+    {
+        for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(num); ++mut_i) {
+            auto *const pmut_reg_val{mut_regs.at_if(mut_i)};
+
+            auto const reg{get_reg(pmut_reg_val->reg)};
+            if (bsl::unlikely(syscall::bf_reg_t::bf_reg_t_invalid == reg)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_INVALID_INPUT_REG2;
+            }
+
+            auto const val{mut_vs_pool.read(mut_tls, intrinsic, reg, vsid)};
+            if (bsl::unlikely(val.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            pmut_reg_val->val = val.get();
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes the first num bf_reg_t/value pairs listed in regs to
+    ///     the requested VS, in order. If a pair cannot be written, the
+    ///     remaining pairs are not written.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to write to
+    ///   @param regs the list of bf_reg_t/value pairs to write
+    ///   @param num the number of entries in regs to write
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    write_reg_vals(
+        tls_t &mut_tls,
+        intrinsic_t &mut_intrinsic,
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        syscall::bf_reg_vals_t const &regs,
+        bsl::safe_u64 const &num) noexcept -> syscall::bf_status_t
+    {
+        for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(num); ++mut_i) {
+            auto const *const preg_val{regs.at_if(mut_i)};
+
+            auto const reg{get_reg(preg_val->reg)};
+            if (bsl::unlikely(syscall::bf_reg_t::bf_reg_t_invalid == reg)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_INVALID_INPUT_REG2;
+            }
+
+            auto const ret{
+                mut_vs_pool.write(mut_tls, mut_intrinsic, reg, bsl::to_u64(preg_val->val), vsid)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_FAILURE_UNKNOWN;
+            }
+
+            bsl::touch();
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the bf_vs_op_read_many syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param intrinsic the intrinsic_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_vs_op_read_many(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        intrinsic_t const &intrinsic,
+        vs_pool_t &mut_vs_pool) noexcept -> syscall::bf_status_t
+    {
+        auto const vsid{get_locally_assigned_vsid(mut_tls, mut_tls.ext_reg1, mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const virt{get_reg_vals(mut_tls, mut_page_pool, mut_tls.ext_reg2)};
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        auto const num{get_num_reg_vals(mut_tls.ext_reg3)};
+        if (bsl::unlikely(num.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG3;
+        }
+
+        /// NOTE:
+        /// - get_reg_vals() verified that the page is mapped into the
+        ///   extension's root page tables, which are the page tables that
+        ///   are active while this syscall executes, so the MK can access
+        ///   it directly.
+        ///
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto *const pmut_regs{reinterpret_cast<syscall::bf_reg_vals_t *>(virt.get())};
+        return read_reg_vals(mut_tls, intrinsic, mut_vs_pool, vsid, *pmut_regs, num);
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the bf_vs_op_write_many syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_vs_op_write_many(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        intrinsic_t &mut_intrinsic,
+        vs_pool_t &mut_vs_pool) noexcept -> syscall::bf_status_t
+    {
+        auto const vsid{get_locally_assigned_vsid(mut_tls, mut_tls.ext_reg1, mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const virt{get_reg_vals(mut_tls, mut_page_pool, mut_tls.ext_reg2)};
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        auto const num{get_num_reg_vals(mut_tls.ext_reg3)};
+        if (bsl::unlikely(num.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG3;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto const *const regs{reinterpret_cast<syscall::bf_reg_vals_t const *>(virt.get())};
+        return write_reg_vals(mut_tls, mut_intrinsic, mut_vs_pool, vsid, *regs, num);
+    }
+
+    /// <!-- description -->
+    ///   @brief Sets the list of registers that the requested VS publishes
+    ///     into the extension's TLS block on every VMExit to the bf_reg_t
+    ///     of the first num entries of regs. The values in regs are
+    ///     ignored.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @param vsid the ID of the VS to set the list of
+    ///   @param regs the list of bf_reg_t to publish
+    ///   @param num the number of entries in regs to publish. Must not be
+    ///     larger than syscall::BF_MAX_EXIT_INFO.
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    set_exit_info_regs(
+        vs_pool_t &mut_vs_pool,
+        bsl::safe_u16 const &vsid,
+        syscall::bf_reg_vals_t const &regs,
+        bsl::safe_u64 const &num) noexcept -> syscall::bf_status_t
+    {
+        exit_info_t mut_info{};
+        for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(num); ++mut_i) {
+            auto const reg{get_reg(regs.at_if(mut_i)->reg)};
+            if (bsl::unlikely(syscall::bf_reg_t::bf_reg_t_invalid == reg)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return syscall::BF_STATUS_INVALID_INPUT_REG2;
+            }
+
+            bsl::expects(mut_info.add(reg));
+        }
+
+        mut_vs_pool.set_exit_info(mut_info, vsid);
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the bf_vs_op_set_exit_info syscall
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_vs_op_set_exit_info(
+        tls_t &mut_tls, page_pool_t &mut_page_pool, vs_pool_t &mut_vs_pool) noexcept
+        -> syscall::bf_status_t
+    {
+        auto const vsid{get_locally_assigned_vsid(mut_tls, mut_tls.ext_reg1, mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const virt{get_reg_vals(mut_tls, mut_page_pool, mut_tls.ext_reg2)};
+        if (bsl::unlikely(virt.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        auto const num{get_num_exit_info(mut_tls.ext_reg3)};
+        if (bsl::unlikely(num.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG3;
+        }
+
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto const *const regs{reinterpret_cast<syscall::bf_reg_vals_t const *>(virt.get())};
+        return set_exit_info_regs(mut_vs_pool, vsid, *regs, num);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the VMID, VPID and VSID provided by the
+    ///     extension in REG1, REG2 and REG3 are the ones that are already
+    ///     active on this PP. Returns false otherwise, including when no VS
+    ///     is active on this PP.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @return Returns true if the requested VM/VP/VS are already active
+    ///     on this PP, false otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    is_active_on_this_pp(tls_t const &tls) noexcept -> bool
+    {
+        if (bsl::unlikely(syscall::BF_INVALID_ID == bsl::to_u16(tls.active_vsid))) {
+            return false;
+        }
+
+        if (bsl::to_u64(tls.ext_reg1) != bsl::to_u64(tls.active_vmid)) {
+            return false;
+        }
+
+        if (bsl::to_u64(tls.ext_reg2) != bsl::to_u64(tls.active_vpid)) {
+            return false;
+        }
+
+        return bsl::to_u64(tls.ext_reg3) == bsl::to_u64(tls.active_vsid);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns val + 1. Used to increment the raw counters that
+    ///     are stored in the TLS block.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param val the counter to increment
+    ///   @return Returns val + 1
+    ///
+    [[nodiscard]] constexpr auto
+    inc_counter(bsl::uint64 const val) noexcept -> bsl::uint64
+    {
+        return (bsl::to_u64(val) + bsl::safe_u64::magic_1()).checked().get();
+    }
+
     /// <!-- description -->
     ///   @brief Implements the bf_vs_op_run syscall
     ///
@@ -260,6 +554,32 @@ namespace mk
         ext_pool_t &mut_ext_pool,
         bool const advance_ip) noexcept -> syscall::bf_status_t
     {
+        /// NOTE:
+        /// - If the extension is asking to run the VM/VP/VS that is
+        ///   already active on this PP (which is the common case for an
+        ///   extension that handles a VMExit and then resumes the VS that
+        ///   generated it), everything set_active would do has already
+        ///   been done. The IDs were validated when they were made active,
+        ///   and active resources cannot be destroyed or migrated, so we
+        ///   can go straight back to the VMExit loop.
+        ///
+
+        if (is_active_on_this_pp(mut_tls)) {
+            mut_tls.run_fast_path_hits = inc_counter(mut_tls.run_fast_path_hits);
+
+            if (advance_ip) {
+                mut_vs_pool.advance_ip(mut_tls, mut_intrinsic, bsl::to_u16(mut_tls.active_vsid));
+            }
+            else {
+                bsl::touch();
+            }
+
+            return_to_mk(vmexit_success);
+            return syscall::BF_STATUS_SUCCESS;
+        }
+
+        mut_tls.run_fast_path_misses = inc_counter(mut_tls.run_fast_path_misses);
+
         auto const ret{syscall_bf_vs_op_set_active(
             mut_tls,
             mut_intrinsic,
@@ -654,6 +974,63 @@ namespace mk
         return syscall::BF_STATUS_SUCCESS;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the bf_vs_op_tlb_flush_range syscall. Ranges
+    ///     of up to HYPERVISOR_TLB_FLUSH_THRESHOLD pages are invalidated
+    ///     one page at a time. Larger ranges flush every TLB entry
+    ///     associated with the VS instead.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @param mut_vs_pool the vs_pool_t to use
+    ///   @return Returns a bf_status_t containing success or failure
+    ///
+    [[nodiscard]] constexpr auto
+    syscall_bf_vs_op_tlb_flush_range(
+        tls_t &mut_tls, intrinsic_t &mut_intrinsic, vs_pool_t &mut_vs_pool) noexcept
+        -> syscall::bf_status_t
+    {
+        auto const vsid{get_locally_assigned_vsid(mut_tls, mut_tls.ext_reg1, mut_vs_pool)};
+        if (bsl::unlikely(vsid.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG1;
+        }
+
+        auto const gla{get_gla(mut_tls.ext_reg2)};
+        if (bsl::unlikely(gla.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG2;
+        }
+
+        auto const num_pages{get_num_pages(gla, mut_tls.ext_reg3)};
+        if (bsl::unlikely(num_pages.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return syscall::BF_STATUS_INVALID_INPUT_REG3;
+        }
+
+        /// NOTE:
+        /// - Past some number of pages, one invalidation per page costs
+        ///   more than flushing the VS and refilling its TLB entries. Where
+        ///   that point is depends on the CPU and on how much of the TLB
+        ///   the VS is using, and the default of 32 is a starting point,
+        ///   not a measured value. The counters printed by
+        ///   bf_debug_op_dump_vmexit_stats show which path is taken, so
+        ///   HYPERVISOR_TLB_FLUSH_THRESHOLD can be tuned per platform.
+        ///
+
+        if (num_pages > HYPERVISOR_TLB_FLUSH_THRESHOLD) {
+            mut_vs_pool.tlb_flush_all(mut_tls, mut_intrinsic, vsid);
+            mut_tls.tlb_flush_range_full = inc_counter(mut_tls.tlb_flush_range_full);
+        }
+        else {
+            mut_vs_pool.tlb_flush_range(mut_tls, mut_intrinsic, gla, num_pages, vsid);
+            mut_tls.tlb_flush_range_pages = inc_counter(mut_tls.tlb_flush_range_pages);
+        }
+
+        return syscall::BF_STATUS_SUCCESS;
+    }
+
     /// <!-- description -->
     ///   @brief Dispatches the bf_vs_op syscalls
     ///
@@ -739,6 +1116,39 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_VS_OP_READ_MANY_IDX_VAL.get(): {
+                auto const ret{syscall_bf_vs_op_read_many(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_VS_OP_WRITE_MANY_IDX_VAL.get(): {
+                auto const ret{syscall_bf_vs_op_write_many(
+                    mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
+            case syscall::BF_VS_OP_SET_EXIT_INFO_IDX_VAL.get(): {
+                auto const ret{
+                    syscall_bf_vs_op_set_exit_info(mut_tls, mut_page_pool, mut_vs_pool)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             case syscall::BF_VS_OP_RUN_IDX_VAL.get(): {
                 auto const ret{syscall_bf_vs_op_run(
                     mut_tls,
@@ -857,6 +1267,17 @@ namespace mk
                 return ret;
             }
 
+            case syscall::BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL.get(): {
+                auto const ret{
+                    syscall_bf_vs_op_tlb_flush_range(mut_tls, mut_intrinsic, mut_vs_pool)};
+                if (bsl::unlikely(ret != syscall::BF_STATUS_SUCCESS)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                return ret;
+            }
+
             default: {
                 break;
             }
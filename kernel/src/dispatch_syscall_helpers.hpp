@@ -29,10 +29,12 @@
 #include <bf_reg_t.hpp>
 #include <bf_types.hpp>
 #include <ext_t.hpp>
+#include <page_pool_t.hpp>
 #include <tls_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vp_pool_t.hpp>
 #include <vs_pool_t.hpp>
+#include <vs_t.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
@@ -1109,6 +1111,158 @@ namespace mk
         return virt;
     }
 
+    /// <!-- description -->
+    ///   @brief Given an input register, returns the virtual address of a
+    ///     syscall::bf_reg_vals_t if the provided register contains the
+    ///     address of a page that the current extension allocated from its
+    ///     page pool. Otherwise, this function returns
+    ///     bsl::safe_umx::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
+    ///   @param reg the register to get the virtual address from.
+    ///   @return Given an input register, returns the virtual address of a
+    ///     syscall::bf_reg_vals_t if the provided register contains the
+    ///     address of a page that the current extension allocated from its
+    ///     page pool. Otherwise, this function returns
+    ///     bsl::safe_umx::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    get_reg_vals(
+        tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
+        // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+        bsl::uint64 const reg) noexcept -> bsl::safe_umx
+    {
+        constexpr auto min_addr{HYPERVISOR_EXT_PAGE_POOL_ADDR};
+        constexpr auto max_addr{(min_addr + HYPERVISOR_EXT_PAGE_POOL_SIZE).checked()};
+
+        auto const virt{bsl::to_umx(reg)};
+        if (bsl::unlikely(virt < min_addr)) {
+            bsl::error() << "the virtual address "                   // --
+                         << bsl::hex(virt)                           // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        if (bsl::unlikely(virt >= max_addr)) {
+            bsl::error() << "the virtual address "                   // --
+                         << bsl::hex(virt)                           // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        bool const aligned{syscall::bf_is_page_aligned(virt)};
+        if (bsl::unlikely(!aligned)) {
+            bsl::error() << "the virtual address "                       // --
+                         << bsl::hex(virt)                               // --
+                         << " is not page aligned and cannot be used"    // --
+                         << bsl::endl                                    // --
+                         << bsl::here();                                 // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        /// NOTE:
+        /// - Being in range only means the address is somewhere the page
+        ///   pool could be mapped. The MK is about to dereference it, so
+        ///   it also has to be a page that is actually mapped into the
+        ///   calling extension's address space.
+        ///
+
+        auto const owned{mut_tls.ext->is_page_owned(mut_tls, mut_page_pool, bsl::to_u64(virt))};
+        if (bsl::unlikely(!owned)) {
+            bsl::error() << "the virtual address "                                   // --
+                         << bsl::hex(virt)                                           // --
+                         << " is not mapped by this extension and cannot be used"    // --
+                         << bsl::endl                                                // --
+                         << bsl::here();                                             // --
+
+            return bsl::safe_umx::failure();
+        }
+
+        return virt;
+    }
+
+    /// <!-- description -->
+    ///   @brief Given an input register, returns the number of entries in a
+    ///     syscall::bf_reg_vals_t if the provided register contains a valid
+    ///     number of entries. Otherwise, this function returns
+    ///     bsl::safe_u64::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the register to get the number of entries from.
+    ///   @return Given an input register, returns the number of entries in a
+    ///     syscall::bf_reg_vals_t if the provided register contains a valid
+    ///     number of entries. Otherwise, this function returns
+    ///     bsl::safe_u64::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_num_reg_vals(bsl::uint64 const reg) noexcept -> bsl::safe_u64
+    {
+        auto const num{bsl::to_u64(reg)};
+        if (bsl::unlikely(num.is_zero())) {
+            bsl::error() << "the number of registers "          // --
+                         << bsl::hex(num)                       // --
+                         << " is invalid and cannot be used"    // --
+                         << bsl::endl                           // --
+                         << bsl::here();                        // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        if (bsl::unlikely(num > syscall::BF_MAX_REG_VALS)) {
+            bsl::error() << "the number of registers "               // --
+                         << bsl::hex(num)                            // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return num;
+    }
+
+    /// <!-- description -->
+    ///   @brief Given an input register, returns the number of registers to
+    ///     publish on VMExit if the provided register contains a valid
+    ///     number of registers (0 is valid and disables publishing).
+    ///     Otherwise, this function returns bsl::safe_u64::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the register to get the number of registers from.
+    ///   @return Given an input register, returns the number of registers to
+    ///     publish on VMExit if the provided register contains a valid
+    ///     number of registers. Otherwise, this function returns
+    ///     bsl::safe_u64::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_num_exit_info(bsl::uint64 const reg) noexcept -> bsl::safe_u64
+    {
+        auto const num{bsl::to_u64(reg)};
+        if (bsl::unlikely(num > syscall::BF_MAX_EXIT_INFO)) {
+            bsl::error() << "the number of exit info registers "     // --
+                         << bsl::hex(num)                            // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return num;
+    }
+
     /// <!-- description -->
     ///   @brief Given an input register, returns a guest linear address if the
     ///     provided register contains a valid guest linear address. Otherwise,
@@ -1149,6 +1303,49 @@ namespace mk
         return gla;
     }
 
+    /// <!-- description -->
+    ///   @brief Given a guest linear address and an input register, returns
+    ///     a number of pages if the provided register contains a valid
+    ///     number of pages starting at the provided guest linear address.
+    ///     Otherwise, this function returns bsl::safe_u64::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param gla the guest linear address the pages start at
+    ///   @param reg the register to get the number of pages from.
+    ///   @return Given a guest linear address and an input register, returns
+    ///     a number of pages if the provided register contains a valid
+    ///     number of pages starting at the provided guest linear address.
+    ///     Otherwise, this function returns bsl::safe_u64::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_num_pages(bsl::safe_umx const &gla, bsl::uint64 const reg) noexcept -> bsl::safe_u64
+    {
+        auto const num{bsl::to_u64(reg)};
+        if (bsl::unlikely(num.is_zero())) {
+            bsl::error() << "the number of pages "              // --
+                         << bsl::hex(num)                       // --
+                         << " is invalid and cannot be used"    // --
+                         << bsl::endl                           // --
+                         << bsl::here();                        // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        auto const end{gla + (num * HYPERVISOR_PAGE_SIZE)};
+        if (bsl::unlikely(end.is_poisoned())) {
+            bsl::error() << "the number of pages "                   // --
+                         << bsl::hex(num)                            // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return num;
+    }
+
     /// <!-- description -->
     ///   @brief Given an input register, returns a huge allocation size if
     ///     the provided register contains a valid huge allocation size.
@@ -1199,6 +1396,61 @@ namespace mk
         return size;
     }
 
+    /// <!-- description -->
+    ///   @brief Given an input register, returns the address of a huge
+    ///     allocation if the provided register contains an address inside
+    ///     of the extension's huge pool. Otherwise, this function returns
+    ///     bsl::safe_u64::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the register to get the address from.
+    ///   @return Given an input register, returns the address of a huge
+    ///     allocation if the provided register contains an address inside
+    ///     of the extension's huge pool. Otherwise, this function returns
+    ///     bsl::safe_u64::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_huge_virt(bsl::uint64 const reg) noexcept -> bsl::safe_u64
+    {
+        constexpr auto min_addr{HYPERVISOR_EXT_HUGE_POOL_ADDR};
+        constexpr auto max_addr{(min_addr + HYPERVISOR_EXT_HUGE_POOL_SIZE).checked()};
+
+        auto const virt{bsl::to_u64(reg)};
+        if (bsl::unlikely(virt <= min_addr)) {
+            bsl::error() << "the huge address "                      // --
+                         << bsl::hex(virt)                           // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        if (bsl::unlikely(virt >= max_addr)) {
+            bsl::error() << "the huge address "                      // --
+                         << bsl::hex(virt)                           // --
+                         << " is out of range and cannot be used"    // --
+                         << bsl::endl                                // --
+                         << bsl::here();                             // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        bool const aligned{syscall::bf_is_page_aligned(virt)};
+        if (bsl::unlikely(!aligned)) {
+            bsl::error() << "the huge address "                          // --
+                         << bsl::hex(virt)                               // --
+                         << " is not page aligned and cannot be used"    // --
+                         << bsl::endl                                    // --
+                         << bsl::here();                                 // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return virt;
+    }
+
     /// <!-- description -->
     ///   @brief Given an input register, returns an msr index if the provided
     ///     register contains a valid msr index. Otherwise, this function
@@ -1225,6 +1477,107 @@ namespace mk
         return bsl::to_u32_unsafe(reg);
     }
 
+    /// <!-- description -->
+    ///   @brief Given an input register, returns a fast path rule kind if
+    ///     the provided register contains a valid kind (BF_FAST_PATH_xxx).
+    ///     Otherwise, this function returns bsl::safe_u64::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg the register to get the kind from.
+    ///   @return Given an input register, returns a fast path rule kind if
+    ///     the provided register contains a valid kind (BF_FAST_PATH_xxx).
+    ///     Otherwise, this function returns bsl::safe_u64::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_fast_path_kind(bsl::uint64 const reg) noexcept -> bsl::safe_u64
+    {
+        auto const kind{bsl::to_u64(reg)};
+        if (bsl::unlikely(kind > syscall::BF_FAST_PATH_ADVANCE_IP)) {
+            bsl::error() << "the provided fast path kind "    // --
+                         << bsl::hex(kind)                    // --
+                         << " is not supported"               // --
+                         << bsl::endl                         // --
+                         << bsl::here();                      // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return kind;
+    }
+
+    /// <!-- description -->
+    ///   @brief Given a fast path rule kind and an input register, returns
+    ///     the rule's key if the provided register contains a valid key.
+    ///     MSR rules must name a 32bit MSR that the microkernel does not
+    ///     context switch on VMExits (e.g., EFER, the SYSCALL/SYSENTER MSRs,
+    ///     the segment bases, PAT and DEBUGCTL), as the value in hardware
+    ///     is not the guest's value while the microkernel is executing.
+    ///     "Advance IP" rules must name an exit reason that is caused by
+    ///     an instruction (see vs_t::is_instruction_exit), as events like
+    ///     EPT violations/NPFs, interrupts and NMIs have no instruction
+    ///     to skip. Otherwise, this function returns
+    ///     bsl::safe_u64::failure().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param kind the kind of rule the key belongs to
+    ///   @param reg the register to get the key from.
+    ///   @return Given a fast path rule kind and an input register, returns
+    ///     the rule's key if the provided register contains a valid key.
+    ///     Otherwise, this function returns bsl::safe_u64::failure().
+    ///
+    [[nodiscard]] constexpr auto
+    // NOLINTNEXTLINE(bsl-non-safe-integral-types-are-forbidden)
+    get_fast_path_key(bsl::safe_u64 const &kind, bsl::uint64 const reg) noexcept -> bsl::safe_u64
+    {
+        constexpr auto msr_sysenter_first{0x00000174_u64};
+        constexpr auto msr_sysenter_last{0x00000176_u64};
+        constexpr auto msr_debugctl{0x000001D9_u64};
+        constexpr auto msr_pat{0x00000277_u64};
+        constexpr auto msr_efer_first{0xC0000080_u64};
+        constexpr auto msr_efer_last{0xC0000084_u64};
+        constexpr auto msr_base_first{0xC0000100_u64};
+        constexpr auto msr_base_last{0xC0000102_u64};
+        constexpr auto msr_max{0xFFFFFFFF_u64};
+
+        auto const key{bsl::to_u64(reg)};
+        if (kind == syscall::BF_FAST_PATH_ADVANCE_IP) {
+            if (bsl::unlikely(!vs_t::is_instruction_exit(bsl::to_umx(key)))) {
+                bsl::error() << "the provided exit reason "            // --
+                             << bsl::hex(key)                          // --
+                             << " cannot be skipped by a fast path"    // --
+                             << bsl::endl                              // --
+                             << bsl::here();                           // --
+
+                return bsl::safe_u64::failure();
+            }
+
+            return key;
+        }
+
+        if (kind != syscall::BF_FAST_PATH_RDMSR && kind != syscall::BF_FAST_PATH_WRMSR) {
+            return key;
+        }
+
+        bool mut_denied{key > msr_max};
+        mut_denied = mut_denied || (key >= msr_sysenter_first && key <= msr_sysenter_last);
+        mut_denied = mut_denied || (key == msr_debugctl) || (key == msr_pat);
+        mut_denied = mut_denied || (key >= msr_efer_first && key <= msr_efer_last);
+        mut_denied = mut_denied || (key >= msr_base_first && key <= msr_base_last);
+
+        if (bsl::unlikely(mut_denied)) {
+            bsl::error() << "the provided msr "                        // --
+                         << bsl::hex(key)                              // --
+                         << " cannot be passed through a fast path"    // --
+                         << bsl::endl                                  // --
+                         << bsl::here();                               // --
+
+            return bsl::safe_u64::failure();
+        }
+
+        return key;
+    }
+
     /// ------------------------------------------------------------------------
     /// Report Unsupported Functions
     /// ------------------------------------------------------------------------
@@ -270,6 +270,19 @@ namespace mk
 
             this->get_ext(extid)->dump(tls);
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the locks owned by each
+        ///     extension. The header of the table must already be outputted
+        ///     (see basic_lock_stats_t::dump_header()).
+        ///
+        constexpr void
+        dump_locks() const noexcept
+        {
+            for (auto const &ext : m_pool) {
+                ext.dump_locks();
+            }
+        }
     };
 }
 
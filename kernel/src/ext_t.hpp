@@ -35,14 +35,19 @@
 #include <bfelf/elf64_phdr_t.hpp>
 #include <call_ext.hpp>
 #include <ext_tcb_t.hpp>
+#include <fast_path_t.hpp>
+#include <huge_free_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
+#include <lock_guard_t.hpp>
 #include <map_page_flags.hpp>
 #include <mk_args_t.hpp>
 #include <page_4k_t.hpp>
 #include <page_aligned_bytes_t.hpp>
 #include <page_pool_t.hpp>
 #include <root_page_table_t.hpp>
+#include <spinlock_t.hpp>
+#include <tlb_shootdown_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/array.hpp>
@@ -125,6 +130,8 @@ namespace mk
         root_page_table_t m_main_rpt{};
         /// @brief stores the direct map rpts
         bsl::array<root_page_table_t, HYPERVISOR_MAX_VMS.get()> m_direct_map_rpts{};
+        /// @brief stores the TLB shootdown state of each direct map rpt
+        bsl::array<tlb_shootdown_t, HYPERVISOR_MAX_VMS.get()> m_direct_map_shootdowns{};
 
         /// @brief stores the main IP registered by the extension
         bsl::safe_u64 m_entry_ip{};
@@ -134,11 +141,19 @@ namespace mk
         bsl::safe_u64 m_vmexit_ip{};
         /// @brief stores the fail IP registered by the extension
         bsl::safe_u64 m_fail_ip{};
+        /// @brief stores the fast path rules registered on each PP
+        bsl::array<fast_path_t, HYPERVISOR_MAX_PPS.get()> m_fast_paths{};
 
-        /// @brief stores the direct map rpts
+        /// @brief safe guards m_huge_allocs and m_huge_frees
+        spinlock_t m_huge_lock{};
+        /// @brief stores the huge allocations owned by the extension
         bsl::array<bsl::span<page_4k_t>, HYPERVISOR_MAX_HUGE_ALLOCS.get()> m_huge_allocs{};
         /// @brief stores the index into m_huge_allocs
         bsl::safe_idx m_huge_allocs_idx{};
+        /// @brief stores the freed huge allocations that are not yet acked
+        bsl::array<huge_free_t, HYPERVISOR_MAX_HUGE_ALLOCS.get()> m_huge_frees{};
+        /// @brief stores the index into m_huge_frees
+        bsl::safe_idx m_huge_frees_idx{};
 
         /// <!-- description -->
         ///   @brief Returns the program header table
@@ -926,6 +941,52 @@ namespace mk
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the virtual address the extension uses to
+        ///     access the provided huge allocation.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param huge_pool the huge_pool_t the allocation came from
+        ///   @param huge the huge allocation to get the address of
+        ///   @return Returns the virtual address the extension uses to
+        ///     access the provided huge allocation.
+        ///
+        [[nodiscard]] static constexpr auto
+        huge_to_virt(huge_pool_t const &huge_pool, bsl::span<page_4k_t> const &huge) noexcept
+            -> bsl::safe_u64
+        {
+            auto const huge_phys{huge_pool.virt_to_phys(huge.data())};
+            bsl::expects(huge_phys.is_valid_and_checked());
+            bsl::expects(huge_phys.is_pos());
+
+            auto const huge_virt{(HYPERVISOR_EXT_HUGE_POOL_ADDR + huge_phys).checked()};
+            bsl::expects(huge_virt.is_valid_and_checked());
+            bsl::expects(huge_virt.is_pos());
+
+            return huge_virt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps the first "pages" pages of a huge allocation
+        ///     from the main RPT. It is the caller's responsibility to
+        ///     update the direct map RPTs and to flush the TLB.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param huge_virt the virtual address of the huge allocation
+        ///   @param pages the total number of pages to unmap
+        ///
+        constexpr void
+        unmap_huge(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            bsl::safe_u64 const &huge_virt,
+            bsl::safe_umx const &pages) noexcept
+        {
+            bsl::discard(m_main_rpt.unmap_range(mut_tls, mut_page_pool, huge_virt, pages));
+        }
+
         /// <!-- description -->
         ///   @brief Makes sure that all m_main_rpt aliases are updated
         ///     in all of the direct maps. This ensures that any allocations
@@ -946,6 +1007,50 @@ namespace mk
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Gives every freed huge allocation that no PP can still
+        ///     have a stale translation for back to the huge pool. The
+        ///     caller must hold m_huge_lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_huge_pool the huge_pool_t to use
+        ///
+        constexpr void
+        drain_huge_frees(tls_t const &tls, huge_pool_t &mut_huge_pool) noexcept
+        {
+            bsl::safe_idx mut_i{};
+            while (mut_i < m_huge_frees_idx) {
+                auto *const pmut_free{m_huge_frees.at_if(mut_i)};
+
+                bool mut_acked{true};
+                for (bsl::safe_idx mut_j{}; mut_j < pmut_free->gens.size(); ++mut_j) {
+                    auto const gen{*pmut_free->gens.at_if(mut_j)};
+                    if (gen.is_zero()) {
+                        continue;
+                    }
+
+                    if (!m_direct_map_shootdowns.at_if(mut_j)->is_acked(tls, gen)) {
+                        mut_acked = false;
+                        break;
+                    }
+
+                    bsl::touch();
+                }
+
+                if (!mut_acked) {
+                    ++mut_i;
+                    continue;
+                }
+
+                mut_huge_pool.deallocate(tls, pmut_free->huge);
+
+                --m_huge_frees_idx;
+                *pmut_free = *m_huge_frees.at_if(m_huge_frees_idx);
+                *m_huge_frees.at_if(m_huge_frees_idx) = {};
+            }
+        }
+
         /// <!-- description -->
         ///   @brief Executes the extension given an instruction pointer to
         ///     execute the extension at, a stack pointer to execute the
@@ -975,11 +1080,14 @@ namespace mk
             bsl::expects(arg0.is_valid_and_checked());
             bsl::expects(arg1.is_valid_and_checked());
 
-            auto *const pmut_rpt{m_direct_map_rpts.at_if(bsl::to_idx(mut_tls.active_vmid))};
+            auto const idx{bsl::to_idx(mut_tls.active_vmid)};
+            auto *const pmut_rpt{m_direct_map_rpts.at_if(idx)};
             bsl::expects(nullptr != pmut_rpt);
+            auto *const pmut_shootdown{m_direct_map_shootdowns.at_if(idx)};
+            bsl::expects(nullptr != pmut_shootdown);
 
             if (pmut_rpt->is_inactive(mut_tls)) {
-                pmut_rpt->activate(mut_tls, mut_intrinsic);
+                pmut_shootdown->activate(mut_tls, mut_intrinsic, *pmut_rpt);
             }
             else {
                 bsl::touch();
@@ -993,11 +1101,19 @@ namespace mk
                 bsl::touch();
             }
 
+            auto mut_sp{mut_tls.sp};
             if (ip == m_fail_ip) {
-                return call_ext(ip.get(), mut_tls.ext_fail_sp, arg0.get(), arg1.get());
+                mut_sp = mut_tls.ext_fail_sp;
+            }
+            else {
+                bsl::touch();
             }
 
-            return call_ext(ip.get(), mut_tls.sp, arg0.get(), arg1.get());
+            pmut_shootdown->enter(mut_tls, mut_intrinsic, *pmut_rpt);
+            auto const ret{call_ext(ip.get(), mut_sp, arg0.get(), arg1.get())};
+            pmut_shootdown->leave(mut_tls);
+
+            return ret;
         }
 
     public:
@@ -1054,16 +1170,9 @@ namespace mk
         {
             for (bsl::safe_idx mut_i; mut_i < m_huge_allocs_idx; ++mut_i) {
                 auto *const pmut_huge{m_huge_allocs.at_if(mut_i)};
+                auto const huge_virt{huge_to_virt(mut_huge_pool, *pmut_huge)};
 
-                auto const huge_phys{mut_huge_pool.virt_to_phys(pmut_huge->data())};
-                bsl::expects(huge_phys.is_valid_and_checked());
-                bsl::expects(huge_phys.is_pos());
-
-                auto const huge_virt{(HYPERVISOR_EXT_HUGE_POOL_ADDR + huge_phys).checked()};
-                bsl::expects(huge_virt.is_valid_and_checked());
-                bsl::expects(huge_virt.is_pos());
-
-                bsl::discard(m_main_rpt.unmap(mut_tls, mut_page_pool, huge_virt));
+                this->unmap_huge(mut_tls, mut_page_pool, huge_virt, pmut_huge->size());
                 mut_huge_pool.deallocate(mut_tls, *pmut_huge);
             }
 
@@ -1072,6 +1181,25 @@ namespace mk
                 mut_elem = {};
             }
 
+            /// NOTE:
+            /// - Freed huge allocations were already unmapped by
+            ///   free_huge(), and the extension is no longer executing on
+            ///   any PP, so they can be given back right away.
+            ///
+
+            for (bsl::safe_idx mut_i; mut_i < m_huge_frees_idx; ++mut_i) {
+                mut_huge_pool.deallocate(mut_tls, m_huge_frees.at_if(mut_i)->huge);
+            }
+
+            m_huge_frees_idx = {};
+            for (auto &mut_elem : m_huge_frees) {
+                mut_elem = {};
+            }
+
+            for (auto &mut_fast_path : m_fast_paths) {
+                mut_fast_path.clear();
+            }
+
             m_fail_ip = {};
             m_vmexit_ip = {};
             m_bootstrap_ip = {};
@@ -1195,6 +1323,53 @@ namespace mk
             m_fail_ip = ip;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the fast path rules this extension registered
+        ///     on the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the fast path rules this extension registered
+        ///     on the current PP.
+        ///
+        [[nodiscard]] constexpr auto
+        fast_path(tls_t const &tls) const noexcept -> fast_path_t const &
+        {
+            auto const *const pfast_path{m_fast_paths.at_if(bsl::to_idx(tls.ppid))};
+            bsl::expects(nullptr != pfast_path);
+
+            return *pfast_path;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a fast path rule for the current PP. This should
+        ///     be called by the syscall dispatcher as the result of a
+        ///     syscall from the extension defining which VMExits the
+        ///     microkernel can handle on its behalf.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param kind the kind of rule to add (BF_FAST_PATH_xxx)
+        ///   @param key the CPUID leaf/subleaf, MSR or exit reason to match
+        ///   @param val0 the first value associated with the rule
+        ///   @param val1 the second value associated with the rule
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        add_fast_path(
+            tls_t const &tls,
+            bsl::safe_u64 const &kind,
+            bsl::safe_u64 const &key,
+            bsl::safe_u64 const &val0,
+            bsl::safe_u64 const &val1) noexcept -> bsl::errc_type
+        {
+            auto *const pmut_fast_path{m_fast_paths.at_if(bsl::to_idx(tls.ppid))};
+            bsl::expects(nullptr != pmut_fast_path);
+
+            return pmut_fast_path->add(kind, key, val0, val1);
+        }
+
         /// <!-- description -->
         ///   @brief Opens a handle and returns the resulting handle
         ///
@@ -1277,6 +1452,30 @@ namespace mk
             return m_is_executing_fail;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided page is mapped into this
+        ///     extension's main RPT, meaning it is a page that was given to
+        ///     this extension and not some other part of the address space.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address of the page to check
+        ///   @return Returns true if the provided page is mapped into this
+        ///     extension's main RPT, false otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        is_page_owned(
+            tls_t const &tls, page_pool_t &mut_page_pool, bsl::safe_u64 const &page_virt) noexcept
+            -> bool
+        {
+            bsl::expects(page_virt.is_valid_and_checked());
+            bsl::expects(page_virt.is_pos());
+
+            auto const ents{m_main_rpt.entries(tls, mut_page_pool, page_virt)};
+            return nullptr != ents.l0e;
+        }
+
         /// <!-- description -->
         ///   @brief Allocates a page and maps it into the extension's
         ///     address space.
@@ -1324,7 +1523,18 @@ namespace mk
             bsl::expects(size.is_valid_and_checked());
             bsl::expects(size.is_pos());
 
-            if (bsl::unlikely(m_huge_allocs_idx >= HYPERVISOR_MAX_HUGE_ALLOCS)) {
+            lock_guard_t mut_lock{mut_tls, m_huge_lock};
+            this->drain_huge_frees(mut_tls, mut_huge_pool);
+
+            /// NOTE:
+            /// - Every huge allocation that is freed but not yet acked
+            ///   still holds a slot, which guarantees that free_huge()
+            ///   always has room in m_huge_frees.
+            ///
+
+            auto const allocs{bsl::to_umx(m_huge_allocs_idx.get())};
+            auto const used{(allocs + bsl::to_umx(m_huge_frees_idx.get())).checked()};
+            if (bsl::unlikely(used >= HYPERVISOR_MAX_HUGE_ALLOCS)) {
                 bsl::error() << "ext out of huge allocation slots\n" << bsl::endl;
                 return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
             }
@@ -1341,58 +1551,164 @@ namespace mk
                 return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
             }
 
-            /// TODO:
-            /// - We really should register the allocation at the end of this
-            ///   function, and on failure, we would just call free_huge()
-            ///   so that all of the memory can be unmapped and deallocated
-            ///   there. By registering here, if the map() below fails, we
-            ///   are not leaking memory, but the allocation is lost and can
-            ///   never be used again.
-            ///
-            /// - For now this works because if the allocation fails, there
-            ///   likely is no way to recover anyways as this is such a
-            ///   limited resource, but if free_huge() is ever implemented,
-            ///   this should be changed to "undo" what was done here so
-            ///   that the huge allocation can be used in the future.
+            auto const huge_phys{mut_huge_pool.virt_to_phys(mut_huge.data())};
+            auto const huge_virt{huge_to_virt(mut_huge_pool, mut_huge)};
+
+            /// NOTE:
+            /// - The huge pool is physically contiguous, and the virtual
+            ///   address of an allocation is its physical address plus
+            ///   HYPERVISOR_EXT_HUGE_POOL_ADDR, which means that
+            ///   map_range() is able to use 2m (or 1g) pages for any part
+            ///   of a large enough allocation that is suitably aligned.
             ///
 
+            auto const ret{m_main_rpt.map_range(
+                mut_tls, mut_page_pool, huge_virt, huge_phys, mut_pages, MAP_PAGE_RW, true)};
+
+            if (bsl::unlikely(!ret.ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+
+                /// NOTE:
+                /// - The extension has not been given the address of this
+                ///   allocation yet, so nothing could have used it, and it
+                ///   can be given back right away.
+                ///
+
+                this->unmap_huge(mut_tls, mut_page_pool, huge_virt, ret.pages);
+                mut_huge_pool.deallocate(mut_tls, mut_huge);
+
+                return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
+            }
+
             *m_huge_allocs.at_if(m_huge_allocs_idx) = mut_huge;
             ++m_huge_allocs_idx;
 
-            auto const huge_phys{mut_huge_pool.virt_to_phys(mut_huge.data())};
-            bsl::expects(huge_phys.is_valid_and_checked());
-            bsl::expects(huge_phys.is_pos());
+            this->update_direct_map_rpts(mut_tls);
+            return {huge_virt, huge_phys};
+        }
 
-            auto const huge_virt{(HYPERVISOR_EXT_HUGE_POOL_ADDR + huge_phys).checked()};
+        /// <!-- description -->
+        ///   @brief Frees a huge allocation that was previously allocated
+        ///     using alloc_huge(). The allocation is unmapped from the
+        ///     extension's address space and a full TLB flush is queued
+        ///     on every direct map. The allocation is only given back to
+        ///     the huge pool once every other PP that was executing this
+        ///     extension has acknowledged that flush. If one of them does
+        ///     not do so in time, the allocation stays on a deferred list
+        ///     and is given back by a later call to alloc_huge() or
+        ///     free_huge() instead. Either way, the memory is never reused
+        ///     while a PP might still have a stale translation for it.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param mut_huge_pool the huge_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param huge_virt the virtual address returned by alloc_huge()
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        free_huge(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            huge_pool_t &mut_huge_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &huge_virt) noexcept -> bsl::errc_type
+        {
             bsl::expects(huge_virt.is_valid_and_checked());
             bsl::expects(huge_virt.is_pos());
 
+            bsl::array<bsl::safe_u64, HYPERVISOR_MAX_VMS.get()> mut_gens{};
+
+            {
+                lock_guard_t mut_lock{mut_tls, m_huge_lock};
+                this->drain_huge_frees(mut_tls, mut_huge_pool);
+
+                bsl::safe_idx mut_idx{};
+                for (; mut_idx < m_huge_allocs_idx; ++mut_idx) {
+                    if (huge_to_virt(mut_huge_pool, *m_huge_allocs.at_if(mut_idx)) == huge_virt) {
+                        break;
+                    }
+
+                    bsl::touch();
+                }
+
+                if (bsl::unlikely(mut_idx >= m_huge_allocs_idx)) {
+                    bsl::error() << "huge allocation "                  // --
+                                 << bsl::hex(huge_virt)                  // --
+                                 << " is not owned by this extension"    // --
+                                 << bsl::endl                            // --
+                                 << bsl::here();                         // --
+
+                    return bsl::errc_failure;
+                }
+
+                auto const huge{*m_huge_allocs.at_if(mut_idx)};
+                this->unmap_huge(mut_tls, mut_page_pool, huge_virt, huge.size());
+
+                /// NOTE:
+                /// - The direct maps alias the main RPT's top level entries,
+                ///   so they have to be updated in case unmap() released one
+                ///   of the tables they point to.
+                ///
+
+                this->update_direct_map_rpts(mut_tls);
+
+                for (bsl::safe_idx mut_i{}; mut_i < huge.size(); ++mut_i) {
+                    auto const offs{(bsl::to_u64(mut_i) * HYPERVISOR_PAGE_SIZE).checked()};
+                    intrinsic.tlb_flush((huge_virt + offs).checked());
+                }
+
+                /// NOTE:
+                /// - A huge allocation can span far more pages than a
+                ///   tlb_shootdown_t can queue, so the other PPs are asked
+                ///   to flush their whole TLB once instead.
+                ///
+
+                for (bsl::safe_idx mut_j{}; mut_j < m_direct_map_rpts.size(); ++mut_j) {
+                    if (!m_direct_map_rpts.at_if(mut_j)->is_initialized()) {
+                        continue;
+                    }
+
+                    auto *const pmut_shootdown{m_direct_map_shootdowns.at_if(mut_j)};
+                    *mut_gens.at_if(mut_j) = pmut_shootdown->queue_flush_all(mut_tls);
+                }
+
+                *m_huge_frees.at_if(m_huge_frees_idx) = {huge, mut_gens};
+                ++m_huge_frees_idx;
+
+                --m_huge_allocs_idx;
+                *m_huge_allocs.at_if(mut_idx) = *m_huge_allocs.at_if(m_huge_allocs_idx);
+                *m_huge_allocs.at_if(m_huge_allocs_idx) = {};
+            }
+
             /// NOTE:
-            /// - Huge allocations come from the kernel's direct map, which
-            ///   is the same size as the extension's direct map, something
-            ///   that is validated by CMake. As a result, the virtual and
-            ///   physical addresses below can never overflow which is why
-            ///   they are marked as checked().
+            /// - m_huge_lock is not held while waiting. The PPs being
+            ///   waited on might need it to make progress, and the
+            ///   allocation is already on m_huge_frees, so nothing else
+            ///   can hand it out in the meantime.
             ///
 
-            constexpr auto inc{bsl::to_idx(HYPERVISOR_PAGE_SIZE)};
-            for (bsl::safe_idx mut_i{}; mut_i < mut_bytes; mut_i += inc) {
-                auto const page_virt{(huge_virt + bsl::to_u64(mut_i)).checked()};
-                auto const page_phys{(huge_phys + bsl::to_u64(mut_i)).checked()};
-
-                auto const ret{m_main_rpt.map(
-                    mut_tls, mut_page_pool, page_virt, page_phys, MAP_PAGE_RW, true)};
+            for (bsl::safe_idx mut_j{}; mut_j < mut_gens.size(); ++mut_j) {
+                auto const gen{*mut_gens.at_if(mut_j)};
+                if (gen.is_zero()) {
+                    continue;
+                }
 
+                auto const ret{m_direct_map_shootdowns.at_if(mut_j)->wait(mut_tls, gen)};
                 if (bsl::unlikely(!ret)) {
                     bsl::print<bsl::V>() << bsl::here();
-                    return {bsl::safe_u64::failure(), bsl::safe_u64::failure()};
+                    return bsl::errc_success;
                 }
 
                 bsl::touch();
             }
 
-            this->update_direct_map_rpts(mut_tls);
-            return {huge_virt, huge_phys};
+            lock_guard_t mut_lock{mut_tls, m_huge_lock};
+            this->drain_huge_frees(mut_tls, mut_huge_pool);
+
+            return bsl::errc_success;
         }
 
         /// <!-- description -->
@@ -1489,6 +1805,115 @@ namespace mk
             return ret;
         }
 
+        /// <!-- description -->
+        ///   @brief Unmaps a page from the direct map portion of the requested
+        ///     VM's direct map RPT given a virtual address to unmap, and
+        ///     removes it from the TLB of every PP. On success, every other
+        ///     PP that is executing this extension with the same direct map
+        ///     active has invalidated the page, and all other PPs will
+        ///     invalidate it (along with any other page that was unmapped
+        ///     since) before they execute this extension using this direct
+        ///     map again. If one of those PPs does not invalidate the page
+        ///     in time, tlb_shootdown_timeout is returned, and that PP might
+        ///     still be using the page until it does. The page stays
+        ///     unmapped, and calling this function again with the same
+        ///     address waits for that PP again.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param vmid the ID of the VM to unmap page_virt from
+        ///   @param page_virt the virtual address to unmap
+        ///   @return Returns bsl::errc_success on success,
+        ///     tlb_shootdown_timeout if the call can be retried, and
+        ///     bsl::errc_failure and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_page_direct_broadcast(
+            tls_t &mut_tls,
+            page_pool_t &mut_page_pool,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u16 const &vmid,
+            bsl::safe_u64 const &page_virt) noexcept -> bsl::errc_type
+        {
+            auto *const pmut_direct_map_rpt{m_direct_map_rpts.at_if(bsl::to_idx(vmid))};
+            bsl::expects(nullptr != pmut_direct_map_rpt);
+
+            /// NOTE:
+            /// - If a previous call timed out, the page is already
+            ///   unmapped, and only the shootdown needs to be redone.
+            ///
+
+            auto const ents{pmut_direct_map_rpt->entries(mut_tls, mut_page_pool, page_virt)};
+            if (nullptr != ents.l0e) {
+                auto const ret{
+                    this->unmap_page_direct(mut_tls, mut_page_pool, intrinsic, vmid, page_virt)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+            else {
+                intrinsic.tlb_flush(page_virt);
+            }
+
+            auto *const pmut_shootdown{m_direct_map_shootdowns.at_if(bsl::to_idx(vmid))};
+            bsl::expects(nullptr != pmut_shootdown);
+
+            auto const gen{pmut_shootdown->queue(mut_tls, page_virt)};
+            auto const ret{pmut_shootdown->wait(mut_tls, gen)};
+            if (bsl::unlikely(!ret)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return ret;
+            }
+
+            return ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the extension that the current PP is about to
+        ///     return to it from a syscall. Any page that another PP
+        ///     unmapped from the active direct map using
+        ///     unmap_page_direct_broadcast() is invalidated first. If no
+        ///     VM is active, this function does nothing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        enter_direct_map(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            auto const idx{bsl::to_idx(mut_tls.active_vmid)};
+            auto *const pmut_rpt{m_direct_map_rpts.at_if(idx)};
+            if (bsl::unlikely(nullptr == pmut_rpt)) {
+                return;
+            }
+
+            m_direct_map_shootdowns.at_if(idx)->enter(mut_tls, mut_intrinsic, *pmut_rpt);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the extension that the current PP has stopped
+        ///     executing it because of a syscall.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        leave_direct_map(tls_t const &tls) noexcept
+        {
+            auto *const pmut_shootdown{m_direct_map_shootdowns.at_if(bsl::to_idx(tls.active_vmid))};
+            if (bsl::unlikely(nullptr == pmut_shootdown)) {
+                return;
+            }
+
+            pmut_shootdown->leave(tls);
+        }
+
         /// <!-- description -->
         ///   @brief Tells the extension that a VM was created so that it
         ///     can initialize it's VM specific resources.
@@ -1554,10 +1979,11 @@ namespace mk
             bsl::expects(vmid.is_valid_and_checked());
             bsl::expects(bsl::to_umx(mut_tls.active_vmid) < m_direct_map_rpts.size());
 
-            auto *const pmut_rpt{m_direct_map_rpts.at_if(bsl::to_idx(mut_tls.active_vmid))};
+            auto const idx{bsl::to_idx(mut_tls.active_vmid)};
+            auto *const pmut_rpt{m_direct_map_rpts.at_if(idx)};
             bsl::expects(nullptr != pmut_rpt);
 
-            pmut_rpt->activate(mut_tls, mut_intrinsic);
+            m_direct_map_shootdowns.at_if(idx)->activate(mut_tls, mut_intrinsic, *pmut_rpt);
         }
 
         /// <!-- description -->
@@ -1824,6 +2250,20 @@ namespace mk
             bsl::print() << bsl::ylw << "+------------------------------------+";
             bsl::print() << bsl::rst << bsl::endl;
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the locks owned by the
+        ///     ext_t's root page tables. The header of the table must
+        ///     already be outputted (see basic_lock_stats_t::dump_header()).
+        ///
+        constexpr void
+        dump_locks() const noexcept
+        {
+            m_main_rpt.lock_stats().dump("ext main rpt");
+            for (auto const &rpt : m_direct_map_rpts) {
+                rpt.lock_stats().dump("ext direct map");
+            }
+        }
     };
 }
 
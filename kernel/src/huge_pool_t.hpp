@@ -25,39 +25,83 @@
 #ifndef HUGE_POOL_T_HPP
 #define HUGE_POOL_T_HPP
 
+#include <huge_pool_node_t.hpp>
 #include <lock_guard_t.hpp>
 #include <page_4k_t.hpp>
 #include <spinlock_t.hpp>
 #include <tls_t.hpp>
 
+#include <bsl/array.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstring.hpp>
 #include <bsl/debug.hpp>
-#include <bsl/discard.hpp>
 #include <bsl/ensures.hpp>
 #include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
 {
+    /// <!-- description -->
+    ///   @brief Returns the smallest block order (i.e., the log2 of the
+    ///     number of pages in a block) that can hold the provided number
+    ///     of pages.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pages the number of pages the block must be able to hold
+    ///   @return Returns the smallest block order that can hold "pages"
+    ///
+    [[nodiscard]] constexpr auto
+    huge_pool_order(bsl::safe_umx const &pages) noexcept -> bsl::safe_umx
+    {
+        bsl::expects(pages.is_valid_and_checked());
+        bsl::expects(pages <= HUGE_POOL_MAX_PAGES);
+
+        auto mut_order{bsl::safe_umx::magic_0()};
+        auto mut_size{bsl::safe_umx::magic_1()};
+
+        while (mut_size < pages) {
+            mut_size += mut_size;
+            ++mut_order;
+        }
+
+        return mut_order.checked();
+    }
+
+    /// @brief defines the total number of block orders the huge pool supports
+    constexpr auto HUGE_POOL_MAX_ORDERS{
+        (huge_pool_order(HUGE_POOL_MAX_PAGES) + bsl::safe_umx::magic_1()).checked()};
+
     /// <!-- description -->
     ///   @brief The huge pool provides access to physically contiguous
     ///     memory. The amount of memory that is available is really, really
     ///     small (likely no more than 1 MB), but some is needed for different
     ///     architectures that require it like AMD. This memory is only needed
-    ///     by the extensions, and we currently do not support the ability
-    ///     to free memory, so there is no need to over complicate how this
-    ///     allocator works. We simply use a cursor that is always increasing.
-    ///     Once you allocate all of the memory, that is it.
+    ///     by the extensions. The pool is managed using a buddy allocator so
+    ///     that memory can be returned (using bf_mem_op_free_huge, or when
+    ///     an extension is released) and reused. Allocations are rounded up
+    ///     to a page and not to a power of two. The unused tail of a block
+    ///     is given back to the free lists when it is allocated, and an
+    ///     allocation is returned as the naturally aligned blocks that make
+    ///     it up. Both allocating and deallocating are O(log n), and all of
+    ///     the bookkeeping is stored outside of the pool so that the memory
+    ///     that is handed out remains contiguous.
     ///
     class huge_pool_t final
     {
         /// @brief stores the range of memory used by this allocator
         bsl::span<page_4k_t> m_pool{};
-        /// @brief stores the huge pool's cursor
-        bsl::safe_umx m_crsr{};
+        /// @brief stores the bookkeeping for each page in the pool
+        bsl::array<huge_pool_node_t, HUGE_POOL_MAX_PAGES.get()> m_nodes{};
+        /// @brief stores the head of the free list for each order
+        bsl::array<bsl::safe_umx, HUGE_POOL_MAX_ORDERS.get()> m_heads{};
+        /// @brief stores the number of free blocks for each order
+        bsl::array<bsl::safe_umx, HUGE_POOL_MAX_ORDERS.get()> m_free_blocks{};
+        /// @brief stores the total number of pages that are allocated
+        bsl::safe_umx m_used{};
         /// @brief safe guards operations on the pool.
         mutable spinlock_t m_lock{};
 
@@ -100,6 +144,198 @@ namespace mk
             return virt;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the number of pages in a block of the provided
+        ///     order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param order the order of the block
+        ///   @return Returns the number of pages in a block of "order"
+        ///
+        [[nodiscard]] static constexpr auto
+        order_to_pages(bsl::safe_umx const &order) noexcept -> bsl::safe_umx
+        {
+            bsl::expects(order < HUGE_POOL_MAX_ORDERS);
+            return (bsl::safe_umx::magic_1() << order).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the node associated with the provided page index.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the page to get the node for
+        ///   @return Returns the node associated with the provided page index.
+        ///
+        [[nodiscard]] constexpr auto
+        node(bsl::safe_umx const &idx) noexcept -> huge_pool_node_t *
+        {
+            auto *const pmut_node{m_nodes.at_if(bsl::to_idx(idx))};
+            bsl::ensures(nullptr != pmut_node);
+
+            return pmut_node;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds the block that starts at "idx" to the free list
+        ///     for the provided order.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the first page in the block
+        ///   @param order the order of the block
+        ///
+        constexpr void
+        push(bsl::safe_umx const &idx, bsl::safe_umx const &order) noexcept
+        {
+            auto *const pmut_head{m_heads.at_if(bsl::to_idx(order))};
+            auto *const pmut_count{m_free_blocks.at_if(bsl::to_idx(order))};
+            bsl::expects(nullptr != pmut_head);
+            bsl::expects(nullptr != pmut_count);
+
+            auto *const pmut_node{this->node(idx)};
+            pmut_node->next = *pmut_head;
+            pmut_node->prev = HUGE_POOL_INVALID_NODE;
+            pmut_node->order = order;
+            pmut_node->requested = {};
+            pmut_node->free = true;
+
+            if (HUGE_POOL_INVALID_NODE != *pmut_head) {
+                this->node(*pmut_head)->prev = idx;
+            }
+            else {
+                bsl::touch();
+            }
+
+            *pmut_head = idx;
+            ++*pmut_count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the free block that starts at "idx" from the
+        ///     free list that it is currently on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the first page in the block
+        ///
+        constexpr void
+        remove(bsl::safe_umx const &idx) noexcept
+        {
+            auto *const pmut_node{this->node(idx)};
+            bsl::expects(pmut_node->free);
+
+            auto *const pmut_head{m_heads.at_if(bsl::to_idx(pmut_node->order))};
+            auto *const pmut_count{m_free_blocks.at_if(bsl::to_idx(pmut_node->order))};
+            bsl::expects(nullptr != pmut_head);
+            bsl::expects(nullptr != pmut_count);
+
+            if (HUGE_POOL_INVALID_NODE != pmut_node->prev) {
+                this->node(pmut_node->prev)->next = pmut_node->next;
+            }
+            else {
+                *pmut_head = pmut_node->next;
+            }
+
+            if (HUGE_POOL_INVALID_NODE != pmut_node->next) {
+                this->node(pmut_node->next)->prev = pmut_node->prev;
+            }
+            else {
+                bsl::touch();
+            }
+
+            pmut_node->next = HUGE_POOL_INVALID_NODE;
+            pmut_node->prev = HUGE_POOL_INVALID_NODE;
+            pmut_node->free = false;
+
+            --*pmut_count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the block that starts at "idx" to the free
+        ///     lists. The block is merged with its buddy for as long as its
+        ///     buddy is also free.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the first page in the block
+        ///   @param order the order of the block
+        ///
+        constexpr void
+        free_block(bsl::safe_umx const &idx, bsl::safe_umx const &order) noexcept
+        {
+            auto mut_idx{idx};
+            auto mut_order{order};
+
+            while ((mut_order + bsl::safe_umx::magic_1()).checked() < HUGE_POOL_MAX_ORDERS) {
+                auto const pages{order_to_pages(mut_order)};
+
+                bsl::safe_umx mut_buddy{};
+                if (((mut_idx / pages) % 2_umx).is_zero()) {
+                    mut_buddy = (mut_idx + pages).checked();
+                }
+                else {
+                    mut_buddy = (mut_idx - pages).checked();
+                }
+
+                if ((mut_buddy + pages).checked() > m_pool.size()) {
+                    break;
+                }
+
+                auto const *const buddy{this->node(mut_buddy)};
+                if ((!buddy->free) || (buddy->order != mut_order)) {
+                    break;
+                }
+
+                this->remove(mut_buddy);
+                if (mut_buddy < mut_idx) {
+                    mut_idx = mut_buddy;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                ++mut_order;
+            }
+
+            this->push(mut_idx, mut_order);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns "pages" pages starting at "idx" to the free
+        ///     lists. The range is broken up into the largest, naturally
+        ///     aligned blocks possible, and each block is then freed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the first page in the range
+        ///   @param pages the number of pages in the range
+        ///
+        constexpr void
+        free_range(bsl::safe_umx const &idx, bsl::safe_umx const &pages) noexcept
+        {
+            auto const end{(idx + pages).checked()};
+            bsl::expects(end <= m_pool.size());
+
+            auto mut_idx{idx};
+            while (mut_idx < end) {
+                auto mut_order{(HUGE_POOL_MAX_ORDERS - bsl::safe_umx::magic_1()).checked()};
+                while (mut_order.is_pos()) {
+                    auto const block{order_to_pages(mut_order)};
+                    if ((mut_idx % block).is_zero()) {
+                        if ((mut_idx + block).checked() <= end) {
+                            break;
+                        }
+
+                        bsl::touch();
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    --mut_order;
+                }
+
+                this->free_block(mut_idx, mut_order);
+                mut_idx = (mut_idx + order_to_pages(mut_order)).checked();
+            }
+        }
+
         /// <!-- description -->
         ///   @brief Returns the number of bytes allocated.
         ///
@@ -114,7 +350,7 @@ namespace mk
             ///   function ensures this math will never overflow.
             ///
 
-            return (m_crsr * HYPERVISOR_PAGE_SIZE).checked();
+            return (m_used * HYPERVISOR_PAGE_SIZE).checked();
         }
 
         /// <!-- description -->
@@ -134,11 +370,36 @@ namespace mk
             return (this->size() - this->allocated()).checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes in the largest free block.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes in the largest free block.
+        ///
+        [[nodiscard]] constexpr auto
+        largest() const noexcept -> bsl::safe_umx
+        {
+            auto mut_order{HUGE_POOL_MAX_ORDERS};
+            while (mut_order.is_pos()) {
+                --mut_order;
+                if (m_free_blocks.at_if(bsl::to_idx(mut_order))->is_pos()) {
+                    return (order_to_pages(mut_order) * HYPERVISOR_PAGE_SIZE).checked();
+                }
+
+                bsl::touch();
+            }
+
+            return {};
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Creates the huge pool given a mutable_buffer_t to
         ///     the huge pool as well as the virtual address base of the
         ///     huge pool which is used for virt to phys translations.
+        ///     The pool is carved up into the largest, naturally aligned
+        ///     blocks possible. Any pages beyond HUGE_POOL_MAX_PAGES are
+        ///     ignored as there is no bookkeeping for them.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_pool the mutable_buffer_t of the huge pool
@@ -147,11 +408,25 @@ namespace mk
         initialize(bsl::span<page_4k_t> &mut_pool) noexcept
         {
             bsl::expects(mut_pool.is_valid());
-            m_pool = mut_pool;
+            m_pool = mut_pool.subspan({}, HUGE_POOL_MAX_PAGES);
+
+            m_nodes = {};
+            m_free_blocks = {};
+            m_used = {};
+
+            for (auto &mut_head : m_heads) {
+                mut_head = HUGE_POOL_INVALID_NODE;
+            }
+
+            this->free_range({}, m_pool.size());
         }
 
         /// <!-- description -->
-        ///   @brief Allocates memory from the huge pool.
+        ///   @brief Allocates memory from the huge pool. The smallest free
+        ///     block that can hold the requested number of pages is split
+        ///     in half until it is no larger than it needs to be, and then
+        ///     any pages at the end of the block that were not asked for
+        ///     are returned to the free lists.
         ///
         /// <!-- inputs/outputs -->
         ///   @param tls the current TLS block
@@ -166,27 +441,66 @@ namespace mk
             bsl::expects(pages.is_valid_and_checked());
             bsl::expects(pages.is_pos());
 
-            auto mut_buf{m_pool.subspan(bsl::to_idx(m_crsr), pages)};
-            if (bsl::unlikely(mut_buf.size() != pages)) {
+            if (bsl::unlikely(pages > m_pool.size())) {
                 bsl::error() << "huge pool out of memory\n" << bsl::here();
                 return {};
             }
 
+            auto const order{huge_pool_order(pages)};
+
+            auto mut_order{order};
+            while (mut_order < HUGE_POOL_MAX_ORDERS) {
+                if (m_free_blocks.at_if(bsl::to_idx(mut_order))->is_pos()) {
+                    break;
+                }
+
+                ++mut_order;
+            }
+
+            if (bsl::unlikely(HUGE_POOL_MAX_ORDERS == mut_order)) {
+                bsl::error() << "huge pool out of memory\n" << bsl::here();
+                return {};
+            }
+
+            auto const idx{*m_heads.at_if(bsl::to_idx(mut_order))};
+            this->remove(idx);
+
+            /// NOTE:
+            /// - Split the block until it is the correct size. The lower
+            ///   half is kept while the upper half is returned to the free
+            ///   list for the next order down.
+            ///
+
+            while (mut_order > order) {
+                --mut_order;
+                this->push((idx + order_to_pages(mut_order)).checked(), mut_order);
+            }
+
             /// NOTE:
-            /// - It is impossible for the following to overflow because if
-            ///   it did, the span above would fail first, which is why it
-            ///   is marked as checked.
+            /// - Give back the tail of the block. None of it can merge with
+            ///   anything outside of the block as the start of the block
+            ///   is allocated.
             ///
 
-            m_crsr = (m_crsr + pages).checked();
+            this->free_range((idx + pages).checked(), (order_to_pages(order) - pages).checked());
+
+            auto *const pmut_node{this->node(idx)};
+            pmut_node->order = order;
+            pmut_node->requested = pages;
+
+            m_used = (m_used + pages).checked();
+
+            auto mut_buf{m_pool.subspan(bsl::to_idx(idx), pages)};
             bsl::builtin_memset(mut_buf.data(), '\0', mut_buf.size_bytes());
 
-            bsl::ensures(m_crsr.is_valid_and_checked());
+            bsl::ensures(mut_buf.size() == pages);
             return mut_buf;
         }
 
         /// <!-- description -->
-        ///   @brief Not supported
+        ///   @brief Returns memory to the huge pool. The memory is broken
+        ///     up into naturally aligned blocks, and each block is merged
+        ///     with its buddy for as long as its buddy is also free.
         ///
         /// <!-- inputs/outputs -->
         ///   @param tls the current TLS block
@@ -196,25 +510,53 @@ namespace mk
         deallocate(tls_t const &tls, bsl::span<page_4k_t> const &buf) noexcept
         {
             lock_guard_t mut_lock{tls, m_lock};
-            bsl::discard(buf);
 
             /// NOTE:
-            /// - If this function is implemented, we will have to deal with
-            ///   deallocations being a page in size. Specifically, right now
-            ///   a huge page is allocated and mapped into the page tables
-            ///   one page at a time. When is is time to deallocate, this
-            ///   memory is released one page at a time. If the page tables
-            ///   are deallocating one page of a larger physically contiguous
-            ///   memory region, it should be assumed that the entire region
-            ///   will be freed, it will just happen in page increments.
-            /// - What this means is this function could see a free for the
-            ///   same physically contiguous block of memory (one for each
-            ///   page in the block). We could ignore the extras, or we
-            ///   could set up the allocator so that it frees one page at a
-            ///   time. Just depends on how we want to do this... but in
-            ///   general, I would suggest using the later as a buddy allocator
-            ///   can support this without any added overhead.
+            /// - The buffer must be the same span that was returned by
+            ///   allocate(). Freeing a portion of an allocation is not
+            ///   supported.
             ///
+
+            if (buf.is_invalid()) {
+                return;
+            }
+
+            if (bsl::unlikely(buf.data() < m_pool.data())) {
+                bsl::error() << "huge pool deallocate of memory it does not own\n" << bsl::here();
+                return;
+            }
+
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            auto const offset{static_cast<bsl::uintmx>(buf.data() - m_pool.data())};
+            auto const idx{bsl::to_umx(offset)};
+
+            if (bsl::unlikely(idx >= m_pool.size())) {
+                bsl::error() << "huge pool deallocate of memory it does not own\n" << bsl::here();
+                return;
+            }
+
+            /// NOTE:
+            /// - Only the first page of a live allocation has a non-zero
+            ///   "requested", as it is cleared here, which is what catches
+            ///   double frees and spans that do not start an allocation.
+            ///
+
+            auto *const pmut_node{this->node(idx)};
+            if (bsl::unlikely(pmut_node->free || pmut_node->requested.is_zero())) {
+                bsl::error() << "huge pool deallocate of an invalid block\n" << bsl::here();
+                return;
+            }
+
+            if (bsl::unlikely(pmut_node->requested != buf.size())) {
+                bsl::error() << "huge pool deallocate of an invalid block\n" << bsl::here();
+                return;
+            }
+
+            auto const pages{pmut_node->requested};
+            pmut_node->requested = {};
+            m_used = (m_used - pages).checked();
+
+            this->free_range(idx, pages);
         }
 
         /// <!-- description -->
@@ -262,6 +604,21 @@ namespace mk
             return this->remaining();
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes in the largest free block,
+        ///     which is the largest allocation that can currently succeed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the number of bytes in the largest free block.
+        ///
+        [[nodiscard]] constexpr auto
+        largest(tls_t const &tls) const noexcept -> bsl::safe_umx
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+            return this->largest();
+        }
+
         /// <!-- description -->
         ///   @brief Converts a virtual address to a physical address.
         ///
@@ -307,6 +664,7 @@ namespace mk
 
             constexpr auto kb{1024_umx};
             constexpr auto mb{kb * kb};
+            constexpr auto pct{100_umx};
 
             bsl::print() << bsl::mag << "huge pool dump: ";
             bsl::print() << bsl::rst << bsl::endl;
@@ -381,12 +739,81 @@ namespace mk
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::endl;
 
+            /// Largest Free Block
+            ///
+
+            auto const largest_kb{(this->largest() / kb).checked()};
+            auto const largest_mb{(this->largest() / mb).checked()};
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<12s", "largest "};
+            bsl::print() << bsl::ylw << "| ";
+            if (largest_mb.is_zero()) {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", largest_kb} << " KB ";
+            }
+            else {
+                bsl::print() << bsl::rst << bsl::fmt{"4d", largest_mb} << " MB ";
+            }
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// External Fragmentation
+            ///
+            /// NOTE:
+            /// - This is the percentage of the free memory that cannot be
+            ///   used by an allocation the size of all of the free memory.
+            ///
+
+            bsl::safe_umx mut_ext_frag{};
+            if (this->remaining().is_pos()) {
+                auto const unusable{(this->remaining() - this->largest()).checked()};
+                mut_ext_frag = ((unusable * pct) / this->remaining()).checked();
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<12s", "ext frag "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"4d", mut_ext_frag} << " %  ";
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            /// Free Blocks
+            ///
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_free_blocks.size(); ++mut_i) {
+                auto const blocks{*m_free_blocks.at_if(mut_i)};
+                if (blocks.is_zero()) {
+                    continue;
+                }
+
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << "order " << bsl::fmt{"<6d", bsl::to_u16(mut_i)};
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"4d", blocks} << " blk";
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+
             /// Footer
             ///
 
             bsl::print() << bsl::ylw << "+-----------------------+";
             bsl::print() << bsl::rst << bsl::endl;
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the huge_pool_t's lock. The
+        ///     header of the table must already be outputted (see
+        ///     basic_lock_stats_t::dump_header()).
+        ///
+        constexpr void
+        dump_locks() const noexcept
+        {
+            m_lock.stats().dump("huge pool");
+        }
     };
 }
 
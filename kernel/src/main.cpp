@@ -121,17 +121,21 @@ namespace mk
         bsl::expects(nullptr != pmut_tls);
         bsl::expects(nullptr != pmut_tls->ext);
 
-        return dispatch_syscall(
-                   *pmut_tls,
-                   g_mut_page_pool,
-                   g_mut_huge_pool,
-                   g_mut_intrinsic,
-                   g_mut_vm_pool,
-                   g_mut_vp_pool,
-                   g_mut_vs_pool,
-                   g_mut_ext_pool,
-                   g_mut_vmexit_log)
-            .get();
+        pmut_tls->ext->leave_direct_map(*pmut_tls);
+
+        auto const ret{dispatch_syscall(
+            *pmut_tls,
+            g_mut_page_pool,
+            g_mut_huge_pool,
+            g_mut_intrinsic,
+            g_mut_vm_pool,
+            g_mut_vp_pool,
+            g_mut_vs_pool,
+            g_mut_ext_pool,
+            g_mut_vmexit_log)};
+
+        pmut_tls->ext->enter_direct_map(*pmut_tls, g_mut_intrinsic);
+        return ret.get();
     }
 
     /// <!-- description -->
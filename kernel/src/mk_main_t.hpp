@@ -540,6 +540,13 @@ namespace mk
             set_extension_fail_sp(mut_tls);
             set_extension_tp(mut_tls, mut_intrinsic);
 
+            /// NOTE:
+            /// - The trace ring is optional. If the loader did not provide
+            ///   one, VMExits are simply not traced on this PP.
+            ///
+
+            mut_tls.trace_ring = mut_args.trace_ring;
+
             /// NOTE:
             /// - Initialize the PP. How this is done depends on whether or
             ///   not the PP is the BSP.
@@ -596,7 +603,7 @@ namespace mk
             /// - Start the hypervisor.
             ///
 
-            return vmexit_loop(mut_tls, mut_intrinsic, mut_vs_pool, mut_log);
+            return vmexit_loop(mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_log);
         }
     };
 }
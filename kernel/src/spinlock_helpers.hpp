@@ -26,6 +26,10 @@
 #define SPINLOCK_HELPERS_HPP
 
 #include <pause.hpp>
+#include <read_tsc.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
 
 namespace helpers
 {
@@ -37,6 +41,19 @@ namespace helpers
     {
         mk::pause();
     }
+
+    /// <!-- description -->
+    ///   @brief Returns the current value of the TSC. This is only used
+    ///     when lock statistics are enabled.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the current value of the TSC
+    ///
+    [[nodiscard]] constexpr auto
+    tsc() noexcept -> bsl::safe_u64
+    {
+        return bsl::to_u64(mk::read_tsc());
+    }
 }
 
 #endif
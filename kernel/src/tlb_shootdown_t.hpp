@@ -0,0 +1,406 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef TLB_SHOOTDOWN_T_HPP
+#define TLB_SHOOTDOWN_T_HPP
+
+#include <errc_types.hpp>
+#include <intrinsic_t.hpp>
+#include <lock_guard_t.hpp>
+#include <root_page_table_t.hpp>
+#include <spinlock_helpers.hpp>
+#include <spinlock_t.hpp>
+#include <tls_t.hpp>
+#include <tlb_shootdown_pp_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+#pragma clang diagnostic ignored "-Watomic-implicit-seq-cst"
+
+namespace mk
+{
+    /// @brief defines the number of invalidations a tlb_shootdown_t can batch
+    constexpr auto TLB_SHOOTDOWN_QUEUE_SIZE{32_umx};
+    /// @brief defines the number of times wait() yields on a single PP
+    constexpr auto TLB_SHOOTDOWN_MAX_WAIT_YIELDS{0x100000_umx};
+
+    /// <!-- description -->
+    ///   @brief Invalidates an extension's direct map on every PP that
+    ///     might still hold a stale translation for it. Each unmapped
+    ///     address is queued and given a generation. A PP is "exposed"
+    ///     while it executes extension code with this direct map active,
+    ///     and before it becomes exposed it invalidates every address
+    ///     queued since the last generation it acknowledged, all at once.
+    ///     If it fell more than TLB_SHOOTDOWN_QUEUE_SIZE generations
+    ///     behind, the whole TLB is flushed instead. The PP that queues
+    ///     an address only waits for PPs that are exposed, as every other
+    ///     PP is guaranteed to catch up before it can use the address.
+    ///     An exposed PP only catches up when it enters extension code
+    ///     again, so the wait is bounded. If wait() returns
+    ///     bsl::errc_success, no PP can still be using a stale
+    ///     translation for anything queued up to the provided generation.
+    ///     If it returns tlb_shootdown_timeout, there is no such
+    ///     guarantee: a PP that did not catch up might still be using the
+    ///     old translation until it enters again, and the caller must not
+    ///     reuse the memory behind it until is_acked() says so.
+    ///
+    class tlb_shootdown_t final
+    {
+        /// @brief safe guards m_virts
+        spinlock_t m_lock;
+        /// @brief stores the addresses that still need to be invalidated
+        bsl::array<bsl::uint64, TLB_SHOOTDOWN_QUEUE_SIZE.get()> m_virts;
+        /// @brief stores the number of addresses queued so far
+        _Atomic(bsl::uint64) m_gen;
+        /// @brief stores the state of each PP
+        bsl::array<tlb_shootdown_pp_t, HYPERVISOR_MAX_PPS.get()> m_pps;
+
+        /// <!-- description -->
+        ///   @brief Returns the state of the current PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the state of the current PP
+        ///
+        [[nodiscard]] constexpr auto
+        pp(tls_t const &tls) noexcept -> tlb_shootdown_pp_t &
+        {
+            auto *const pmut_pp{m_pps.at_if(bsl::to_idx(tls.ppid))};
+            bsl::expects(nullptr != pmut_pp);
+
+            return *pmut_pp;
+        }
+
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor.
+        ///
+        // We cannot member initialize atomics so this is not possible
+        // NOLINTNEXTLINE(bsl-class-member-init)
+        constexpr tlb_shootdown_t() noexcept    // --
+            : m_lock{}, m_virts{}
+        {
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_gen = {};
+
+            for (auto &mut_pp : m_pps) {
+                // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+                mut_pp.exposed = false;
+                // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+                mut_pp.acked = {};
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Destructor
+        ///
+        constexpr ~tlb_shootdown_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr tlb_shootdown_t(tlb_shootdown_t const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr tlb_shootdown_t(tlb_shootdown_t &&mut_o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(tlb_shootdown_t const &o) &noexcept
+            -> tlb_shootdown_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(tlb_shootdown_t &&mut_o) &noexcept
+            -> tlb_shootdown_t & = default;
+
+        /// <!-- description -->
+        ///   @brief Activates the provided RPT on the current PP. Loading
+        ///     an RPT flushes the TLB, so the current PP is caught up
+        ///     without having to invalidate anything that was queued.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param mut_rpt the RPT this tlb_shootdown_t belongs to
+        ///
+        constexpr void
+        activate(tls_t &mut_tls, intrinsic_t &mut_intrinsic, root_page_table_t &mut_rpt) noexcept
+        {
+            auto const gen{__c11_atomic_load(&m_gen, __ATOMIC_SEQ_CST)};
+            mut_rpt.activate(mut_tls, mut_intrinsic);
+            __c11_atomic_store(&this->pp(mut_tls).acked, gen, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the current PP as exposed (i.e., it is about to
+        ///     execute extension code using the provided RPT) and then
+        ///     invalidates everything that was queued since the last time
+        ///     the current PP did so. If the current PP fell too far behind,
+        ///     the whole TLB is flushed instead.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param mut_rpt the RPT this tlb_shootdown_t belongs to
+        ///
+        constexpr void
+        enter(tls_t &mut_tls, intrinsic_t &mut_intrinsic, root_page_table_t &mut_rpt) noexcept
+        {
+            auto &mut_pp{this->pp(mut_tls)};
+
+            /// NOTE:
+            /// - exposed must be visible before m_gen is read. Otherwise
+            ///   queue() could bump m_gen and miss this PP in wait(),
+            ///   while this PP misses the new address here.
+            ///
+
+            __c11_atomic_store(&mut_pp.exposed, true, __ATOMIC_SEQ_CST);
+
+            auto const acked{bsl::to_u64(__c11_atomic_load(&mut_pp.acked, __ATOMIC_RELAXED))};
+            if (acked == bsl::to_u64(__c11_atomic_load(&m_gen, __ATOMIC_SEQ_CST))) {
+                return;
+            }
+
+            bool mut_flush_all{};
+            bsl::safe_u64 mut_gen{};
+
+            {
+                lock_guard_t mut_lock{mut_tls, m_lock};
+
+                mut_gen = bsl::to_u64(__c11_atomic_load(&m_gen, __ATOMIC_RELAXED));
+                if ((mut_gen - acked).checked() > TLB_SHOOTDOWN_QUEUE_SIZE) {
+                    mut_flush_all = true;
+                }
+                else {
+                    for (auto mut_i{acked}; mut_i < mut_gen; ++mut_i) {
+                        auto const idx{bsl::to_idx(mut_i % TLB_SHOOTDOWN_QUEUE_SIZE)};
+                        mut_intrinsic.tlb_flush(bsl::to_u64(*m_virts.at_if(idx)));
+                    }
+                }
+            }
+
+            if (mut_flush_all) {
+                mut_rpt.activate(mut_tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            __c11_atomic_store(&mut_pp.acked, mut_gen.get(), __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks the current PP as no longer exposed (i.e., it is
+        ///     no longer executing extension code).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        leave(tls_t const &tls) noexcept
+        {
+            __c11_atomic_store(&this->pp(tls).exposed, false, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Queues the provided address so that every PP will
+        ///     invalidate it, and returns the generation the address was
+        ///     given. The caller is responsible for invalidating the
+        ///     address on the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param virt the virtual address to invalidate
+        ///   @return Returns the generation the address was given
+        ///
+        [[nodiscard]] constexpr auto
+        queue(tls_t const &tls, bsl::safe_u64 const &virt) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(virt.is_valid_and_checked());
+            lock_guard_t mut_lock{tls, m_lock};
+
+            auto const gen{bsl::to_u64(__c11_atomic_load(&m_gen, __ATOMIC_RELAXED))};
+            *m_virts.at_if(bsl::to_idx(gen % TLB_SHOOTDOWN_QUEUE_SIZE)) = virt.get();
+
+            auto const next{(gen + bsl::safe_u64::magic_1()).checked()};
+            __c11_atomic_store(&m_gen, next.get(), __ATOMIC_SEQ_CST);
+
+            return next;
+        }
+
+        /// <!-- description -->
+        ///   @brief Queues a flush of the whole TLB on every PP, and
+        ///     returns the generation it was given. This is used instead
+        ///     of queue() when a large number of addresses need to be
+        ///     invalidated at once. The caller is responsible for
+        ///     invalidating the addresses on the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the generation the flush was given
+        ///
+        [[nodiscard]] constexpr auto
+        queue_flush_all(tls_t const &tls) noexcept -> bsl::safe_u64
+        {
+            lock_guard_t mut_lock{tls, m_lock};
+
+            /// NOTE:
+            /// - Skipping more than TLB_SHOOTDOWN_QUEUE_SIZE generations
+            ///   makes every PP that has not acknowledged the new
+            ///   generation flush its whole TLB in enter(), so nothing
+            ///   needs to be written to m_virts.
+            ///
+
+            auto const gen{bsl::to_u64(__c11_atomic_load(&m_gen, __ATOMIC_RELAXED))};
+            auto const next{(gen + TLB_SHOOTDOWN_QUEUE_SIZE + bsl::safe_u64::magic_1()).checked()};
+            __c11_atomic_store(&m_gen, next.get(), __ATOMIC_SEQ_CST);
+
+            return next;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every other online PP that is exposed
+        ///     has invalidated everything up to the provided generation.
+        ///     Unlike wait(), this never blocks.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param gen the generation returned by queue() or
+        ///     queue_flush_all()
+        ///   @return Returns true if every other online PP that is exposed
+        ///     has invalidated everything up to the provided generation.
+        ///
+        [[nodiscard]] constexpr auto
+        is_acked(tls_t const &tls, bsl::safe_u64 const &gen) noexcept -> bool
+        {
+            bsl::expects(gen.is_valid_and_checked());
+            bsl::expects(bsl::to_umx(tls.online_pps) <= m_pps.size());
+
+            for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(tls.online_pps); ++mut_i) {
+                if (bsl::to_idx(tls.ppid) == mut_i) {
+                    continue;
+                }
+
+                auto &mut_pp{*m_pps.at_if(mut_i)};
+                if (!__c11_atomic_load(&mut_pp.exposed, __ATOMIC_SEQ_CST)) {
+                    continue;
+                }
+
+                if (gen > bsl::to_u64(__c11_atomic_load(&mut_pp.acked, __ATOMIC_ACQUIRE))) {
+                    return false;
+                }
+
+                bsl::touch();
+            }
+
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Waits until every other online PP that is exposed has
+        ///     invalidated everything up to the provided generation. An
+        ///     exposed PP only does this when it enters extension code
+        ///     again, which might never happen while this PP is waiting
+        ///     (for example, if the extension on that PP is spinning on
+        ///     something this PP's extension holds). For this reason, each
+        ///     PP is only given TLB_SHOOTDOWN_MAX_WAIT_YIELDS to catch up.
+        ///     If a PP does not, tlb_shootdown_timeout is returned, and
+        ///     that PP might still be using a stale translation until it
+        ///     enters again. The caller must then either fail in a way
+        ///     that can be retried, or keep the memory from being reused
+        ///     until is_acked() returns true.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param gen the generation returned by queue() or
+        ///     queue_flush_all()
+        ///   @return Returns bsl::errc_success if every other online PP
+        ///     that is exposed caught up, and tlb_shootdown_timeout
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        wait(tls_t const &tls, bsl::safe_u64 const &gen) noexcept -> bsl::errc_type
+        {
+            bsl::expects(gen.is_valid_and_checked());
+            bsl::expects(bsl::to_umx(tls.online_pps) <= m_pps.size());
+
+            for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(tls.online_pps); ++mut_i) {
+                if (bsl::to_idx(tls.ppid) == mut_i) {
+                    continue;
+                }
+
+                auto &mut_pp{*m_pps.at_if(mut_i)};
+                bsl::safe_umx mut_yields{};
+                while (__c11_atomic_load(&mut_pp.exposed, __ATOMIC_SEQ_CST)) {
+                    if (gen <= bsl::to_u64(__c11_atomic_load(&mut_pp.acked, __ATOMIC_ACQUIRE))) {
+                        break;
+                    }
+
+                    if (bsl::unlikely(mut_yields >= TLB_SHOOTDOWN_MAX_WAIT_YIELDS)) {
+                        bsl::error() << "tlb shootdown timed out\n" << bsl::here();
+
+                        return tlb_shootdown_timeout;
+                    }
+
+                    helpers::yield();
+                    ++mut_yields;
+                }
+            }
+
+            return bsl::errc_success;
+        }
+    };
+}
+
+#endif
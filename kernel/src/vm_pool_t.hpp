@@ -25,6 +25,7 @@
 #ifndef VM_POOL_T_HPP
 #define VM_POOL_T_HPP
 
+#include <basic_free_id_stack_t.hpp>
 #include <bf_constants.hpp>
 #include <ext_pool_t.hpp>
 #include <lock_guard_t.hpp>
@@ -53,6 +54,8 @@ namespace mk
         bsl::array<vm_t, HYPERVISOR_MAX_VMS.get()> m_pool{};
         /// @brief safe guards operations on the pool.
         mutable spinlock_t m_lock{};
+        /// @brief stores the IDs of the vm_t objects that are deallocated
+        lib::basic_free_id_stack_t<HYPERVISOR_MAX_VMS.get()> m_free_vmids{};
 
         /// <!-- description -->
         ///   @brief Returns the vm_t associated with the provided vmid.
@@ -94,6 +97,8 @@ namespace mk
             for (bsl::safe_idx mut_i{}; mut_i < m_pool.size(); ++mut_i) {
                 m_pool.at_if(mut_i)->initialize(bsl::to_u16(mut_i));
             }
+
+            m_free_vmids.initialize();
         }
 
         /// <!-- description -->
@@ -110,6 +115,8 @@ namespace mk
             for (auto &mut_vm : m_pool) {
                 mut_vm.release(mut_tls, mut_page_pool, mut_ext_pool);
             }
+
+            m_free_vmids.release();
         }
 
         /// <!-- description -->
@@ -128,16 +135,20 @@ namespace mk
         {
             lock_guard_t mut_lock{mut_tls, m_lock};
 
-            for (auto &mut_vm : m_pool) {
-                if (mut_vm.is_deallocated()) {
-                    return mut_vm.allocate(mut_tls, mut_page_pool, mut_ext_pool);
-                }
+            auto const vmid{m_free_vmids.pop()};
+            if (bsl::unlikely(vmid.is_invalid())) {
+                bsl::error() << "vm_pool_t out of vms\n" << bsl::here();
+                return bsl::safe_u16::failure();
+            }
 
-                bsl::touch();
+            auto const ret{this->get_vm(vmid)->allocate(mut_tls, mut_page_pool, mut_ext_pool)};
+            if (bsl::unlikely(ret.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                m_free_vmids.push(vmid);
+                return bsl::safe_u16::failure();
             }
 
-            bsl::error() << "vm_pool_t out of vms\n" << bsl::here();
-            return bsl::safe_u16::failure();
+            return ret;
         }
 
         /// <!-- description -->
@@ -157,7 +168,17 @@ namespace mk
             bsl::safe_u16 const &vmid) noexcept
         {
             lock_guard_t mut_lock{mut_tls, m_lock};
-            this->get_vm(vmid)->deallocate(mut_tls, mut_page_pool, mut_ext_pool);
+
+            auto *const pmut_vm{this->get_vm(vmid)};
+            bool const allocated{pmut_vm->is_allocated()};
+
+            pmut_vm->deallocate(mut_tls, mut_page_pool, mut_ext_pool);
+            if (allocated) {
+                m_free_vmids.push(vmid);
+            }
+            else {
+                bsl::touch();
+            }
         }
 
         /// <!-- description -->
@@ -25,25 +25,36 @@
 #ifndef VMEXIT_LOOP_HPP
 #define VMEXIT_LOOP_HPP
 
+#include <errc_types.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
+#include <page_pool_t.hpp>
+#include <spinlock_helpers.hpp>
 #include <tls_t.hpp>
+#include <trace_ring_write.hpp>
 #include <vmexit_log_t.hpp>
 #include <vs_pool_t.hpp>
 
+#include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/errc_type.hpp>
+#include <bsl/likely.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
 
 namespace mk
 {
+    /// @brief defines the max number of pages zeroed after each VMExit
+    constexpr auto VMEXIT_LOOP_ZERO_PAGES{1_umx};
+
     /// <!-- description -->
     ///   @brief Provides the main entry point for VMExits that occur
     ///     after a successful launch of the hypervisor.
     ///
     /// <!-- inputs/outputs -->
     ///   @param mut_tls the current TLS block
+    ///   @param mut_page_pool the page_pool_t to use
     ///   @param mut_intrinsic the intrinsic_t to use
     ///   @param mut_vs_pool the VPS pool to use
     ///   @param mut_log the VMExit log to use
@@ -53,6 +64,7 @@ namespace mk
     [[nodiscard]] constexpr auto
     vmexit_loop(
         tls_t &mut_tls,
+        page_pool_t &mut_page_pool,
         intrinsic_t &mut_intrinsic,
         vs_pool_t &mut_vs_pool,
         vmexit_log_t &mut_log) noexcept -> bsl::errc_type
@@ -64,10 +76,92 @@ namespace mk
                 return bsl::errc_failure;
             }
 
-            auto const ret{mut_tls.ext_vmexit->vmexit(mut_tls, mut_intrinsic, exit_reason)};
-            if (bsl::unlikely(!ret)) {
-                bsl::print<bsl::V>() << bsl::here();
-                return bsl::errc_failure;
+            auto const exit_tsc{helpers::tsc()};
+
+            /// NOTE:
+            /// - If the extension registered fast path rules on this PP, the
+            ///   VMExit might be one that we can handle ourselves, in which
+            ///   case we resume the guest without ever leaving ring 0.
+            ///
+
+            bool mut_handled{};
+            auto const &rules{mut_tls.ext_vmexit->fast_path(mut_tls)};
+            if (!rules.empty()) {
+                mut_handled =
+                    mut_vs_pool.handle_fast_path(mut_tls, mut_intrinsic, rules, exit_reason);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (!mut_handled) {
+                auto const ret{mut_tls.ext_vmexit->vmexit(mut_tls, mut_intrinsic, exit_reason)};
+                if (bsl::unlikely(!ret)) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                /// NOTE:
+                /// - If the extension returned using
+                ///   bf_control_op_vmexit_return, it might have asked us to
+                ///   advance the IP of the active VS before resuming it.
+                ///
+
+                if (ret == vmexit_success_advance_ip) {
+                    mut_vs_pool.advance_ip(
+                        mut_tls, mut_intrinsic, bsl::to_u16(mut_tls.active_vsid));
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - We are about to enter the guest again, so account for how
+            ///   long this VMExit took. This is always on, so it must stay
+            ///   cheap: two TSC reads and a few adds into this PP's stats.
+            /// - If tracing is enabled, run() staged a record of this VMExit
+            ///   in the TLS block. It is only added to the trace ring now so
+            ///   that it can carry the same cycle count, which is what lets
+            ///   "vmmctl trace" see the cost of each VMExit without the
+            ///   debug syscalls.
+            ///
+
+            auto const cycles{(helpers::tsc() - exit_tsc).checked()};
+            if (bsl::likely(cycles.is_valid())) {
+                mut_log.add_stats(bsl::to_u16(mut_tls.ppid), exit_reason, cycles);
+                mut_tls.trace_rec.cycles = cycles.get();
+            }
+            else {
+                mut_tls.trace_rec.cycles = {};
+            }
+
+            if (nullptr != mut_tls.trace_ring) {
+                trace_ring_write(*mut_tls.trace_ring, mut_tls.trace_rec);
+            }
+            else {
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - The extension just handled this VMExit, which costs far
+            ///   more than zeroing a page, so this is where each PP keeps
+            ///   its list of pre-zeroed pages topped up. This is done after
+            ///   the VMExit has been accounted for so that it does not show
+            ///   up in the stats or the trace. Only pages that are already
+            ///   in this PP's cache are zeroed, so the page pool's global
+            ///   lock is never taken here. VMExits handled by the fast path
+            ///   are left alone.
+            ///
+
+            if (!mut_handled) {
+                mut_page_pool.zero_cached_pages(mut_tls, VMEXIT_LOOP_ZERO_PAGES);
+            }
+            else {
+                bsl::touch();
             }
 
             mut_tls.first_launch_succeeded = bsl::safe_u64::magic_1().get();
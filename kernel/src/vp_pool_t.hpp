@@ -25,6 +25,7 @@
 #ifndef VP_POOL_T_HPP
 #define VP_POOL_T_HPP
 
+#include <basic_free_id_stack_t.hpp>
 #include <bf_constants.hpp>
 #include <lock_guard_t.hpp>
 #include <spinlock_t.hpp>
@@ -51,6 +52,8 @@ namespace mk
         bsl::array<vp_t, HYPERVISOR_MAX_VSS.get()> m_pool{};
         /// @brief safe guards operations on the pool.
         mutable spinlock_t m_lock{};
+        /// @brief stores the IDs of the vp_t objects that are deallocated
+        lib::basic_free_id_stack_t<HYPERVISOR_MAX_VPS.get()> m_free_vpids{};
 
         /// <!-- description -->
         ///   @brief Returns the vp_t associated with the provided vpid.
@@ -92,6 +95,8 @@ namespace mk
             for (bsl::safe_idx mut_i{}; mut_i < m_pool.size(); ++mut_i) {
                 m_pool.at_if(mut_i)->initialize(bsl::to_u16(mut_i));
             }
+
+            m_free_vpids.initialize();
         }
 
         /// <!-- description -->
@@ -103,6 +108,8 @@ namespace mk
             for (auto &mut_vp : m_pool) {
                 mut_vp.release();
             }
+
+            m_free_vpids.release();
         }
 
         /// <!-- description -->
@@ -119,16 +126,13 @@ namespace mk
         {
             lock_guard_t mut_lock{tls, m_lock};
 
-            for (auto &mut_vp : m_pool) {
-                if (mut_vp.is_deallocated()) {
-                    return mut_vp.allocate(vmid);
-                }
-
-                bsl::touch();
+            auto const vpid{m_free_vpids.pop()};
+            if (bsl::unlikely(vpid.is_invalid())) {
+                bsl::error() << "vp_pool_t out of vs\n" << bsl::here();
+                return bsl::safe_u16::failure();
             }
 
-            bsl::error() << "vp_pool_t out of vs\n" << bsl::here();
-            return bsl::safe_u16::failure();
+            return this->get_vp(vpid)->allocate(vmid);
         }
 
         /// <!-- description -->
@@ -142,7 +146,15 @@ namespace mk
         deallocate(tls_t const &tls, bsl::safe_u16 const &vpid) noexcept
         {
             lock_guard_t mut_lock{tls, m_lock};
-            this->get_vp(vpid)->deallocate();
+
+            auto *const pmut_vp{this->get_vp(vpid)};
+            if (bsl::unlikely(!pmut_vp->is_allocated())) {
+                pmut_vp->deallocate();
+                return;
+            }
+
+            pmut_vp->deallocate();
+            m_free_vpids.push(vpid);
         }
 
         /// <!-- description -->
@@ -25,12 +25,14 @@
 #ifndef VS_POOL_T_HPP
 #define VS_POOL_T_HPP
 
+#include <basic_free_id_stack_t.hpp>
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <exit_info_t.hpp>
+#include <fast_path_t.hpp>
 #include <intrinsic_t.hpp>
-#include <lock_guard_t.hpp>
+#include <mcs_lock_t.hpp>
 #include <page_pool_t.hpp>
-#include <spinlock_t.hpp>
 #include <state_save_t.hpp>
 #include <tls_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -56,7 +58,22 @@ namespace mk
         /// @brief stores the pool of vs_t objects
         bsl::array<vs_t, HYPERVISOR_MAX_VSS.get()> m_pool{};
         /// @brief safe guards operations on the pool.
-        mutable spinlock_t m_lock{};
+        mutable mcs_lock_t m_lock{};
+        /// @brief stores the IDs of the vs_t objects that are deallocated
+        lib::basic_free_id_stack_t<HYPERVISOR_MAX_VSS.get()> m_free_vsids{};
+
+        /// @brief stores the first vs_t assigned to each VM (as ~vsid)
+        bsl::array<bsl::safe_u16, HYPERVISOR_MAX_VMS.get()> m_vm_heads{};
+        /// @brief stores the next vs_t assigned to the same VM (as ~vsid)
+        bsl::array<bsl::safe_u16, HYPERVISOR_MAX_VSS.get()> m_vm_links{};
+        /// @brief stores the first vs_t assigned to each VP (as ~vsid)
+        bsl::array<bsl::safe_u16, HYPERVISOR_MAX_VPS.get()> m_vp_heads{};
+        /// @brief stores the next vs_t assigned to the same VP (as ~vsid)
+        bsl::array<bsl::safe_u16, HYPERVISOR_MAX_VSS.get()> m_vp_links{};
+        /// @brief stores the first vs_t assigned to each PP (as ~vsid)
+        bsl::array<bsl::safe_u16, HYPERVISOR_MAX_PPS.get()> m_pp_heads{};
+        /// @brief stores the next vs_t assigned to the same PP (as ~vsid)
+        bsl::array<bsl::safe_u16, HYPERVISOR_MAX_VSS.get()> m_pp_links{};
 
         /// <!-- description -->
         ///   @brief Returns the vs_t associated with the provided vsid.
@@ -88,6 +105,81 @@ namespace mk
             return m_pool.at_if(bsl::to_idx(vsid));
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the ID of the vs_t stored in the provided head
+        ///     or link, or bsl::safe_u16::failure() if it is the end of
+        ///     the list (or there is no list at all).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param slot the head or link to read
+        ///   @return Returns the ID of the vs_t stored in the provided head
+        ///     or link, or bsl::safe_u16::failure() if it is the end of
+        ///     the list (or there is no list at all).
+        ///
+        [[nodiscard]] static constexpr auto
+        vsid_in(bsl::safe_u16 const *const slot) noexcept -> bsl::safe_u16
+        {
+            if (bsl::unlikely(nullptr == slot)) {
+                return bsl::safe_u16::failure();
+            }
+
+            auto const vsid{~*slot};
+            if (syscall::BF_INVALID_ID == vsid) {
+                return bsl::safe_u16::failure();
+            }
+
+            return vsid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds the requested vs_t to the front of the list that
+        ///     starts with the provided head.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_head the head of the list to add the vs_t to
+        ///   @param mut_links the links of the list to add the vs_t to
+        ///   @param vsid the ID of the vs_t to add
+        ///
+        static constexpr void
+        link(
+            bsl::safe_u16 *const pmut_head,
+            bsl::array<bsl::safe_u16, HYPERVISOR_MAX_VSS.get()> &mut_links,
+            bsl::safe_u16 const &vsid) noexcept
+        {
+            bsl::expects(nullptr != pmut_head);
+
+            *mut_links.at_if(bsl::to_idx(vsid)) = *pmut_head;
+            *pmut_head = ~vsid;
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes the requested vs_t from the list that starts
+        ///     with the provided head.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_head the head of the list to remove the vs_t from
+        ///   @param mut_links the links of the list to remove the vs_t from
+        ///   @param vsid the ID of the vs_t to remove
+        ///
+        static constexpr void
+        unlink(
+            bsl::safe_u16 *const pmut_head,
+            bsl::array<bsl::safe_u16, HYPERVISOR_MAX_VSS.get()> &mut_links,
+            bsl::safe_u16 const &vsid) noexcept
+        {
+            auto *pmut_mut_slot{pmut_head};
+            bsl::expects(nullptr != pmut_mut_slot);
+
+            while (vsid != ~*pmut_mut_slot) {
+                bsl::expects(syscall::BF_INVALID_ID != ~*pmut_mut_slot);
+                pmut_mut_slot = mut_links.at_if(bsl::to_idx(~*pmut_mut_slot));
+            }
+
+            auto *const pmut_link{mut_links.at_if(bsl::to_idx(vsid))};
+            *pmut_mut_slot = *pmut_link;
+            *pmut_link = {};
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this vs_pool_t
@@ -98,6 +190,8 @@ namespace mk
             for (bsl::safe_idx mut_i{}; mut_i < m_pool.size(); ++mut_i) {
                 m_pool.at_if(mut_i)->initialize(bsl::to_u16(mut_i));
             }
+
+            m_free_vsids.initialize();
         }
 
         /// <!-- description -->
@@ -113,6 +207,14 @@ namespace mk
             for (auto &mut_vs : m_pool) {
                 mut_vs.release(mut_tls, mut_page_pool);
             }
+
+            m_free_vsids.release();
+            m_vm_heads = {};
+            m_vm_links = {};
+            m_vp_heads = {};
+            m_vp_links = {};
+            m_pp_heads = {};
+            m_pp_links = {};
         }
 
         /// <!-- description -->
@@ -137,18 +239,27 @@ namespace mk
             bsl::safe_u16 const &vpid,
             bsl::safe_u16 const &ppid) noexcept -> bsl::safe_u16
         {
-            lock_guard_t mut_lock{mut_tls, m_lock};
+            mcs_lock_guard_t mut_lock{mut_tls, m_lock};
 
-            for (auto &mut_vs : m_pool) {
-                if (mut_vs.is_deallocated()) {
-                    return mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, vmid, vpid, ppid);
-                }
+            auto const vsid{m_free_vsids.pop()};
+            if (bsl::unlikely(vsid.is_invalid())) {
+                bsl::error() << "vs_pool_t out of vss\n" << bsl::here();
+                return bsl::safe_u16::failure();
+            }
 
-                bsl::touch();
+            auto const ret{this->get_vs(vsid)->allocate(
+                mut_tls, mut_page_pool, mut_intrinsic, vmid, vpid, ppid)};
+            if (bsl::unlikely(ret.is_invalid())) {
+                bsl::print<bsl::V>() << bsl::here();
+                m_free_vsids.push(vsid);
+                return bsl::safe_u16::failure();
             }
 
-            bsl::error() << "vs_pool_t out of vss\n" << bsl::here();
-            return bsl::safe_u16::failure();
+            link(m_vm_heads.at_if(bsl::to_idx(vmid)), m_vm_links, vsid);
+            link(m_vp_heads.at_if(bsl::to_idx(vpid)), m_vp_links, vsid);
+            link(m_pp_heads.at_if(bsl::to_idx(ppid)), m_pp_links, vsid);
+
+            return ret;
         }
 
         /// <!-- description -->
@@ -163,8 +274,20 @@ namespace mk
         constexpr void
         deallocate(tls_t &mut_tls, page_pool_t &mut_page_pool, bsl::safe_u16 const &vsid) noexcept
         {
-            lock_guard_t mut_lock{mut_tls, m_lock};
-            this->get_vs(vsid)->deallocate(mut_tls, mut_page_pool);
+            mcs_lock_guard_t mut_lock{mut_tls, m_lock};
+
+            auto *const pmut_vs{this->get_vs(vsid)};
+            if (bsl::unlikely(!pmut_vs->is_allocated())) {
+                pmut_vs->deallocate(mut_tls, mut_page_pool);
+                return;
+            }
+
+            unlink(m_vm_heads.at_if(bsl::to_idx(pmut_vs->assigned_vm())), m_vm_links, vsid);
+            unlink(m_vp_heads.at_if(bsl::to_idx(pmut_vs->assigned_vp())), m_vp_links, vsid);
+            unlink(m_pp_heads.at_if(bsl::to_idx(pmut_vs->assigned_pp())), m_pp_links, vsid);
+
+            pmut_vs->deallocate(mut_tls, mut_page_pool);
+            m_free_vsids.push(vsid);
         }
 
         /// <!-- description -->
@@ -277,7 +400,12 @@ namespace mk
             bsl::safe_u16 const &ppid,
             bsl::safe_u16 const &vsid) noexcept
         {
-            this->get_vs(vsid)->migrate(mut_tls, mut_intrinsic, ppid);
+            mcs_lock_guard_t mut_lock{mut_tls, m_lock};
+
+            auto *const pmut_vs{this->get_vs(vsid)};
+            unlink(m_pp_heads.at_if(bsl::to_idx(pmut_vs->assigned_pp())), m_pp_links, vsid);
+            pmut_vs->migrate(mut_tls, mut_intrinsic, ppid);
+            link(m_pp_heads.at_if(bsl::to_idx(ppid)), m_pp_links, vsid);
         }
 
         /// <!-- description -->
@@ -336,15 +464,7 @@ namespace mk
             bsl::expects(vmid.is_valid_and_checked());
             bsl::expects(vmid != syscall::BF_INVALID_ID);
 
-            for (auto const &vs : m_pool) {
-                if (vs.assigned_vm() == vmid) {
-                    return vs.id();
-                }
-
-                bsl::touch();
-            }
-
-            return bsl::safe_u16::failure();
+            return vsid_in(m_vm_heads.at_if(bsl::to_idx(vmid)));
         }
 
         /// <!-- description -->
@@ -364,15 +484,7 @@ namespace mk
             bsl::expects(ppid.is_valid_and_checked());
             bsl::expects(ppid != syscall::BF_INVALID_ID);
 
-            for (auto const &vs : m_pool) {
-                if (vs.assigned_pp() == ppid) {
-                    return vs.id();
-                }
-
-                bsl::touch();
-            }
-
-            return bsl::safe_u16::failure();
+            return vsid_in(m_pp_heads.at_if(bsl::to_idx(ppid)));
         }
 
         /// <!-- description -->
@@ -392,15 +504,7 @@ namespace mk
             bsl::expects(vpid.is_valid_and_checked());
             bsl::expects(vpid != syscall::BF_INVALID_ID);
 
-            for (auto const &vs : m_pool) {
-                if (vs.assigned_vp() == vpid) {
-                    return vs.id();
-                }
-
-                bsl::touch();
-            }
-
-            return bsl::safe_u16::failure();
+            return vsid_in(m_vp_heads.at_if(bsl::to_idx(vpid)));
         }
 
         /// <!-- description -->
@@ -487,6 +591,35 @@ namespace mk
             return this->get_vs(vsid)->write(mut_tls, mut_intrinsic, reg, val);
         }
 
+        /// <!-- description -->
+        ///   @brief Sets the list of registers that the requested vs_t
+        ///     publishes into the extension's TLS block on every VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param info the list of registers to publish
+        ///   @param vsid the ID of the vs_t to set the list of
+        ///
+        constexpr void
+        set_exit_info(exit_info_t const &info, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->set_exit_info(info);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the list of registers that the requested vs_t
+        ///     publishes into the extension's TLS block on every VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid the ID of the vs_t to get the list of
+        ///   @return Returns the list of registers that the requested vs_t
+        ///     publishes into the extension's TLS block on every VMExit.
+        ///
+        [[nodiscard]] constexpr auto
+        exit_info(bsl::safe_u16 const &vsid) const noexcept -> exit_info_t const &
+        {
+            return this->get_vs(vsid)->exit_info();
+        }
+
         /// <!-- description -->
         ///   @brief Runs the vs_t. Note that this function does not
         ///     return until a VMExit occurs. Once complete, this function
@@ -521,6 +654,30 @@ namespace mk
             return this->get_vs(vsid)->advance_ip(mut_tls, mut_intrinsic);
         }
 
+        /// <!-- description -->
+        ///   @brief Attempts to handle the current VMExit of the active
+        ///     vs_t using the provided fast path rules. If the VMExit is
+        ///     handled, the IP is advanced and this function returns true.
+        ///     Otherwise, the VMExit must be given to the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param rules the fast path rules to use
+        ///   @param exit_reason the exit reason of the current VMExit
+        ///   @return Returns true if the VMExit was handled, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        handle_fast_path(
+            tls_t &mut_tls,
+            intrinsic_t &mut_intrinsic,
+            fast_path_t const &rules,
+            bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            auto const vsid{bsl::to_u16(mut_tls.active_vsid)};
+            return this->get_vs(vsid)->handle_fast_path(mut_tls, mut_intrinsic, rules, exit_reason);
+        }
+
         /// <!-- description -->
         ///   @brief Clears the vs_t's internal cache. Note that this is a
         ///     hardware specific function and doesn't change the actual
@@ -538,9 +695,9 @@ namespace mk
         }
 
         /// <!-- description -->
-        ///   @brief Loops through every VS, and flushes any TLB entries
-        ///     associated with a VS that is assigned to the provided VM
-        ///     and the current PP.
+        ///   @brief Loops through every VS assigned to the provided VM,
+        ///     and flushes any TLB entries associated with a VS that is
+        ///     also assigned to the current PP.
         ///
         /// <!-- inputs/outputs -->
         ///   @param mut_tls the current TLS block
@@ -553,16 +710,19 @@ namespace mk
             bsl::expects(vmid.is_valid_and_checked());
             bsl::expects(vmid != syscall::BF_INVALID_ID);
 
-            for (auto &mut_vs : m_pool) {
-                if (vmid != mut_vs.assigned_vm()) {
-                    continue;
-                }
+            mcs_lock_guard_t mut_lock{mut_tls, m_lock};
 
-                if (mut_tls.ppid != mut_vs.assigned_pp()) {
-                    continue;
+            auto mut_vsid{vsid_in(m_vm_heads.at_if(bsl::to_idx(vmid)))};
+            while (mut_vsid.is_valid()) {
+                auto *const pmut_vs{this->get_vs(mut_vsid)};
+                if (mut_tls.ppid == pmut_vs->assigned_pp()) {
+                    pmut_vs->tlb_flush(mut_tls, intrinsic);
+                }
+                else {
+                    bsl::touch();
                 }
 
-                mut_vs.tlb_flush(mut_tls, intrinsic);
+                mut_vsid = vsid_in(m_vm_links.at_if(bsl::to_idx(mut_vsid)));
             }
         }
 
@@ -586,6 +746,52 @@ namespace mk
             this->get_vs(vsid)->tlb_flush(mut_tls, intrinsic, gla);
         }
 
+        /// <!-- description -->
+        ///   @brief Given a GLA and a number of pages, invalidates any TLB
+        ///     entries on this PP associated with this VS for each page
+        ///     in the provided range, one page at a time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param gla the guest linear address of the first page
+        ///   @param num_pages the number of pages to invalidate
+        ///   @param vsid the ID of the vs_t to flush
+        ///
+        constexpr void
+        tlb_flush_range(
+            tls_t &mut_tls,
+            intrinsic_t const &intrinsic,
+            bsl::safe_u64 const &gla,
+            bsl::safe_u64 const &num_pages,
+            bsl::safe_u16 const &vsid) noexcept
+        {
+            bsl::expects(gla.is_valid_and_checked());
+            bsl::expects(num_pages.is_valid_and_checked());
+
+            auto *const pmut_vs{this->get_vs(vsid)};
+            for (bsl::safe_u64 mut_i{}; mut_i < num_pages; ++mut_i) {
+                auto const page{(gla + (mut_i * HYPERVISOR_PAGE_SIZE)).checked()};
+                pmut_vs->tlb_flush(mut_tls, intrinsic, page);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates every TLB entry on this PP associated with
+        ///     the requested VS.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param vsid the ID of the vs_t to flush
+        ///
+        constexpr void
+        tlb_flush_all(
+            tls_t const &tls, intrinsic_t &mut_intrinsic, bsl::safe_u16 const &vsid) noexcept
+        {
+            this->get_vs(vsid)->tlb_flush_all(tls, mut_intrinsic);
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the requested vs_t
         ///
@@ -599,6 +805,17 @@ namespace mk
         {
             return this->get_vs(vsid)->dump(mut_tls, intrinsic);
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the vs_pool_t's lock. The
+        ///     header of the table must already be outputted (see
+        ///     basic_lock_stats_t::dump_header()).
+        ///
+        constexpr void
+        dump_locks() const noexcept
+        {
+            m_lock.stats().dump("vs pool");
+        }
     };
 }
 
@@ -28,6 +28,7 @@
 #include <bf_constants.hpp>
 #include <intrinsic_invlpg.hpp>
 #include <intrinsic_invlpga.hpp>
+#include <intrinsic_nasid.hpp>
 #include <intrinsic_rdmsr.hpp>
 #include <intrinsic_set_cr3.hpp>
 #include <intrinsic_set_tls_reg.hpp>
@@ -84,6 +85,20 @@ namespace mk
             return intrinsic_invlpga(addr.get(), bsl::to_u64(asid).get());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the number of ASIDs supported by the current
+        ///     PP (including ASID 0, which belongs to the host) as
+        ///     reported by CPUID 0x8000000A.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of ASIDs supported by the current PP
+        ///
+        [[nodiscard]] static constexpr auto
+        nasid() noexcept -> bsl::safe_u64
+        {
+            return bsl::to_u64(intrinsic_nasid());
+        }
+
         /// <!-- description -->
         ///   @brief Sets the RPT pointer
         ///
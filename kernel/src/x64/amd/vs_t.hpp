@@ -25,17 +25,24 @@
 #ifndef VS_T_HPP
 #define VS_T_HPP
 
+#include "../fast_path_helpers.hpp"
+#include "../vs_tag_helpers.hpp"
+
 #include <allocated_status_t.hpp>
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <exit_info_t.hpp>
+#include <fast_path_t.hpp>
 #include <general_purpose_regs_t.hpp>
 #include <global_descriptor_table_register_t.hpp>
 #include <interrupt_descriptor_table_register_t.hpp>
 #include <intrinsic_t.hpp>
 #include <missing_registers_t.hpp>
 #include <page_pool_t.hpp>
+#include <spinlock_helpers.hpp>
 #include <state_save_t.hpp>
 #include <tls_t.hpp>
+#include <trace_record_t.hpp>
 #include <vmcb_t.hpp>
 #include <vmexit_log_t.hpp>
 
@@ -48,6 +55,7 @@
 #include <bsl/expects.hpp>
 #include <bsl/finally.hpp>
 #include <bsl/is_same.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/string_view.hpp>
 #include <bsl/touch.hpp>
@@ -55,6 +63,9 @@
 
 namespace mk
 {
+    /// @brief defines the max number of ASIDs used (16bits to match Intel)
+    constexpr auto VMCB_MAX_NUM_ASIDS{0x10000_u64};
+
     /// <!-- description -->
     ///   @brief Defines the microkernel's notion of a VS.
     ///
@@ -85,6 +96,12 @@ namespace mk
         general_purpose_regs_t m_gprs{};
         /// @brief stores the VMCB missing registers
         missing_registers_t m_missing_registers{};
+        /// @brief stores the registers to publish to the extension on VMExit
+        exit_info_t m_exit_info{};
+        /// @brief stores the ASID given to this VS by the PP it runs on
+        bsl::safe_u16 m_tag{};
+        /// @brief stores the generation m_tag was given in
+        bsl::safe_u64 m_tag_generation{};
 
         /// <!-- description -->
         ///   @brief Returns the row color based on the value of "val"
@@ -211,6 +228,110 @@ namespace mk
             return val | efer_mask;
         }
 
+        /// <!-- description -->
+        ///   @brief Publishes the registers listed in m_exit_info into the
+        ///     extension's TLS block, starting at TLS_OFFSET_EXIT_INFO. Any
+        ///     register that cannot be read is published as 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        publish_exit_info(tls_t const &tls, intrinsic_t &mut_intrinsic) const noexcept
+        {
+            constexpr auto size{bsl::to_u64(sizeof(bsl::uint64))};
+            for (bsl::safe_idx mut_i{}; mut_i < m_exit_info.size(); ++mut_i) {
+                auto const val{this->read(tls, mut_intrinsic, m_exit_info.reg(mut_i))};
+                auto const offs{syscall::TLS_OFFSET_EXIT_INFO + (bsl::to_u64(mut_i) * size)};
+
+                if (bsl::unlikely(val.is_invalid())) {
+                    mut_intrinsic.set_tls_reg(offs.checked(), {});
+                }
+                else {
+                    mut_intrinsic.set_tls_reg(offs.checked(), bsl::to_u64(val));
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Stages a record of the VMExit that just occurred in the
+        ///     TLS block. vmexit_loop() adds it to this PP's trace ring once
+        ///     the VMExit has been handled and its cost is known.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param exit_reason the VMExit reason to record
+        ///
+        constexpr void
+        trace(tls_t &mut_tls, bsl::safe_umx const &exit_reason) const noexcept
+        {
+            loader::trace_record_t mut_rec{};
+            mut_rec.tsc = helpers::tsc().get();
+            mut_rec.exit_reason = exit_reason.get();
+            mut_rec.exit_info = m_guest_vmcb->exitinfo1;
+            mut_rec.rip = m_guest_vmcb->rip;
+            mut_rec.ppid = mut_tls.ppid;
+            mut_rec.vmid = mut_tls.active_vmid;
+            mut_rec.vpid = mut_tls.active_vpid;
+            mut_rec.vsid = mut_tls.active_vsid;
+
+            mut_tls.trace_rec = mut_rec;
+        }
+
+        /// <!-- description -->
+        ///   @brief Clears the provided VMCB clean bits, telling the CPU
+        ///     that it must reload the associated field group from the
+        ///     guest VMCB on the next VMRUN.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param bits the VMCB_CLEAN_BITS_xxx field groups to clear
+        ///
+        constexpr void
+        set_dirty(bsl::safe_u32 const &bits) noexcept
+        {
+            auto const clean{bsl::to_u32(m_guest_vmcb->vmcb_clean_bits) & ~bits};
+            m_guest_vmcb->vmcb_clean_bits = clean.get();
+        }
+
+        /// <!-- description -->
+        ///   @brief Ensures that this VS has an ASID that can be used on
+        ///     the current PP, giving it a new one if it does not. ASIDs
+        ///     are owned by the microkernel so that no two VSs share an
+        ///     ASID on the same PP, which means that switching between
+        ///     VSs never requires a flush.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        ensure_this_vs_has_a_tag(tls_t &mut_tls, intrinsic_t const &intrinsic) noexcept
+        {
+            if (vs_tag_is_current(mut_tls, m_tag, m_tag_generation)) {
+                return;
+            }
+
+            auto mut_num_tags{intrinsic.nasid()};
+            if (mut_num_tags > VMCB_MAX_NUM_ASIDS) {
+                mut_num_tags = VMCB_MAX_NUM_ASIDS;
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (vs_tag_allocate(mut_tls, mut_num_tags, m_tag, m_tag_generation)) {
+                constexpr auto flush_all_asids{1_u8};
+                m_guest_vmcb->tlb_control = flush_all_asids.get();
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_guest_vmcb->guest_asid = bsl::to_u32(m_tag).get();
+            this->set_dirty(VMCB_CLEAN_BITS_ASID);
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this vs_t
@@ -332,8 +453,11 @@ namespace mk
         {
             bsl::expects(this->is_active().is_invalid());
 
+            m_exit_info.clear();
             m_missing_registers = {};
             m_gprs = {};
+            m_tag = {};
+            m_tag_generation = {};
 
             if (nullptr != m_host_vmcb) {
                 mut_page_pool.deallocate(mut_tls, m_host_vmcb);
@@ -499,6 +623,16 @@ namespace mk
 
             this->clear(tls, intrinsic);
             m_assigned_ppid = ~ppid;
+
+            /// NOTE:
+            /// - The ASID was given to us by the PP we are leaving, so we
+            ///   need a new one from the PP we are migrating to. Keeping
+            ///   it would let us reuse stale TLB entries if we ever
+            ///   migrate back in the same generation.
+            ///
+
+            m_tag = {};
+            m_tag_generation = {};
         }
 
         /// <!-- description -->
@@ -675,6 +809,8 @@ namespace mk
             m_guest_vmcb->sysenter_eip = state->msr_sysenter_eip;
             m_guest_vmcb->pat = state->msr_pat;
             m_guest_vmcb->dbgctl = state->msr_debugctl;
+
+            m_guest_vmcb->vmcb_clean_bits = {};
         }
 
         /// <!-- description -->
@@ -1006,7 +1142,7 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_guest_asid: {
-                    return bsl::to_u64(m_guest_vmcb->guest_asid);
+                    return bsl::to_u64(m_tag);
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_tlb_control: {
@@ -1579,6 +1715,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->intercept_cr_read = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1590,6 +1727,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->intercept_cr_write = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1601,6 +1739,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->intercept_dr_read = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1612,6 +1751,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->intercept_dr_write = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1623,6 +1763,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->intercept_exception = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1634,6 +1775,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->intercept_instruction1 = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1645,6 +1787,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->intercept_instruction2 = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1656,6 +1799,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->intercept_instruction3 = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1667,6 +1811,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->pause_filter_threshold = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
@@ -1678,37 +1823,35 @@ namespace mk
                     }
 
                     m_guest_vmcb->pause_filter_count = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_iopm_base_pa: {
                     m_guest_vmcb->iopm_base_pa = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_IOPM);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_msrpm_base_pa: {
                     m_guest_vmcb->msrpm_base_pa = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_IOPM);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_tsc_offset: {
                     m_guest_vmcb->tsc_offset = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_I);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_guest_asid: {
-                    auto const val16{bsl::to_u16(val)};
-                    if (bsl::unlikely(val16.is_invalid())) {
-                        mut_ret = bsl::errc_narrow_overflow;
-                        break;
-                    }
-
                     /// NOTE:
-                    /// - To match Intel, and our use of 16bit IDs, the
-                    ///   ASID must be 16bits instead of 32bits.
+                    /// - The ASID is owned by the microkernel, which gives
+                    ///   each VS its own ASID when it runs, so writes from
+                    ///   an extension are ignored.
                     ///
 
-                    m_guest_vmcb->guest_asid = bsl::to_u32(val16).get();
                     return bsl::errc_success;
                 }
 
@@ -1725,6 +1868,7 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_virtual_interrupt_a: {
                     m_guest_vmcb->virtual_interrupt_a = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_TPR);
                     return bsl::errc_success;
                 }
 
@@ -1755,11 +1899,13 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_ctls1: {
                     m_guest_vmcb->ctls1 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_NP);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_avic_apic_bar: {
                     m_guest_vmcb->avic_apic_bar = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_AVIC);
                     return bsl::errc_success;
                 }
 
@@ -1775,11 +1921,13 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_n_cr3: {
                     m_guest_vmcb->n_cr3 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_NP);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ctls2: {
                     m_guest_vmcb->ctls2 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_LBR);
                     return bsl::errc_success;
                 }
 
@@ -1812,16 +1960,19 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_avic_apic_backing_page_ptr: {
                     m_guest_vmcb->avic_apic_backing_page_ptr = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_AVIC);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_avic_logical_table_ptr: {
                     m_guest_vmcb->avic_logical_table_ptr = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_AVIC);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_avic_physical_table_ptr: {
                     m_guest_vmcb->avic_physical_table_ptr = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_AVIC);
                     return bsl::errc_success;
                 }
 
@@ -1838,6 +1989,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->es_selector = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1849,6 +2001,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->es_attrib = compress_attrib(val16).get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1860,11 +2013,13 @@ namespace mk
                     }
 
                     m_guest_vmcb->es_limit = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_es_base: {
                     m_guest_vmcb->es_base = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1876,6 +2031,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->cs_selector = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1887,6 +2043,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->cs_attrib = compress_attrib(val16).get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1898,11 +2055,13 @@ namespace mk
                     }
 
                     m_guest_vmcb->cs_limit = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cs_base: {
                     m_guest_vmcb->cs_base = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1914,6 +2073,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->ss_selector = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1925,6 +2085,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->ss_attrib = compress_attrib(val16).get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1936,11 +2097,13 @@ namespace mk
                     }
 
                     m_guest_vmcb->ss_limit = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ss_base: {
                     m_guest_vmcb->ss_base = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1952,6 +2115,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->ds_selector = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1963,6 +2127,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->ds_attrib = compress_attrib(val16).get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -1974,11 +2139,13 @@ namespace mk
                     }
 
                     m_guest_vmcb->ds_limit = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_ds_base: {
                     m_guest_vmcb->ds_base = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
@@ -2066,6 +2233,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->gdtr_selector = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DT);
                     return bsl::errc_success;
                 }
 
@@ -2077,6 +2245,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->gdtr_attrib = compress_attrib(val16).get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DT);
                     return bsl::errc_success;
                 }
 
@@ -2088,11 +2257,13 @@ namespace mk
                     }
 
                     m_guest_vmcb->gdtr_limit = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DT);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_gdtr_base: {
                     m_guest_vmcb->gdtr_base = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DT);
                     return bsl::errc_success;
                 }
 
@@ -2142,6 +2313,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->idtr_selector = val16.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DT);
                     return bsl::errc_success;
                 }
 
@@ -2153,6 +2325,7 @@ namespace mk
                     }
 
                     m_guest_vmcb->idtr_attrib = compress_attrib(val16).get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DT);
                     return bsl::errc_success;
                 }
 
@@ -2164,11 +2337,13 @@ namespace mk
                     }
 
                     m_guest_vmcb->idtr_limit = val32.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DT);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_idtr_base: {
                     m_guest_vmcb->idtr_base = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DT);
                     return bsl::errc_success;
                 }
 
@@ -2218,36 +2393,43 @@ namespace mk
                     }
 
                     m_guest_vmcb->cpl = bsl::to_u8(val).get();
+                    this->set_dirty(VMCB_CLEAN_BITS_SEG);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_efer: {
                     m_guest_vmcb->efer = sanitize_efer(val).get();
+                    this->set_dirty(VMCB_CLEAN_BITS_CRX);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cr4: {
                     m_guest_vmcb->cr4 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_CRX);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cr3: {
                     m_guest_vmcb->cr3 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_CRX);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cr0: {
                     m_guest_vmcb->cr0 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_CRX);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_dr7: {
                     m_guest_vmcb->dr7 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DRX);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_dr6: {
                     m_guest_vmcb->dr6 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_DRX);
                     return bsl::errc_success;
                 }
 
@@ -2308,36 +2490,43 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_cr2: {
                     m_guest_vmcb->cr2 = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_CR2);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_pat: {
                     m_guest_vmcb->pat = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_NP);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_dbgctl: {
                     m_guest_vmcb->dbgctl = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_LBR);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_br_from: {
                     m_guest_vmcb->br_from = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_LBR);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_br_to: {
                     m_guest_vmcb->br_to = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_LBR);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_lastexcpfrom: {
                     m_guest_vmcb->lastexcpfrom = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_LBR);
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_lastexcpto: {
                     m_guest_vmcb->lastexcpto = val.get();
+                    this->set_dirty(VMCB_CLEAN_BITS_LBR);
                     return bsl::errc_success;
                 }
 
@@ -2409,19 +2598,21 @@ namespace mk
         ///     will return the VMExit reason.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param tls the current TLS block
+        ///   @param mut_tls the current TLS block
         ///   @param mut_intrinsic the intrinsic_t to use
         ///   @param mut_log the VMExit log to use
         ///   @return Returns the VMExit reason on success, or
         ///     bsl::safe_umx::failure() on failure.
         ///
         [[nodiscard]] constexpr auto
-        run(tls_t const &tls, intrinsic_t &mut_intrinsic, vmexit_log_t &mut_log) noexcept
+        run(tls_t &mut_tls, intrinsic_t &mut_intrinsic, vmexit_log_t &mut_log) noexcept
             -> bsl::safe_umx
         {
             bsl::discard(mut_intrinsic);
             bsl::expects(allocated_status_t::allocated == m_allocated);
-            bsl::expects(tls.ppid == this->assigned_pp());
+            bsl::expects(mut_tls.ppid == this->assigned_pp());
+
+            this->ensure_this_vs_has_a_tag(mut_tls, mut_intrinsic);
 
             auto const exit_reason{mut_intrinsic.vmrun(
                 m_guest_vmcb,
@@ -2432,10 +2623,10 @@ namespace mk
 
             if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
                 mut_log.add(
-                    bsl::to_u16(tls.ppid),
-                    {bsl::to_u16(tls.active_vmid),
-                     bsl::to_u16(tls.active_vpid),
-                     bsl::to_u16(tls.active_vsid),
+                    bsl::to_u16(mut_tls.ppid),
+                    {bsl::to_u16(mut_tls.active_vmid),
+                     bsl::to_u16(mut_tls.active_vpid),
+                     bsl::to_u16(mut_tls.active_vsid),
                      bsl::to_umx(exit_reason),
                      bsl::to_umx(m_guest_vmcb->exitinfo1),
                      bsl::to_umx(m_guest_vmcb->exitinfo2),
@@ -2459,10 +2650,62 @@ namespace mk
                      bsl::to_umx(m_guest_vmcb->rip)});
             }
 
+            if (nullptr != mut_tls.trace_ring && exit_reason.is_valid()) {
+                this->trace(mut_tls, exit_reason);
+            }
+            else {
+                bsl::touch();
+            }
+
+            /// NOTE:
+            /// - Once VMRUN succeeds, the CPU holds this VMCB's state in
+            ///   its cache, so everything is marked clean until write(),
+            ///   state_save_to_vs() or clear() says otherwise. migrate()
+            ///   calls clear(), so a VMCB is never run clean on a new PP.
+            ///
+
+            if (exit_reason.is_valid()) {
+                m_guest_vmcb->vmcb_clean_bits = VMCB_CLEAN_BITS_ALL.get();
+            }
+            else {
+                bsl::touch();
+            }
+
             m_guest_vmcb->tlb_control = {};
+            this->publish_exit_info(mut_tls, mut_intrinsic);
+
             return exit_reason;
         }
 
+        /// <!-- description -->
+        ///   @brief Sets the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///     An empty list disables publishing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param info the list of registers to publish
+        ///
+        constexpr void
+        set_exit_info(exit_info_t const &info) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_exit_info = info;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///
+        [[nodiscard]] constexpr auto
+        exit_info() const noexcept -> exit_info_t const &
+        {
+            return m_exit_info;
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the vs_t
         ///
@@ -2480,6 +2723,112 @@ namespace mk
             m_guest_vmcb->rip = m_guest_vmcb->nrip;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns true if the provided exit code is caused by an
+        ///     instruction intercept, in which case nRIP is valid and the
+        ///     instruction can be skipped by advancing the IP. VMExits
+        ///     caused by events (e.g., nested page faults, interrupts,
+        ///     NMIs, exceptions, task switches and shutdowns), as well as
+        ///     RSM and IRET, return false.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit code to check
+        ///   @return Returns true if the provided exit code is caused by an
+        ///     instruction intercept.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_instruction_exit(bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            /// NOTE:
+            /// - 0x00-0x3F are the CR/DR reads and writes, 0x65-0x72 are
+            ///   the selective CR0 write through CPUID, 0x75-0x7C are INTn
+            ///   through MSR (including IOIO), and 0x80-0x8E are VMRUN
+            ///   through RDPRU.
+            ///
+
+            constexpr auto dr_write_last{0x3F_umx};
+            constexpr auto cr0_sel_write{0x65_umx};
+            constexpr auto cpuid{0x72_umx};
+            constexpr auto intn{0x75_umx};
+            constexpr auto msr{0x7C_umx};
+            constexpr auto vmrun{0x80_umx};
+            constexpr auto rdpru{0x8E_umx};
+
+            if (exit_reason <= dr_write_last) {
+                return true;
+            }
+
+            if ((exit_reason >= cr0_sel_write) && (exit_reason <= cpuid)) {
+                return true;
+            }
+
+            if ((exit_reason >= intn) && (exit_reason <= msr)) {
+                return true;
+            }
+
+            return (exit_reason >= vmrun) && (exit_reason <= rdpru);
+        }
+
+        /// <!-- description -->
+        ///   @brief Attempts to handle the current VMExit using the provided
+        ///     fast path rules. If the VMExit is handled, the IP is advanced
+        ///     and this function returns true. Otherwise, nothing is changed
+        ///     and the VMExit must be given to the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param rules the fast path rules to use
+        ///   @param exit_reason the exit reason of the current VMExit
+        ///   @return Returns true if the VMExit was handled, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        handle_fast_path(
+            tls_t const &tls,
+            intrinsic_t &mut_intrinsic,
+            fast_path_t const &rules,
+            bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            constexpr auto exit_reason_cpuid{0x72_umx};
+            constexpr auto exit_reason_msr{0x7C_umx};
+            constexpr auto exitinfo1_wrmsr{0x1_u64};
+
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(tls.ppid == this->assigned_pp());
+
+            bool mut_handled{};
+            if (exit_reason == exit_reason_cpuid) {
+                mut_handled = fast_path_cpuid(mut_intrinsic, rules);
+            }
+            else if (exit_reason == exit_reason_msr) {
+                if (exitinfo1_wrmsr == bsl::to_u64(m_guest_vmcb->exitinfo1)) {
+                    mut_handled = fast_path_wrmsr(mut_intrinsic, rules);
+                }
+                else {
+                    mut_handled = fast_path_rdmsr(mut_intrinsic, rules);
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            if ((!mut_handled) && is_instruction_exit(exit_reason)) {
+                mut_handled = fast_path_advance_ip(rules, exit_reason);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (mut_handled) {
+                this->advance_ip(tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_handled;
+        }
+
         /// <!-- description -->
         ///   @brief Clears the vs_t's internal cache. Note that this is a
         ///     hardware specific function and doesn't change the actual
@@ -2541,6 +2890,20 @@ namespace mk
             return intrinsic.tlb_flush(gla, bsl::to_u16(m_guest_vmcb->guest_asid));
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates every TLB entry on this PP that is tagged
+        ///     with this VS's ASID. On AMD, this is the same as tlb_flush().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        tlb_flush_all(tls_t const &tls, intrinsic_t const &intrinsic) noexcept
+        {
+            this->tlb_flush(tls, intrinsic);
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the vs_t
         ///
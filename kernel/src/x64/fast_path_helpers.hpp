@@ -0,0 +1,165 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef FAST_PATH_HELPERS_HPP
+#define FAST_PATH_HELPERS_HPP
+
+#include <bf_constants.hpp>
+#include <fast_path_t.hpp>
+#include <intrinsic_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace mk
+{
+    /// @brief defines the mask used to get the lower 32 bits of a register
+    constexpr auto FAST_PATH_MASK32{0x00000000FFFFFFFF_u64};
+    /// @brief defines the shift used to get the upper 32 bits of a register
+    constexpr auto FAST_PATH_SHIFT32{32_u64};
+
+    /// <!-- description -->
+    ///   @brief Handles a CPUID VMExit using the provided fast path rules.
+    ///     A rule for the exact leaf/subleaf takes precedence over a rule
+    ///     for the leaf that matches any subleaf. On a match, the rule's
+    ///     values are written to the guest's rax, rbx, rcx and rdx. The
+    ///     caller is responsible for advancing the IP.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @param rules the fast path rules to use
+    ///   @return Returns true if the VMExit was handled, false otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    fast_path_cpuid(intrinsic_t &mut_intrinsic, fast_path_t const &rules) noexcept -> bool
+    {
+        auto const leaf{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RAX) & FAST_PATH_MASK32};
+        auto const subleaf{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RCX) & FAST_PATH_MASK32};
+
+        auto const exact{leaf | (subleaf << FAST_PATH_SHIFT32)};
+        auto const any{leaf | (syscall::BF_FAST_PATH_CPUID_ANY_SUBLEAF << FAST_PATH_SHIFT32)};
+
+        auto const *const pexact{rules.find(syscall::BF_FAST_PATH_CPUID, exact)};
+        auto const *const prule{
+            (nullptr != pexact) ? pexact : rules.find(syscall::BF_FAST_PATH_CPUID, any)};
+
+        if (nullptr == prule) {
+            return false;
+        }
+
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, prule->val0 & FAST_PATH_MASK32);
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RBX, prule->val0 >> FAST_PATH_SHIFT32);
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, prule->val1 & FAST_PATH_MASK32);
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RDX, prule->val1 >> FAST_PATH_SHIFT32);
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Handles an RDMSR VMExit using the provided fast path rules.
+    ///     If the MSR in rcx has a passthrough rule, the MSR is read from
+    ///     hardware and returned to the guest in rdx:rax. The caller is
+    ///     responsible for advancing the IP.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @param rules the fast path rules to use
+    ///   @return Returns true if the VMExit was handled, false otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    fast_path_rdmsr(intrinsic_t &mut_intrinsic, fast_path_t const &rules) noexcept -> bool
+    {
+        auto const msr{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RCX) & FAST_PATH_MASK32};
+        if (nullptr == rules.find(syscall::BF_FAST_PATH_RDMSR, msr)) {
+            return false;
+        }
+
+        auto const val{mut_intrinsic.rdmsr(bsl::to_u32(msr))};
+        if (bsl::unlikely(val.is_invalid())) {
+            bsl::print<bsl::V>() << bsl::here();
+            return false;
+        }
+
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, val & FAST_PATH_MASK32);
+        mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RDX, val >> FAST_PATH_SHIFT32);
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Handles a WRMSR VMExit using the provided fast path rules.
+    ///     If the MSR in rcx has a passthrough rule, rdx:rax is written to
+    ///     the MSR in hardware. The caller is responsible for advancing
+    ///     the IP.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_intrinsic the intrinsic_t to use
+    ///   @param rules the fast path rules to use
+    ///   @return Returns true if the VMExit was handled, false otherwise
+    ///
+    [[nodiscard]] constexpr auto
+    fast_path_wrmsr(intrinsic_t &mut_intrinsic, fast_path_t const &rules) noexcept -> bool
+    {
+        auto const msr{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RCX) & FAST_PATH_MASK32};
+        if (nullptr == rules.find(syscall::BF_FAST_PATH_WRMSR, msr)) {
+            return false;
+        }
+
+        auto const lo{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RAX) & FAST_PATH_MASK32};
+        auto const hi{mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RDX) & FAST_PATH_MASK32};
+
+        auto const ret{mut_intrinsic.wrmsr(bsl::to_u32(msr), (hi << FAST_PATH_SHIFT32) | lo)};
+        if (bsl::unlikely(!ret)) {
+            bsl::print<bsl::V>() << bsl::here();
+            return false;
+        }
+
+        return true;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns true if the provided fast path rules contain an
+    ///     "advance IP and resume" rule for the provided exit reason. The
+    ///     caller must only call this for exit reasons that are caused by
+    ///     an instruction (see vs_t::is_instruction_exit), as there is no
+    ///     instruction to skip otherwise. Rules for any other exit reason
+    ///     are already refused when they are registered.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param rules the fast path rules to use
+    ///   @param exit_reason the exit reason to look up
+    ///   @return Returns true if the provided fast path rules contain an
+    ///     "advance IP and resume" rule for the provided exit reason.
+    ///
+    [[nodiscard]] constexpr auto
+    fast_path_advance_ip(fast_path_t const &rules, bsl::safe_umx const &exit_reason) noexcept
+        -> bool
+    {
+        return nullptr != rules.find(syscall::BF_FAST_PATH_ADVANCE_IP, bsl::to_u64(exit_reason));
+    }
+}
+
+#endif
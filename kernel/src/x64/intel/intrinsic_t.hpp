@@ -110,7 +110,7 @@ namespace mk
 
             if (addr.is_zero()) {
                 constexpr auto type{1_u64};
-                invept_descriptor_t const desc{vmrd64(VMCS_EPTP_INDEX).get(), {}};
+                invept_descriptor_t const desc{vmrd64(VMCS_EPT_POINTER).get(), {}};
                 return intrinsic_invept(&desc, type.get());
             }
 
@@ -119,6 +119,38 @@ namespace mk
             return intrinsic_invvpid(&desc, type.get());
         }
 
+        /// <!-- description -->
+        ///   @brief Invalidates the TLB entries of the provided VPID on the
+        ///     current PP (i.e., a single-context INVVPID). Guest-physical
+        ///     mappings and extension addresses are not invalidated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vpid the VPID (as defined by Intel) to flush.
+        ///
+        static constexpr void
+        tlb_flush_vpid(bsl::safe_u16 const &vpid) noexcept
+        {
+            bsl::expects(vpid.is_valid_and_checked());
+            bsl::expects(vpid.is_pos());
+
+            constexpr auto type{1_u64};
+            invvpid_descriptor_t const desc{vpid.get(), {}, {}, {}, {}};
+            return intrinsic_invvpid(&desc, type.get());
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates the TLB entries of every VPID on the current
+        ///     PP (i.e., an all-context INVVPID). Extension addresses are
+        ///     not invalidated.
+        ///
+        static constexpr void
+        tlb_flush_all_vpids() noexcept
+        {
+            constexpr auto type{2_u64};
+            invvpid_descriptor_t const desc{{}, {}, {}, {}, {}};
+            return intrinsic_invvpid(&desc, type.get());
+        }
+
         /// <!-- description -->
         ///   @brief Returns the value of ES
         ///
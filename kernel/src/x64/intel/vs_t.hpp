@@ -25,17 +25,25 @@
 #ifndef VS_T_HPP
 #define VS_T_HPP
 
+#include "../fast_path_helpers.hpp"
+#include "../vs_tag_helpers.hpp"
+
 #include <allocated_status_t.hpp>
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <exit_info_t.hpp>
+#include <fast_path_t.hpp>
 #include <general_purpose_regs_t.hpp>
 #include <global_descriptor_table_register_t.hpp>
 #include <interrupt_descriptor_table_register_t.hpp>
 #include <intrinsic_t.hpp>
 #include <missing_registers_t.hpp>
 #include <page_pool_t.hpp>
+#include <spinlock_helpers.hpp>
 #include <state_save_t.hpp>
 #include <tls_t.hpp>
+#include <trace_record_t.hpp>
+#include <vmcs_cache_t.hpp>
 #include <vmcs_t.hpp>
 #include <vmexit_log_t.hpp>
 
@@ -45,6 +53,7 @@
 #include <bsl/errc_type.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/is_same.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/string_view.hpp>
 #include <bsl/touch.hpp>
@@ -100,6 +109,9 @@ namespace mk
     /// @brief defines the MSR_VMX_TRUE_PROC2_CTLS MSR
     constexpr auto MSR_VMX_TRUE_PROC2_CTLS{0x0000048B_u32};
 
+    /// @brief defines the number of VPIDs supported (including 0)
+    constexpr auto VMCS_NUM_VPIDS{0x10000_u64};
+
     /// <!-- description -->
     ///   @brief Defines the microkernel's notion of a VS.
     ///
@@ -126,6 +138,14 @@ namespace mk
         general_purpose_regs_t m_gprs{};
         /// @brief stores the rest of the state the vmcs doesn't
         missing_registers_t m_missing_registers{};
+        /// @brief stores the registers to publish to the extension on VMExit
+        exit_info_t m_exit_info{};
+        /// @brief stores the VMCS field cache (filled by read(), which is const)
+        mutable vmcs_cache_t m_vmcs_cache{};
+        /// @brief stores the VPID given to this VS by the PP it runs on
+        bsl::safe_u16 m_tag{};
+        /// @brief stores the generation m_tag was given in
+        bsl::safe_u64 m_tag_generation{};
 
         /// @brief stores the CR0 fixed0 values for sanitization
         bsl::safe_u64 m_vmx_cr0_fixed0{};
@@ -468,6 +488,35 @@ namespace mk
 
             bsl::expects(intrinsic.vmld(&m_vmcs_phys));
             mut_tls.loaded_vsid = this->id().get();
+            m_vmcs_cache.invalidate();
+        }
+
+        /// <!-- description -->
+        ///   @brief Ensures that this VS has a VPID that can be used on
+        ///     the current PP, giving it a new one if it does not. VPIDs
+        ///     are owned by the microkernel so that no two VSs share a
+        ///     VPID on the same PP, which means that switching between
+        ///     VSs never requires a flush.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        ensure_this_vs_has_a_tag(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            if (vs_tag_is_current(mut_tls, m_tag, m_tag_generation)) {
+                return;
+            }
+
+            if (vs_tag_allocate(mut_tls, VMCS_NUM_VPIDS, m_tag, m_tag_generation)) {
+                mut_intrinsic.tlb_flush_all_vpids();
+            }
+            else {
+                bsl::touch();
+            }
+
+            bsl::expects(mut_intrinsic.vmwr16(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER, m_tag));
         }
 
         /// <!-- description -->
@@ -490,6 +539,7 @@ namespace mk
 
             bsl::expects(mut_intrinsic.vmcl(&m_vmcs_phys));
             bsl::expects(mut_intrinsic.vmld(&m_vmcs_phys));
+            m_vmcs_cache.invalidate();
 
             auto const es{mut_intrinsic.es_selector()};
             bsl::expects(mut_intrinsic.vmwr16(VMCS_HOST_ES_SELECTOR, es));
@@ -596,6 +646,134 @@ namespace mk
             bsl::expects(m_vmx_proc2_fixed1.is_valid_and_checked());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the value of the requested register for
+        ///     publish_exit_info(). This must only be called right after a
+        ///     VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param reg the register to read
+        ///   @return Returns the value of the requested register, or
+        ///     bsl::safe_umx::failure() if it cannot be read.
+        ///
+        [[nodiscard]] constexpr auto
+        read_exit_info(
+            tls_t &mut_tls, intrinsic_t &mut_intrinsic, syscall::bf_reg_t const reg) const noexcept
+            -> bsl::safe_umx
+        {
+            /// NOTE:
+            /// - STAR, LSTAR, CSTAR, FMASK and KERNEL_GS_BASE are switched
+            ///   lazily (see intrinsic_vmrun). Right after a VMExit the
+            ///   guest's values are still loaded, and the copies in
+            ///   m_missing_registers are stale until intrinsic_load_host_msrs
+            ///   saves them, so these have to come from the MSRs themselves.
+            ///
+
+            switch (reg) {
+                case syscall::bf_reg_t::bf_reg_t_star: {
+                    return mut_intrinsic.rdmsr(MSR_STAR);
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_lstar: {
+                    return mut_intrinsic.rdmsr(MSR_LSTAR);
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_cstar: {
+                    return mut_intrinsic.rdmsr(MSR_CSTAR);
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_fmask: {
+                    return mut_intrinsic.rdmsr(MSR_FMASK);
+                }
+
+                case syscall::bf_reg_t::bf_reg_t_kernel_gs_base: {
+                    return mut_intrinsic.rdmsr(MSR_KERNEL_GS_BASE);
+                }
+
+                default: {
+                    break;
+                }
+            }
+
+            return this->read(mut_tls, mut_intrinsic, reg);
+        }
+
+        /// <!-- description -->
+        ///   @brief Publishes the registers listed in m_exit_info into the
+        ///     extension's TLS block, starting at TLS_OFFSET_EXIT_INFO. Any
+        ///     register that cannot be read is published as 0.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        publish_exit_info(tls_t &mut_tls, intrinsic_t &mut_intrinsic) const noexcept
+        {
+            constexpr auto size{bsl::to_u64(sizeof(bsl::uint64))};
+            for (bsl::safe_idx mut_i{}; mut_i < m_exit_info.size(); ++mut_i) {
+                auto const reg{m_exit_info.reg(mut_i)};
+                auto const val{this->read_exit_info(mut_tls, mut_intrinsic, reg)};
+                auto const offs{syscall::TLS_OFFSET_EXIT_INFO + (bsl::to_u64(mut_i) * size)};
+
+                if (bsl::unlikely(val.is_invalid())) {
+                    mut_intrinsic.set_tls_reg(offs.checked(), {});
+                }
+                else {
+                    mut_intrinsic.set_tls_reg(offs.checked(), bsl::to_u64(val));
+                }
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Stages a record of the VMExit that just occurred in the
+        ///     TLS block. vmexit_loop() adds it to this PP's trace ring once
+        ///     the VMExit has been handled and its cost is known. The exit
+        ///     qualification and RIP are read through the VMCS cache, so the
+        ///     extension gets them for free if it asks for them while
+        ///     handling this VMExit.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param intrinsic the intrinsic_t to use
+        ///   @param exit_reason the VMExit reason to record
+        ///
+        constexpr void
+        trace(tls_t &mut_tls, intrinsic_t const &intrinsic, bsl::safe_umx const &exit_reason)
+            const noexcept
+        {
+            auto mut_info{this->read(
+                mut_tls, intrinsic, syscall::bf_reg_t::bf_reg_t_exit_qualification)};
+            if (bsl::unlikely(mut_info.is_invalid())) {
+                mut_info = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            auto mut_rip{this->read(mut_tls, intrinsic, syscall::bf_reg_t::bf_reg_t_rip)};
+            if (bsl::unlikely(mut_rip.is_invalid())) {
+                mut_rip = {};
+            }
+            else {
+                bsl::touch();
+            }
+
+            loader::trace_record_t mut_rec{};
+            mut_rec.tsc = helpers::tsc().get();
+            mut_rec.exit_reason = exit_reason.get();
+            mut_rec.exit_info = mut_info.get();
+            mut_rec.rip = mut_rip.get();
+            mut_rec.ppid = mut_tls.ppid;
+            mut_rec.vmid = mut_tls.active_vmid;
+            mut_rec.vpid = mut_tls.active_vpid;
+            mut_rec.vsid = mut_tls.active_vsid;
+
+            mut_tls.trace_rec = mut_rec;
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this vs_t
@@ -702,8 +880,12 @@ namespace mk
         {
             bsl::expects(this->is_active().is_invalid());
 
+            m_exit_info.clear();
+            m_vmcs_cache.invalidate();
             m_missing_registers = {};
             m_gprs = {};
+            m_tag = {};
+            m_tag_generation = {};
 
             if (nullptr != m_vmcs) {
                 mut_page_pool.deallocate(mut_tls, m_vmcs);
@@ -860,6 +1042,16 @@ namespace mk
 
             this->clear(mut_tls, intrinsic);
             m_assigned_ppid = ~ppid;
+
+            /// NOTE:
+            /// - The VPID was given to us by the PP we are leaving, so we
+            ///   need a new one from the PP we are migrating to. Keeping
+            ///   it would let us reuse stale TLB entries if we ever
+            ///   migrate back in the same generation.
+            ///
+
+            m_tag = {};
+            m_tag_generation = {};
         }
 
         /// <!-- description -->
@@ -1108,6 +1300,9 @@ namespace mk
             m_missing_registers.guest_cstar = state->msr_cstar;
             m_missing_registers.guest_fmask = state->msr_fmask;
             m_missing_registers.guest_kernel_gs_base = state->msr_kernel_gs_base;
+            m_missing_registers.loaded_on = {};
+
+            m_vmcs_cache.invalidate_guest_state();
         }
 
         /// <!-- description -->
@@ -1332,6 +1527,11 @@ namespace mk
 
             this->ensure_this_vs_is_loaded(mut_tls, intrinsic);
 
+            auto const cached{m_vmcs_cache.get(reg)};
+            if (cached.is_valid()) {
+                return cached;
+            }
+
             switch (reg) {
                 case syscall::bf_reg_t::bf_reg_t_unsupported: {
                     break;
@@ -1486,8 +1686,7 @@ namespace mk
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_virtual_processor_identifier: {
-                    mut_ret = intrinsic.vmrd64(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER, mut_val.data());
-                    break;
+                    return bsl::to_u64(m_tag);
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_posted_interrupt_notification_vector: {
@@ -2206,6 +2405,7 @@ namespace mk
                 return bsl::safe_umx::failure();
             }
 
+            m_vmcs_cache.set(reg, mut_val);
             return mut_val;
         }
 
@@ -2233,6 +2433,11 @@ namespace mk
             bsl::expects(val.is_valid_and_checked());
             this->ensure_this_vs_is_loaded(mut_tls, mut_intrinsic);
 
+            auto const cached{m_vmcs_cache.get(reg)};
+            if (cached.is_valid() && cached == val) {
+                return bsl::errc_success;
+            }
+
             switch (reg) {
                 case syscall::bf_reg_t::bf_reg_t_unsupported: {
                     break;
@@ -2400,38 +2605,42 @@ namespace mk
 
                 case syscall::bf_reg_t::bf_reg_t_star: {
                     m_missing_registers.guest_star = val.get();
+                    m_missing_registers.loaded_on = {};
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_lstar: {
                     m_missing_registers.guest_lstar = val.get();
+                    m_missing_registers.loaded_on = {};
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_cstar: {
                     m_missing_registers.guest_cstar = val.get();
+                    m_missing_registers.loaded_on = {};
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_fmask: {
                     m_missing_registers.guest_fmask = val.get();
+                    m_missing_registers.loaded_on = {};
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_kernel_gs_base: {
                     m_missing_registers.guest_kernel_gs_base = val.get();
+                    m_missing_registers.loaded_on = {};
                     return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_virtual_processor_identifier: {
-                    auto const val16{bsl::to_u16(val)};
-                    if (bsl::unlikely(val16.is_invalid())) {
-                        mut_ret = bsl::errc_narrow_overflow;
-                        break;
-                    }
+                    /// NOTE:
+                    /// - The VPID is owned by the microkernel, which gives
+                    ///   each VS its own VPID when it runs, so writes from
+                    ///   an extension are ignored.
+                    ///
 
-                    mut_ret = mut_intrinsic.vmwr16(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER, val16);
-                    break;
+                    return bsl::errc_success;
                 }
 
                 case syscall::bf_reg_t::bf_reg_t_posted_interrupt_notification_vector: {
@@ -3533,6 +3742,7 @@ namespace mk
                 return bsl::errc_failure;
             }
 
+            m_vmcs_cache.set(reg, val);
             return bsl::errc_success;
         }
 
@@ -3553,7 +3763,10 @@ namespace mk
             -> bsl::safe_umx
         {
             this->ensure_this_vs_is_loaded(mut_tls, mut_intrinsic);
+            this->ensure_this_vs_has_a_tag(mut_tls, mut_intrinsic);
+
             auto const exit_reason{mut_intrinsic.vmrun(&m_missing_registers)};
+            m_vmcs_cache.invalidate_guest_state();
 
             if constexpr (BSL_DEBUG_LEVEL >= bsl::VV) {
                 mut_log.add(
@@ -3584,9 +3797,46 @@ namespace mk
                      mut_intrinsic.vmrd64(VMCS_GUEST_RIP)});
             }
 
+            if (nullptr != mut_tls.trace_ring && exit_reason.is_valid()) {
+                this->trace(mut_tls, mut_intrinsic, exit_reason);
+            }
+            else {
+                bsl::touch();
+            }
+
+            this->publish_exit_info(mut_tls, mut_intrinsic);
             return exit_reason;
         }
 
+        /// <!-- description -->
+        ///   @brief Sets the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///     An empty list disables publishing.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param info the list of registers to publish
+        ///
+        constexpr void
+        set_exit_info(exit_info_t const &info) noexcept
+        {
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            m_exit_info = info;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the list of registers that this vs_t publishes
+        ///     into the extension's TLS block every time run() returns.
+        ///
+        [[nodiscard]] constexpr auto
+        exit_info() const noexcept -> exit_info_t const &
+        {
+            return m_exit_info;
+        }
+
         /// <!-- description -->
         ///   @brief Advance the IP of the vs_t
         ///
@@ -3597,16 +3847,119 @@ namespace mk
         constexpr void
         advance_ip(tls_t &mut_tls, intrinsic_t &mut_intrinsic) noexcept
         {
-            bsl::safe_u64 mut_rip{};
-            bsl::safe_u64 mut_len{};
+            constexpr auto rip_reg{syscall::bf_reg_t::bf_reg_t_rip};
+            constexpr auto len_reg{syscall::bf_reg_t::bf_reg_t_vmexit_instruction_length};
 
-            this->ensure_this_vs_is_loaded(mut_tls, mut_intrinsic);
+            auto const rip{this->read(mut_tls, mut_intrinsic, rip_reg)};
+            auto const len{this->read(mut_tls, mut_intrinsic, len_reg)};
+
+            auto const nrip{(rip + len).checked()};
+            bsl::expects(this->write(mut_tls, mut_intrinsic, rip_reg, nrip));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the provided exit reason is caused by
+        ///     the guest executing an instruction, in which case the
+        ///     VM-exit instruction length is valid and the instruction can
+        ///     be skipped by advancing the IP. VMExits caused by events
+        ///     (e.g., EPT violations, external interrupts, NMIs, exceptions,
+        ///     task switches, MTF, the APIC exits and VM-entry failures)
+        ///     return false.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit reason to check
+        ///   @return Returns true if the provided exit reason is caused by
+        ///     the guest executing an instruction.
+        ///
+        [[nodiscard]] static constexpr auto
+        is_instruction_exit(bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            /// NOTE:
+            /// - Bit n of the masks below is set if basic exit reason n
+            ///   (low) or n + 64 (high) is caused by an instruction. The
+            ///   low mask contains CPUID, GETSEC, HLT, INVD, INVLPG,
+            ///   RDPMC, RDTSC, the VMX instructions, CR/DR accesses, I/O,
+            ///   RDMSR, WRMSR, MWAIT, MONITOR, PAUSE, the descriptor
+            ///   table accesses, INVEPT, RDTSCP, INVVPID, WBINVD, XSETBV,
+            ///   RDRAND, INVPCID, VMFUNC, ENCLS, RDSEED and XSAVES. The
+            ///   high mask contains XRSTORS, UMWAIT and TPAUSE.
+            /// - An exit reason with any of its flag bits set (i.e., a
+            ///   value above 127) is never an instruction exit.
+            ///
+
+            constexpr auto low{0xBEECC191FFFDFC00_u64};
+            constexpr auto high{0x0000000000000019_u64};
+            constexpr auto bits{64_umx};
+            constexpr auto max{128_umx};
+
+            if (exit_reason >= max) {
+                return false;
+            }
 
-            bsl::expects(mut_intrinsic.vmrd64(VMCS_GUEST_RIP, mut_rip.data()));
-            bsl::expects(mut_intrinsic.vmrd64(VMCS_VMEXIT_INSTRUCTION_LENGTH, mut_len.data()));
+            if (exit_reason < bits) {
+                return ((low >> bsl::to_u64(exit_reason)) & bsl::safe_u64::magic_1()).is_pos();
+            }
 
-            auto const nrip{(mut_rip + mut_len).checked()};
-            bsl::expects(mut_intrinsic.vmwr64(VMCS_GUEST_RIP, nrip));
+            auto const shift{bsl::to_u64((exit_reason - bits).checked())};
+            return ((high >> shift) & bsl::safe_u64::magic_1()).is_pos();
+        }
+
+        /// <!-- description -->
+        ///   @brief Attempts to handle the current VMExit using the provided
+        ///     fast path rules. If the VMExit is handled, the IP is advanced
+        ///     and this function returns true. Otherwise, nothing is changed
+        ///     and the VMExit must be given to the extension.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///   @param rules the fast path rules to use
+        ///   @param exit_reason the exit reason of the current VMExit
+        ///   @return Returns true if the VMExit was handled, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        handle_fast_path(
+            tls_t &mut_tls,
+            intrinsic_t &mut_intrinsic,
+            fast_path_t const &rules,
+            bsl::safe_umx const &exit_reason) noexcept -> bool
+        {
+            constexpr auto exit_reason_cpuid{0x0A_umx};
+            constexpr auto exit_reason_rdmsr{0x1F_umx};
+            constexpr auto exit_reason_wrmsr{0x20_umx};
+
+            bsl::expects(allocated_status_t::allocated == m_allocated);
+            bsl::expects(mut_tls.ppid == this->assigned_pp());
+
+            bool mut_handled{};
+            if (exit_reason == exit_reason_cpuid) {
+                mut_handled = fast_path_cpuid(mut_intrinsic, rules);
+            }
+            else if (exit_reason == exit_reason_rdmsr) {
+                mut_handled = fast_path_rdmsr(mut_intrinsic, rules);
+            }
+            else if (exit_reason == exit_reason_wrmsr) {
+                mut_handled = fast_path_wrmsr(mut_intrinsic, rules);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if ((!mut_handled) && is_instruction_exit(exit_reason)) {
+                mut_handled = fast_path_advance_ip(rules, exit_reason);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if (mut_handled) {
+                this->advance_ip(mut_tls, mut_intrinsic);
+            }
+            else {
+                bsl::touch();
+            }
+
+            return mut_handled;
         }
 
         /// <!-- description -->
@@ -3626,6 +3979,7 @@ namespace mk
 
             bsl::expects(intrinsic.vmcl(&m_vmcs_phys));
             m_missing_registers.launched = {};
+            m_vmcs_cache.invalidate();
 
             if (this->id() == mut_tls.loaded_vsid) {
                 mut_tls.loaded_vsid = syscall::BF_INVALID_ID.get();
@@ -3654,20 +4008,45 @@ namespace mk
 
         /// <!-- description -->
         ///   @brief Given a GLA, invalidates any TLB entries on this PP
-        ///     associated with this VS for the provided GLA.
+        ///     associated with this VS for the provided GLA. If this VS
+        ///     does not have a VPID that is current on this PP, it cannot
+        ///     have any TLB entries on this PP, so nothing is invalidated.
         ///
         /// <!-- inputs/outputs -->
-        ///   @param mut_tls the current TLS block
+        ///   @param tls the current TLS block
         ///   @param intrinsic the intrinsic_t to use
         ///   @param gla the guest linear address to invalidate
         ///
         constexpr void
-        tlb_flush(tls_t &mut_tls, intrinsic_t const &intrinsic, bsl::safe_u64 const &gla) noexcept
+        tlb_flush(tls_t const &tls, intrinsic_t const &intrinsic, bsl::safe_u64 const &gla) noexcept
         {
-            this->ensure_this_vs_is_loaded(mut_tls, intrinsic);
+            if (!vs_tag_is_current(tls, m_tag, m_tag_generation)) {
+                return;
+            }
 
-            auto const vpid{intrinsic.vmrd16(VMCS_VIRTUAL_PROCESSOR_IDENTIFIER)};
-            intrinsic.tlb_flush(gla, vpid);
+            intrinsic.tlb_flush(gla, m_tag);
+        }
+
+        /// <!-- description -->
+        ///   @brief Invalidates every TLB entry on this PP that is tagged
+        ///     with this VS's VPID. Unlike tlb_flush(), this does not touch
+        ///     guest-physical mappings, so other VSs in the same VM keep
+        ///     their TLB entries. If this VS does not have a VPID that is
+        ///     current on this PP, it cannot have any TLB entries on this
+        ///     PP, so nothing is invalidated.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_intrinsic the intrinsic_t to use
+        ///
+        constexpr void
+        tlb_flush_all(tls_t const &tls, intrinsic_t &mut_intrinsic) noexcept
+        {
+            if (!vs_tag_is_current(tls, m_tag, m_tag_generation)) {
+                return;
+            }
+
+            mut_intrinsic.tlb_flush_vpid(m_tag);
         }
 
         /// <!-- description -->
@@ -29,7 +29,9 @@
 #include <basic_map_page_flags.hpp>
 
 #include <bsl/ensures.hpp>
+#include <bsl/expects.hpp>
 #include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
 
 namespace helpers
 {
@@ -95,6 +97,62 @@ namespace helpers
         }
     }
 
+    /// <!-- description -->
+    ///   @brief Configures an entry as a pointer to a 2m or 1g block (i.e.,
+    ///     a large page). This is the same as configure_entry_as_ptr_to_block
+    ///     except that the "page size" bit is also set, which is only
+    ///     supported by level-1 and level-2 entries.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///   @param page_flgs defines how memory should be mapped
+    ///
+    template<typename E>
+    constexpr void
+    configure_entry_as_ptr_to_large_block(
+        E *const pmut_entry, bsl::safe_u64 const &page_flgs) noexcept
+    {
+        configure_entry_as_ptr_to_block(pmut_entry, page_flgs);
+        pmut_entry->ps = bsl::safe_u64::magic_1().get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the flags that were used to configure an entry as a
+    ///     pointer to a block. This is used when a large page is split into
+    ///     smaller pages so that the smaller pages can be mapped the same
+    ///     way as the large page was.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns the flags that were used to configure an entry as a
+    ///     pointer to a block.
+    ///
+    template<typename E>
+    [[nodiscard]] constexpr auto
+    entry_flags(E const *const entry) noexcept -> bsl::safe_u64
+    {
+        bsl::expects(nullptr != entry);
+
+        auto mut_flgs{lib::BASIC_MAP_PAGE_READ};
+        if (bsl::safe_u64::magic_1() == entry->rw) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_WRITE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        if (bsl::safe_u64::magic_0() == entry->nx) {
+            mut_flgs |= lib::BASIC_MAP_PAGE_EXECUTE;
+        }
+        else {
+            bsl::touch();
+        }
+
+        return mut_flgs;
+    }
+
     /// <!-- description -->
     ///   @brief Configures an entry as a pointer to a table.
     ///
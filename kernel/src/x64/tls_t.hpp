@@ -26,6 +26,7 @@
 #define TLS_T_HPP
 
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -43,7 +44,7 @@ namespace mk
     /// @brief defines the size of the reserved1 field in the tls_t
     constexpr auto TLS_T_RESERVED1_SIZE{0x030_umx};
     /// @brief defines the size of the reserved2 field in the tls_t
-    constexpr auto TLS_T_RESERVED2_SIZE{0x088_umx};
+    constexpr auto TLS_T_RESERVED2_SIZE{0x020_umx};
 
     /// IMPORTANT:
     /// - If the size of the TLS is changed, the mk_main_entry will need to
@@ -192,10 +193,10 @@ namespace mk
         /// @brief stores the fail sp used by extensions for callbacks (0x198)
         bsl::uint64 ext_fail_sp;
 
-        /// @brief reserved (0x1A0)
-        bsl::uint64 reserved_tmp4;
-        /// @brief reserved (0x1A8)
-        bsl::uint64 reserved_tmp5;
+        /// @brief stores the missing registers last loaded on this PP (0x1A0)
+        void *loaded_missing_registers;
+        /// @brief stores whether the guest's syscall MSRs are loaded (0x1A8)
+        bsl::uint64 guest_syscall_msrs;
 
         /// @brief reserved (0x1B0)
         bsl::uint64 reserved_tmp6;
@@ -265,6 +266,26 @@ namespace mk
 
         /// @brief stores the currently active root page table (0x270)
         void *active_rpt;
+        /// @brief stores this PP's trace ring, or nullptr if disabled (0x278)
+        loader::trace_ring_t *trace_ring;
+
+        /// @brief stores how many bf_vs_op_run calls were fast (0x280)
+        bsl::uint64 run_fast_path_hits;
+        /// @brief stores how many bf_vs_op_run calls were slow (0x288)
+        bsl::uint64 run_fast_path_misses;
+
+        /// @brief stores this PP's VPID/ASID generation (0x290)
+        bsl::uint64 vs_tag_generation;
+        /// @brief stores the next VPID/ASID to hand out on this PP (0x298)
+        bsl::uint64 vs_tag_next;
+
+        /// @brief stores how many TLB range flushes went page by page (0x2A0)
+        bsl::uint64 tlb_flush_range_pages;
+        /// @brief stores how many TLB range flushes flushed the VS (0x2A8)
+        bsl::uint64 tlb_flush_range_full;
+
+        /// @brief stores the trace record of the VMExit being handled (0x2B0)
+        loader::trace_record_t trace_rec;
 
         /// @brief reserve the rest of the TLS block for later use.
         bsl::array<bsl::uint8, TLS_T_RESERVED2_SIZE.get()> reserved2;
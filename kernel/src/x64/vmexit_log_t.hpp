@@ -27,6 +27,7 @@
 
 #include <vmexit_log_pp_t.hpp>
 #include <vmexit_log_record_t.hpp>
+#include <vmexit_stats_record_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -45,6 +46,8 @@ namespace mk
     ///     view of what actually happened during execution, which is more
     ///     important when implementing guest support as VSs can swap between
     ///     execution on the same PP as the hypervisor is moving between VMs.
+    ///     Each PP also keeps always-on statistics per exit reason. A PP
+    ///     only ever writes to its own log, so no locks are needed.
     ///
     class vmexit_log_t final
     {
@@ -69,6 +72,57 @@ namespace mk
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the log2 histogram bucket that a VMExit which
+        ///     took "cycles" cycles belongs to. The last bucket also holds
+        ///     everything that is larger.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param cycles the number of cycles the VMExit took
+        ///   @return Returns the histogram bucket "cycles" belongs to
+        ///
+        [[nodiscard]] static constexpr auto
+        bucket(bsl::safe_u64 const &cycles) noexcept -> bsl::safe_idx
+        {
+            constexpr auto last{(VMEXIT_STATS_HISTOGRAM_SIZE - bsl::safe_umx::magic_1()).checked()};
+
+            bsl::safe_idx mut_bkt{};
+            auto mut_val{cycles >> bsl::safe_u64::magic_1()};
+            while (mut_val.is_pos() && mut_bkt < last) {
+                mut_val = mut_val >> bsl::safe_u64::magic_1();
+                ++mut_bkt;
+            }
+
+            return mut_bkt;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the stats slot that an exit reason hashes to.
+        ///     The upper bits of the exit reason are folded into the lower
+        ///     bits so that flags (like Intel's VM-entry failure bit) and
+        ///     large exit codes (like AMD's NPF) do not all land in slot 0.
+        ///     Exit reasons that are smaller than VMEXIT_STATS_SIZE always
+        ///     hash to themselves.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param exit_reason the exit reason to hash
+        ///   @return Returns the stats slot that "exit_reason" hashes to
+        ///
+        [[nodiscard]] static constexpr auto
+        slot(bsl::safe_u64 const &exit_reason) noexcept -> bsl::safe_idx
+        {
+            constexpr auto mask{bsl::to_u64(VMEXIT_STATS_SIZE - bsl::safe_umx::magic_1())};
+            constexpr auto fold32{32_u64};
+            constexpr auto fold16{16_u64};
+            constexpr auto fold8{8_u64};
+
+            auto mut_hash{exit_reason ^ (exit_reason >> fold32)};
+            mut_hash = mut_hash ^ (mut_hash >> fold16);
+            mut_hash = mut_hash ^ (mut_hash >> fold8);
+
+            return bsl::to_idx(mut_hash & mask);
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Adds a record in the VMExit log
@@ -94,6 +148,138 @@ namespace mk
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Adds a VMExit to the stats of the requested PP. The
+        ///     stats are an open addressed table that is hashed by exit
+        ///     reason. If the table is full, the VMExit is only counted
+        ///     as dropped.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the id of the PP whose stats should be added to
+        ///   @param exit_reason the exit reason of the VMExit
+        ///   @param cycles the number of cycles from VMExit to VMEntry
+        ///
+        constexpr void
+        add_stats(
+            bsl::safe_u16 const &ppid,
+            bsl::safe_u64 const &exit_reason,
+            bsl::safe_u64 const &cycles) noexcept
+        {
+            auto *const pmut_pp_log{m_vmexit_logs.at_if(bsl::to_idx(ppid))};
+            bsl::expects(nullptr != pmut_pp_log);
+
+            auto mut_idx{slot(exit_reason)};
+
+            for (bsl::safe_idx mut_i{}; mut_i < pmut_pp_log->stats.size(); ++mut_i) {
+                auto *const pmut_rec{pmut_pp_log->stats.at_if(mut_idx)};
+                if (pmut_rec->count.is_zero()) {
+                    pmut_rec->exit_reason = exit_reason;
+                }
+                else {
+                    bsl::touch();
+                }
+
+                if (pmut_rec->exit_reason == exit_reason) {
+                    ++pmut_rec->count;
+                    pmut_rec->cycles += cycles;
+                    ++*pmut_rec->histogram.at_if(bucket(cycles));
+                    return;
+                }
+
+                ++mut_idx;
+                if (mut_idx >= pmut_pp_log->stats.size()) {
+                    mut_idx = {};
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            ++pmut_pp_log->stats_dropped;
+        }
+
+        /// <!-- description -->
+        ///   @brief Dumps the VMExit stats for the requested PP
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param ppid the ID of the PP whose stats should be dumped
+        ///
+        constexpr void
+        dump_stats(bsl::safe_u16 const &ppid) const noexcept
+        {
+            auto const *const pp_log{m_vmexit_logs.at_if(bsl::to_idx(ppid))};
+            bsl::expects(nullptr != pp_log);
+
+            bsl::print() << bsl::mag << "vmexit stats for pp [";
+            bsl::print() << bsl::rst << bsl::hex(ppid);
+            bsl::print() << bsl::mag << "]: ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+--------------------------------------";
+            bsl::print() << bsl::ylw << "-----------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "reason "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "count "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^18s", "cycles "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "avg "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+--------------------------------------";
+            bsl::print() << bsl::ylw << "-----------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            for (auto const &rec : pp_log->stats) {
+                if (rec.count.is_zero()) {
+                    continue;
+                }
+
+                auto const avg{(rec.cycles / rec.count).checked()};
+
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"10d", rec.exit_reason};
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"10d", rec.count};
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"18d", rec.cycles};
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"10d", avg};
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::endl;
+
+                bsl::print() << bsl::ylw << "|  ";
+                for (bsl::safe_idx mut_i{}; mut_i < rec.histogram.size(); ++mut_i) {
+                    auto const *const bkt{rec.histogram.at_if(mut_i)};
+                    if (bkt->is_pos()) {
+                        bsl::print() << bsl::blu << " 2^" << bsl::to_u64(mut_i) << ':';
+                        bsl::print() << bsl::rst << *bkt;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+                }
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+
+            bsl::print() << bsl::ylw << "+--------------------------------------";
+            bsl::print() << bsl::ylw << "-----------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            if (pp_log->stats_dropped.is_pos()) {
+                bsl::print() << bsl::ylw << "dropped: ";
+                bsl::print() << bsl::rst << pp_log->stats_dropped;
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
         /// <!-- description -->
         ///   @brief Dumps the contents of the VMExit log for the requested PP
         ///
@@ -0,0 +1,111 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef VS_TAG_HELPERS_HPP
+#define VS_TAG_HELPERS_HPP
+
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Returns true if the provided VPID/ASID can still be used
+    ///     on the current PP. A tag is only valid in the generation it was
+    ///     handed out in, and a tag of 0 is never handed out as it
+    ///     belongs to the host.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param tls the current TLS block
+    ///   @param tag the VPID/ASID to check
+    ///   @param gen the generation tag was handed out in
+    ///   @return Returns true if the provided VPID/ASID can still be used
+    ///     on the current PP.
+    ///
+    [[nodiscard]] constexpr auto
+    vs_tag_is_current(tls_t const &tls, bsl::safe_u16 const &tag, bsl::safe_u64 const &gen) noexcept
+        -> bool
+    {
+        if (tag.is_zero()) {
+            return false;
+        }
+
+        return gen == tls.vs_tag_generation;
+    }
+
+    /// <!-- description -->
+    ///   @brief Hands out the next VPID/ASID on the current PP. Tags are
+    ///     never given back. Instead, once every tag is used, the current
+    ///     PP starts a new generation, which makes every tag it handed out
+    ///     so far stale, and starts over at 1. A VS with a stale tag asks
+    ///     for a new one the next time it runs. When a new generation is
+    ///     started, the caller must flush every tag on the current PP
+    ///     before the new tag is used.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param mut_tls the current TLS block
+    ///   @param num_tags the number of tags supported (including 0)
+    ///   @param mut_tag returns the new VPID/ASID
+    ///   @param mut_gen returns the generation mut_tag was handed out in
+    ///   @return Returns true if a new generation was started, in which
+    ///     case the caller must flush every tag on the current PP.
+    ///
+    [[nodiscard]] constexpr auto
+    vs_tag_allocate(
+        tls_t &mut_tls,
+        bsl::safe_u64 const &num_tags,
+        bsl::safe_u16 &mut_tag,
+        bsl::safe_u64 &mut_gen) noexcept -> bool
+    {
+        constexpr auto max_num_tags{0x10000_u64};
+        bsl::expects(num_tags > bsl::safe_u64::magic_1());
+        bsl::expects(num_tags <= max_num_tags);
+
+        bool mut_new_generation{};
+        auto mut_next{bsl::to_u64(mut_tls.vs_tag_next)};
+
+        if (mut_next.is_zero() || mut_next >= num_tags) {
+            auto const gen{bsl::to_u64(mut_tls.vs_tag_generation)};
+            mut_tls.vs_tag_generation = (gen + bsl::safe_u64::magic_1()).checked().get();
+
+            mut_next = bsl::safe_u64::magic_1();
+            mut_new_generation = true;
+        }
+        else {
+            bsl::touch();
+        }
+
+        mut_tag = bsl::to_u16(mut_next);
+        mut_gen = bsl::to_u64(mut_tls.vs_tag_generation);
+        mut_tls.vs_tag_next = (mut_next + bsl::safe_u64::magic_1()).checked().get();
+
+        return mut_new_generation;
+    }
+}
+
+#endif
@@ -0,0 +1,43 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MCS_LOCK_T_HPP
+#define MCS_LOCK_T_HPP
+
+#include <basic_lock_guard_t.hpp>
+#include <basic_mcs_lock_t.hpp>
+#include <lock_guard_helpers.hpp>    // IWYU pragma: export
+#include <spinlock_helpers.hpp>      // IWYU pragma: export
+
+#include <bsl/safe_integral.hpp>
+
+namespace mk
+{
+    /// @brief defines the queued (MCS) lock used by the microkernel
+    using mcs_lock_t = lib::basic_mcs_lock_t<HYPERVISOR_MAX_PPS.get()>;
+    /// @brief defines the lock guard used with a mcs_lock_t
+    using mcs_lock_guard_t = lib::basic_lock_guard_t<mcs_lock_t>;
+}
+
+#endif
@@ -75,6 +75,40 @@ namespace helpers
         pmut_entry->p = bsl::safe_u64::magic_1().get();
     }
 
+    /// <!-- description -->
+    ///   @brief Configures an entry as a pointer to a 2m or 1g block.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to configure
+    ///   @param pmut_entry the entry to configure
+    ///   @param page_flgs defines how memory should be mapped
+    ///
+    template<typename E>
+    constexpr void
+    configure_entry_as_ptr_to_large_block(
+        E *const pmut_entry, bsl::safe_u64 const &page_flgs) noexcept
+    {
+        configure_entry_as_ptr_to_block(pmut_entry, page_flgs);
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the flags that were used to configure an entry as a
+    ///     pointer to a block.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam E the type of entry to query
+    ///   @param entry the entry to query
+    ///   @return Returns the flags that were used to configure an entry as a
+    ///     pointer to a block.
+    ///
+    template<typename E>
+    [[nodiscard]] constexpr auto
+    entry_flags(E const *const entry) noexcept -> bsl::safe_u64
+    {
+        bsl::expects(nullptr != entry);
+        return bsl::safe_u64::magic_0();
+    }
+
     /// <!-- description -->
     ///   @brief Configures an entry as a pointer to a table.
     ///
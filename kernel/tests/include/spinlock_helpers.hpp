@@ -25,6 +25,8 @@
 #ifndef SPINLOCK_HELPERS_HPP
 #define SPINLOCK_HELPERS_HPP
 
+#include <bsl/safe_integral.hpp>
+
 namespace helpers
 {
     /// <!-- description -->
@@ -33,6 +35,18 @@ namespace helpers
     constexpr void
     yield() noexcept
     {}
+
+    /// <!-- description -->
+    ///   @brief Returns the current value of the TSC
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the current value of the TSC
+    ///
+    [[nodiscard]] constexpr auto
+    tsc() noexcept -> bsl::safe_u64
+    {
+        return {};
+    }
 }
 
 #endif
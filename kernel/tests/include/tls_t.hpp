@@ -31,6 +31,7 @@
 #include <l2e_t.hpp>
 #include <l3e_t.hpp>
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/errc_type.hpp>
 #include <bsl/safe_integral.hpp>
@@ -141,6 +142,21 @@ namespace mk
 
         /// @brief stores the currently active root page table
         void *active_rpt;
+        /// @brief stores this PP's trace ring, or nullptr if disabled
+        loader::trace_ring_t *trace_ring;
+
+        /// @brief stores how many bf_vs_op_run calls were fast
+        bsl::uint64 run_fast_path_hits;
+        /// @brief stores how many bf_vs_op_run calls were slow
+        bsl::uint64 run_fast_path_misses;
+
+        /// @brief stores how many TLB range flushes went page by page
+        bsl::uint64 tlb_flush_range_pages;
+        /// @brief stores how many TLB range flushes flushed the VS
+        bsl::uint64 tlb_flush_range_full;
+
+        /// @brief stores the trace record of the VMExit being handled
+        loader::trace_record_t trace_rec;
 
         /// --------------------------------------------------------------------
         /// Unit Test Only
@@ -49,7 +49,7 @@ namespace mk
             bsl::ut_given{} = [&]() noexcept {
                 bsl::ut_then{} = [&]() noexcept {
                     bsl::ut_check(
-                        dispatch_syscall_bf_mem_op({}, {}, {}) == syscall::BF_STATUS_SUCCESS);
+                        dispatch_syscall_bf_mem_op({}, {}, {}, {}) == syscall::BF_STATUS_SUCCESS);
                 };
             };
         };
@@ -61,7 +61,7 @@ namespace mk
                     mut_tls.test_ret = SYSCALL_BF_MEM_OP_FAILS;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_mem_op(mut_tls, {}, {}) !=
+                            dispatch_syscall_bf_mem_op(mut_tls, {}, {}, {}) !=
                             syscall::BF_STATUS_SUCCESS);
                     };
                 };
@@ -41,7 +41,7 @@ main() noexcept -> bsl::exit_code
 
     bsl::ut_scenario{"verify noexcept"} = []() noexcept {
         bsl::ut_then{} = []() noexcept {
-            static_assert(noexcept(mk::dispatch_syscall_bf_mem_op({}, {}, {})));
+            static_assert(noexcept(mk::dispatch_syscall_bf_mem_op({}, {}, {}, {})));
         };
     };
 
@@ -27,6 +27,7 @@
 #include <basic_alloc_huge_t.hpp>
 #include <basic_alloc_page_t.hpp>
 #include <bf_constants.hpp>
+#include <fast_path_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/convert.hpp>
@@ -118,6 +119,41 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"fast_path"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                constexpr auto key{42_u64};
+                constexpr auto val{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.fast_path(mut_tls).empty());
+                    };
+
+                    bsl::ut_required_step(mut_ext.add_fast_path(
+                        mut_tls, syscall::BF_FAST_PATH_CPUID, key, val, val));
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const *const prule{
+                            mut_ext.fast_path(mut_tls).find(syscall::BF_FAST_PATH_CPUID, key)};
+                        bsl::ut_required_step(nullptr != prule);
+                        bsl::ut_check(val == prule->val0);
+                        bsl::ut_check(val == prule->val1);
+                    };
+
+                    mut_tls.ppid = bsl::safe_u16::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.fast_path(mut_tls).empty());
+                    };
+
+                    mut_tls.ppid = {};
+                    mut_ext.release({}, {}, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.fast_path(mut_tls).empty());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"handle"} = [&]() noexcept {
             bsl::ut_given_at_runtime{} = [&]() noexcept {
                 ext_t mut_ext{};
@@ -164,6 +200,24 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"is_page_owned"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                constexpr auto page_virt{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.is_page_owned(mut_tls, {}, page_virt));
+                    };
+
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.is_page_owned(mut_tls, {}, page_virt));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"alloc_huge"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 ext_t mut_ext{};
@@ -183,6 +237,20 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"free_huge"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                constexpr auto virt{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.free_huge(mut_tls, {}, {}, {}, virt));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"map_page_direct"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 ext_t mut_ext{};
@@ -219,6 +287,39 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"unmap_page_direct_broadcast"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_ext.unmap_page_direct_broadcast({}, {}, {}, {}, {}));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page_direct_broadcast fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            !mut_ext.unmap_page_direct_broadcast(mut_tls, {}, {}, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"enter/leave direct map"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_ext.enter_direct_map({}, {});
+                    mut_ext.leave_direct_map({});
+                };
+            };
+        };
+
         bsl::ut_scenario{"signal_vm_created"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 ext_t mut_ext{};
@@ -74,11 +74,13 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_huge_pool.remaining({})));
                 static_assert(noexcept(mut_huge_pool.virt_to_phys<lib::basic_page_4k_t>({})));
                 static_assert(noexcept(mut_huge_pool.dump({})));
+                static_assert(noexcept(mut_huge_pool.dump_locks()));
 
                 static_assert(noexcept(huge_pool.size()));
                 static_assert(noexcept(huge_pool.allocated({})));
                 static_assert(noexcept(huge_pool.remaining({})));
                 static_assert(noexcept(huge_pool.dump({})));
+                static_assert(noexcept(huge_pool.dump_locks()));
             };
         };
     };
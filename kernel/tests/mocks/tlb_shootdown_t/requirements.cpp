@@ -0,0 +1,68 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include "../../../mocks/tlb_shootdown_t.hpp"
+
+#include <intrinsic_t.hpp>
+#include <root_page_table_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            mk::tlb_shootdown_t mut_shootdown{};
+            mk::tls_t mut_tls{};
+            mk::intrinsic_t mut_intrinsic{};
+            mk::root_page_table_t mut_rpt{};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(noexcept(mk::tlb_shootdown_t{}));
+
+                static_assert(noexcept(mut_shootdown.activate(mut_tls, mut_intrinsic, mut_rpt)));
+                static_assert(noexcept(mut_shootdown.enter(mut_tls, mut_intrinsic, mut_rpt)));
+                static_assert(noexcept(mut_shootdown.leave(mut_tls)));
+                static_assert(noexcept(mut_shootdown.queue(mut_tls, {})));
+                static_assert(noexcept(mut_shootdown.queue_flush_all(mut_tls)));
+                static_assert(noexcept(mut_shootdown.is_acked(mut_tls, {})));
+                static_assert(noexcept(mut_shootdown.wait(mut_tls, {})));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
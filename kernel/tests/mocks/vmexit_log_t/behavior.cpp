@@ -58,6 +58,24 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"add_stats"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmexit_log_t mut_log{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_log.add_stats({}, {}, {});
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump_stats"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmexit_log_t mut_log{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_log.dump_stats({});
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
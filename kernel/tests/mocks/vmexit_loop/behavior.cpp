@@ -44,7 +44,7 @@ namespace mk
             bsl::ut_given{} = [&]() noexcept {
                 bsl::ut_when{} = [&]() noexcept {
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(vmexit_loop({}, {}, {}, {}));
+                        bsl::ut_check(vmexit_loop({}, {}, {}, {}, {}));
                     };
                 };
             };
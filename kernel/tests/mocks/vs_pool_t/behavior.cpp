@@ -26,6 +26,8 @@
 
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <exit_info_t.hpp>
+#include <fast_path_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <state_save_t.hpp>
@@ -442,6 +444,59 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"set_exit_info"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_pool_t mut_vs_pool{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                exit_info_t mut_info{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_info.add(syscall::bf_reg_t::bf_reg_t_dummy));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs_pool.exit_info({}).empty());
+                    };
+
+                    mut_vs_pool.set_exit_info(mut_info, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(1_umx == mut_vs_pool.exit_info({}).size());
+                        bsl::ut_check(
+                            syscall::bf_reg_t::bf_reg_t_dummy == mut_vs_pool.exit_info({}).reg({}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_pool_t mut_vs_pool{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                constexpr auto exit_reason{42_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vs_pool.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, exit_reason));
+                    };
+
+                    bsl::ut_required_step(mut_rules.add(
+                        syscall::BF_FAST_PATH_ADVANCE_IP, bsl::to_u64(exit_reason), {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs_pool.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, exit_reason));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"clear"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_pool_t mut_vs_pool{};
@@ -498,6 +553,28 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"tlb_flush_range"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_pool_t mut_vs_pool{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_vs_pool.tlb_flush_range(mut_tls, mut_intrinsic, {}, {}, {});
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tlb_flush_all"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_pool_t mut_vs_pool{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_vs_pool.tlb_flush_all(mut_tls, mut_intrinsic, {});
+                };
+            };
+        };
+
         bsl::ut_scenario{"dump"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_pool_t mut_vs_pool{};
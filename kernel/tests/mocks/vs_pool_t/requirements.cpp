@@ -90,12 +90,19 @@ main() noexcept -> bsl::exit_code
                     noexcept(mut_vs_pool.vs_to_state_save(mut_tls, mut_intrinsic, &mut_state, {})));
                 static_assert(noexcept(mut_vs_pool.read(mut_tls, mut_intrinsic, {}, {})));
                 static_assert(noexcept(mut_vs_pool.write(mut_tls, mut_intrinsic, {}, {}, {})));
+                static_assert(noexcept(mut_vs_pool.set_exit_info({}, {})));
                 static_assert(noexcept(mut_vs_pool.run(mut_tls, mut_intrinsic, mut_log)));
                 static_assert(noexcept(mut_vs_pool.advance_ip(mut_tls, mut_intrinsic, {})));
+                static_assert(
+                    noexcept(mut_vs_pool.handle_fast_path(mut_tls, mut_intrinsic, {}, {})));
                 static_assert(noexcept(mut_vs_pool.clear(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_vs_pool.tlb_flush(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_vs_pool.tlb_flush(mut_tls, mut_intrinsic, {}, {})));
+                static_assert(
+                    noexcept(mut_vs_pool.tlb_flush_range(mut_tls, mut_intrinsic, {}, {}, {})));
+                static_assert(noexcept(mut_vs_pool.tlb_flush_all(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_vs_pool.dump(mut_tls, mut_intrinsic, {})));
+                static_assert(noexcept(mut_vs_pool.dump_locks()));
 
                 static_assert(noexcept(vs_pool.is_deallocated({})));
                 static_assert(noexcept(vs_pool.is_allocated({})));
@@ -108,7 +115,9 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(vs_pool.vs_assigned_to_vp({})));
                 static_assert(noexcept(vs_pool.vs_assigned_to_pp({})));
                 static_assert(noexcept(vs_pool.read(mut_tls, mut_intrinsic, {}, {})));
+                static_assert(noexcept(vs_pool.exit_info({})));
                 static_assert(noexcept(vs_pool.dump(mut_tls, mut_intrinsic, {})));
+                static_assert(noexcept(vs_pool.dump_locks()));
             };
         };
     };
@@ -26,6 +26,8 @@
 
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <exit_info_t.hpp>
+#include <fast_path_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <state_save_t.hpp>
@@ -462,6 +464,99 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"set_exit_info"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                exit_info_t mut_info{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_info.add(syscall::bf_reg_t::bf_reg_t_dummy));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.exit_info().empty());
+                    };
+
+                    mut_vs.set_exit_info(mut_info);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(1_umx == mut_vs.exit_info().size());
+                        bsl::ut_check(
+                            syscall::bf_reg_t::bf_reg_t_dummy == mut_vs.exit_info().reg({}));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                constexpr auto exit_reason{42_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, exit_reason));
+                    };
+
+                    bsl::ut_required_step(mut_rules.add(
+                        syscall::BF_FAST_PATH_ADVANCE_IP, bsl::to_u64(exit_reason), {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, exit_reason));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path event exit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_rules.add(
+                        syscall::BF_FAST_PATH_ADVANCE_IP,
+                        bsl::to_u64(UNIT_TEST_VS_EVENT_EXIT),
+                        {},
+                        {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, UNIT_TEST_VS_EVENT_EXIT));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_instruction_exit"} = [&]() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(vs_t::is_instruction_exit(42_umx));
+                bsl::ut_check(!vs_t::is_instruction_exit(UNIT_TEST_VS_EVENT_EXIT));
+            };
+        };
+
         bsl::ut_scenario{"clear"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -495,6 +590,7 @@ namespace mk
                     bsl::ut_then{} = [&]() noexcept {
                         mut_vs.tlb_flush(mut_tls, mut_intrinsic);
                         mut_vs.tlb_flush(mut_tls, mut_intrinsic, HYPERVISOR_PAGE_SIZE);
+                        mut_vs.tlb_flush_all(mut_tls, mut_intrinsic);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_vs.release(mut_tls, mut_page_pool);
@@ -55,6 +55,17 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"set_nasid/nasid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t mut_intrinsic{};
+                constexpr auto nasid{0x40_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_intrinsic.set_nasid(nasid);
+                    bsl::ut_check(nasid == mut_intrinsic.nasid());
+                };
+            };
+        };
+
         bsl::ut_scenario{"set_rpt"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 intrinsic_t mut_intrinsic{};
@@ -56,6 +56,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mk::intrinsic_t{}));
 
                 static_assert(noexcept(mut_intrinsic.tlb_flush({}, {})));
+                static_assert(noexcept(mut_intrinsic.nasid()));
+                static_assert(noexcept(mut_intrinsic.set_nasid({})));
                 static_assert(noexcept(mut_intrinsic.set_rpt({})));
                 static_assert(noexcept(mut_intrinsic.set_tp({})));
                 static_assert(noexcept(mut_intrinsic.tls_reg({})));
@@ -56,6 +56,9 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mk::intrinsic_t{}));
 
                 static_assert(noexcept(mut_intrinsic.tlb_flush({}, {})));
+                static_assert(noexcept(mut_intrinsic.tlb_flush_vpid({})));
+                static_assert(noexcept(mut_intrinsic.tlb_flush_all_vpids()));
+                static_assert(noexcept(intrinsic.flushed_vpid()));
                 static_assert(noexcept(mut_intrinsic.es_selector()));
                 static_assert(noexcept(mut_intrinsic.cs_selector()));
                 static_assert(noexcept(mut_intrinsic.ss_selector()));
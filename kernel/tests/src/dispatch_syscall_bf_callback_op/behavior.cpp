@@ -26,7 +26,9 @@
 
 #include <bf_constants.hpp>
 #include <ext_t.hpp>
+#include <fast_path_t.hpp>
 #include <tls_t.hpp>
+#include <vs_t.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/safe_integral.hpp>
@@ -34,6 +36,13 @@
 
 namespace mk
 {
+    /// @brief stores the key used by the fast path tests
+    constexpr auto FAST_PATH_KEY{0x0000000040000000_u64};
+    /// @brief stores the value used by the fast path tests
+    constexpr auto FAST_PATH_VAL{0x1234567890ABCDEF_u64};
+    /// @brief stores an MSR the microkernel context switches (EFER)
+    constexpr auto FAST_PATH_SWITCHED_MSR{0x00000000C0000080_u64};
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -313,6 +322,206 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = syscall::BF_FAST_PATH_CPUID.get();
+                    mut_tls.ext_reg2 = FAST_PATH_KEY.get();
+                    mut_tls.ext_reg3 = FAST_PATH_VAL.get();
+                    mut_tls.ext_reg4 = FAST_PATH_VAL.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(mut_ext.fast_path(mut_tls).size() == 1_umx);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL replaces an existing rule"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = syscall::BF_FAST_PATH_ADVANCE_IP.get();
+                    mut_tls.ext_reg2 = FAST_PATH_KEY.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(mut_ext.fast_path(mut_tls).size() == 1_umx);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL invalid kind"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = bsl::safe_u64::max_value().get();
+                    mut_tls.ext_reg2 = FAST_PATH_KEY.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL not an instruction exit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = syscall::BF_FAST_PATH_ADVANCE_IP.get();
+                    mut_tls.ext_reg2 = bsl::to_u64(UNIT_TEST_VS_EVENT_EXIT).get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL switched msr"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = syscall::BF_FAST_PATH_RDMSR.get();
+                    mut_tls.ext_reg2 = FAST_PATH_SWITCHED_MSR.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL msr out of range"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = syscall::BF_FAST_PATH_WRMSR.get();
+                    mut_tls.ext_reg2 = bsl::safe_u64::max_value().get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL msr"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = syscall::BF_FAST_PATH_WRMSR.get();
+                    mut_tls.ext_reg2 = FAST_PATH_KEY.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL not the vmexit ext"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = syscall::BF_FAST_PATH_CPUID.get();
+                    mut_tls.ext_reg2 = FAST_PATH_KEY.get();
+                    mut_tls.ext = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"REGISTER_FAST_PATH_IDX_VAL table full"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = syscall::BF_FAST_PATH_ADVANCE_IP.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    constexpr auto max{bsl::to_u64(MAX_FAST_PATH_RULES)};
+                    for (bsl::safe_u64 mut_i{}; mut_i < max; ++mut_i) {
+                        mut_tls.ext_reg2 = mut_i.get();
+                        bsl::ut_required_step(
+                            dispatch_syscall_bf_callback_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                    }
+                    mut_tls.ext_reg2 = max.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_callback_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -26,6 +26,7 @@
 
 #include <bf_constants.hpp>
 #include <ext_t.hpp>
+#include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/convert.hpp>
@@ -49,6 +50,7 @@ namespace mk
         bsl::ut_scenario{"unknown syscall"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
                 ext_t mut_ext{};
                 constexpr auto syscall{0xFFFFFFFFFFFFFFFF_u64};
                 bsl::ut_when{} = [&]() noexcept {
@@ -58,7 +60,8 @@ namespace mk
                     mut_tls.ext = &mut_ext;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_control_op(mut_tls) != syscall::BF_STATUS_SUCCESS);
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) !=
+                            syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -67,12 +70,14 @@ namespace mk
         bsl::ut_scenario{"EXIT_IDX_VAL"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
                 constexpr auto syscall{syscall::BF_CONTROL_OP_EXIT_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_tls.ext_syscall = syscall.get();
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_control_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -81,6 +86,7 @@ namespace mk
         bsl::ut_scenario{"WAIT_IDX_VAL"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_CONTROL_OP_WAIT_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -91,7 +97,8 @@ namespace mk
                     mut_tls.ext = &mut_ext;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_control_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -100,6 +107,7 @@ namespace mk
         bsl::ut_scenario{"WAIT_IDX_VAL started"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_CONTROL_OP_WAIT_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -111,7 +119,8 @@ namespace mk
                     mut_tls.ext = &mut_ext;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_control_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -120,6 +129,7 @@ namespace mk
         bsl::ut_scenario{"AGAIN_IDX_VAL"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_CONTROL_OP_AGAIN_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -130,7 +140,8 @@ namespace mk
                     mut_tls.ext = &mut_ext;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_control_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
@@ -139,6 +150,7 @@ namespace mk
         bsl::ut_scenario{"AGAIN_IDX_VAL failed"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
                 ext_t mut_ext{};
                 constexpr auto syscall{syscall::BF_CONTROL_OP_AGAIN_IDX_VAL};
                 bsl::ut_when{} = [&]() noexcept {
@@ -150,7 +162,153 @@ namespace mk
                     mut_tls.ext = &mut_ext;
                     bsl::ut_then{} = [&]() noexcept {
                         bsl::ut_check(
-                            dispatch_syscall_bf_control_op(mut_tls) == syscall::BF_STATUS_SUCCESS);
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_vmexit_return_allowed"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(is_vmexit_return_allowed(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_vmexit_return_allowed not the vmexit ext"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!is_vmexit_return_allowed(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_vmexit_return_allowed no active vm"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.active_vmid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!is_vmexit_return_allowed(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_vmexit_return_allowed no active vp"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.active_vpid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!is_vmexit_return_allowed(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_vmexit_return_allowed no active vs"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!is_vmexit_return_allowed(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"VMEXIT_RETURN_IDX_VAL outside of a vmexit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_CONTROL_OP_VMEXIT_RETURN_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = syscall::BF_VMEXIT_RETURN_RUN_CURRENT.get();
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"VMEXIT_RETURN_IDX_VAL run current"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto syscall{syscall::BF_CONTROL_OP_VMEXIT_RETURN_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = syscall::BF_VMEXIT_RETURN_RUN_CURRENT.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"VMEXIT_RETURN_IDX_VAL advance ip"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto syscall{syscall::BF_CONTROL_OP_VMEXIT_RETURN_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = syscall::BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"VMEXIT_RETURN_IDX_VAL invalid code"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto syscall{syscall::BF_CONTROL_OP_VMEXIT_RETURN_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::safe_u64::max_value().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_control_op(mut_tls, mut_page_pool) ==
+                            syscall::BF_STATUS_SUCCESS);
                     };
                 };
             };
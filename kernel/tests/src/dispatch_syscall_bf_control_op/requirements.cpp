@@ -24,6 +24,7 @@
 
 #include "../../../src/dispatch_syscall_bf_control_op.hpp"
 
+#include <page_pool_t.hpp>
 #include <tls_t.hpp>
 
 #include <bsl/ut.hpp>
@@ -44,8 +45,10 @@ main() noexcept -> bsl::exit_code
     bsl::ut_scenario{"verify noexcept"} = []() noexcept {
         bsl::ut_given{} = []() noexcept {
             mk::tls_t mut_tls{};
+            mk::page_pool_t mut_page_pool{};
             bsl::ut_then{} = []() noexcept {
-                static_assert(noexcept(mk::dispatch_syscall_bf_control_op(mut_tls)));
+                static_assert(noexcept(mk::dispatch_syscall_bf_control_op(mut_tls, mut_page_pool)));
+                static_assert(noexcept(mk::is_vmexit_return_allowed(mut_tls)));
             };
         };
     };
@@ -885,6 +885,107 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"DUMP_LOCKS_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t const page_pool{};
+                huge_pool_t const huge_pool{};
+                intrinsic_t const intrinsic{};
+                vm_pool_t const vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t const vs_pool{};
+                ext_pool_t const ext_pool{};
+                vmexit_log_t const log{};
+                constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_LOCKS_IDX_VAL};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.ext_syscall = syscall.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mk::dispatch_syscall_bf_debug_op(
+                                mut_tls,
+                                page_pool,
+                                huge_pool,
+                                intrinsic,
+                                vm_pool,
+                                vp_pool,
+                                vs_pool,
+                                ext_pool,
+                                log) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"DUMP_VMEXIT_STATS_IDX_VAL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t const page_pool{};
+                huge_pool_t const huge_pool{};
+                intrinsic_t const intrinsic{};
+                vm_pool_t const vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t const vs_pool{};
+                ext_pool_t const ext_pool{};
+                vmexit_log_t const log{};
+                constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VMEXIT_STATS_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto ppid{0x0_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = online_pps.get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(ppid).get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mk::dispatch_syscall_bf_debug_op(
+                                mut_tls,
+                                page_pool,
+                                huge_pool,
+                                intrinsic,
+                                vm_pool,
+                                vp_pool,
+                                vs_pool,
+                                ext_pool,
+                                log) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"DUMP_VMEXIT_STATS_IDX_VAL another pp"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t const page_pool{};
+                huge_pool_t const huge_pool{};
+                intrinsic_t const intrinsic{};
+                vm_pool_t const vm_pool{};
+                vp_pool_t const vp_pool{};
+                vs_pool_t const vs_pool{};
+                ext_pool_t const ext_pool{};
+                vmexit_log_t const log{};
+                constexpr auto syscall{syscall::BF_DEBUG_OP_DUMP_VMEXIT_STATS_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto ppid{0x1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = online_pps.get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(ppid).get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mk::dispatch_syscall_bf_debug_op(
+                                mut_tls,
+                                page_pool,
+                                huge_pool,
+                                intrinsic,
+                                vm_pool,
+                                vp_pool,
+                                vs_pool,
+                                ext_pool,
+                                log) == syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
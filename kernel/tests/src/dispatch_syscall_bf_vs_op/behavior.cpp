@@ -26,6 +26,7 @@
 
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <bf_types.hpp>
 #include <ext_pool_t.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
@@ -1763,6 +1764,1007 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"READ_MANY_IDX_VAL invalid vsid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_READ_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto vsid{syscall::BF_INVALID_ID};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = bsl::to_u64(vsid).get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"READ_MANY_IDX_VAL invalid regs #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_READ_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = {};
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"READ_MANY_IDX_VAL invalid regs #2"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_READ_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto regs{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + HYPERVISOR_EXT_PAGE_POOL_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(regs).get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"READ_MANY_IDX_VAL invalid regs #3"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_READ_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto regs{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + bsl::safe_umx::magic_1()).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(regs).get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"READ_MANY_IDX_VAL regs not owned"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_READ_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(HYPERVISOR_EXT_PAGE_POOL_ADDR).get();
+                    mut_tls.ext_reg3 = bsl::safe_u64::magic_1().get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"READ_MANY_IDX_VAL invalid num #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_READ_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(HYPERVISOR_EXT_PAGE_POOL_ADDR).get();
+                    mut_tls.ext_reg3 = {};
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"READ_MANY_IDX_VAL invalid num #2"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_READ_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto num{(syscall::BF_MAX_REG_VALS + bsl::safe_u64::magic_1()).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(HYPERVISOR_EXT_PAGE_POOL_ADDR).get();
+                    mut_tls.ext_reg3 = num.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"WRITE_MANY_IDX_VAL invalid vsid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_WRITE_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto vsid{syscall::BF_INVALID_ID};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = bsl::to_u64(vsid).get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"WRITE_MANY_IDX_VAL invalid regs #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_WRITE_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = {};
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"WRITE_MANY_IDX_VAL invalid regs #2"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_WRITE_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto regs{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + HYPERVISOR_EXT_PAGE_POOL_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(regs).get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"WRITE_MANY_IDX_VAL invalid regs #3"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_WRITE_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto regs{
+                    (HYPERVISOR_EXT_PAGE_POOL_ADDR + bsl::safe_umx::magic_1()).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(regs).get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"WRITE_MANY_IDX_VAL regs not owned"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_WRITE_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(HYPERVISOR_EXT_PAGE_POOL_ADDR).get();
+                    mut_tls.ext_reg3 = bsl::safe_u64::magic_1().get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"WRITE_MANY_IDX_VAL invalid num #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_WRITE_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(HYPERVISOR_EXT_PAGE_POOL_ADDR).get();
+                    mut_tls.ext_reg3 = {};
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"WRITE_MANY_IDX_VAL invalid num #2"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_WRITE_MANY_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto num{(syscall::BF_MAX_REG_VALS + bsl::safe_u64::magic_1()).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(HYPERVISOR_EXT_PAGE_POOL_ADDR).get();
+                    mut_tls.ext_reg3 = num.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read_reg_vals"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                syscall::bf_reg_vals_t mut_regs{};
+                constexpr auto vsid{0_u16};
+                constexpr auto num{1_u64};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_regs.front().reg = static_cast<bsl::uint64>(reg);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{read_reg_vals(
+                            mut_tls, mut_intrinsic, mut_vs_pool, vsid, mut_regs, num)};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read_reg_vals invalid reg"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                syscall::bf_reg_vals_t mut_regs{};
+                constexpr auto vsid{0_u16};
+                constexpr auto num{1_u64};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_unsupported};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_regs.front().reg = static_cast<bsl::uint64>(reg);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{read_reg_vals(
+                            mut_tls, mut_intrinsic, mut_vs_pool, vsid, mut_regs, num)};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS != ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"read_reg_vals read fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                syscall::bf_reg_vals_t mut_regs{};
+                constexpr auto vsid{0_u16};
+                constexpr auto num{1_u64};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_regs.front().reg = static_cast<bsl::uint64>(reg);
+                    mut_tls.test_ret = UNIT_TEST_VS_FAIL_READ;
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{read_reg_vals(
+                            mut_tls, mut_intrinsic, mut_vs_pool, vsid, mut_regs, num)};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS != ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write_reg_vals"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                syscall::bf_reg_vals_t mut_regs{};
+                constexpr auto vsid{0_u16};
+                constexpr auto num{1_u64};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_regs.front().reg = static_cast<bsl::uint64>(reg);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{write_reg_vals(
+                            mut_tls, mut_intrinsic, mut_vs_pool, vsid, mut_regs, num)};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write_reg_vals invalid reg"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                syscall::bf_reg_vals_t mut_regs{};
+                constexpr auto vsid{0_u16};
+                constexpr auto num{1_u64};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_unsupported};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_regs.front().reg = static_cast<bsl::uint64>(reg);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{write_reg_vals(
+                            mut_tls, mut_intrinsic, mut_vs_pool, vsid, mut_regs, num)};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS != ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write_reg_vals write fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                syscall::bf_reg_vals_t mut_regs{};
+                constexpr auto vsid{0_u16};
+                constexpr auto num{1_u64};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_regs.front().reg = static_cast<bsl::uint64>(reg);
+                    mut_tls.test_ret = UNIT_TEST_VS_FAIL_WRITE;
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{write_reg_vals(
+                            mut_tls, mut_intrinsic, mut_vs_pool, vsid, mut_regs, num)};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS != ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"SET_EXIT_INFO_IDX_VAL invalid vsid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_SET_EXIT_INFO_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto vsid{syscall::BF_INVALID_ID};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = bsl::to_u64(vsid).get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"SET_EXIT_INFO_IDX_VAL invalid regs #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_SET_EXIT_INFO_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = {};
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"SET_EXIT_INFO_IDX_VAL invalid num"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_SET_EXIT_INFO_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto num{
+                    (syscall::BF_MAX_EXIT_INFO + bsl::safe_u64::magic_1()).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(HYPERVISOR_EXT_PAGE_POOL_ADDR).get();
+                    mut_tls.ext_reg3 = num.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"SET_EXIT_INFO_IDX_VAL regs not owned"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_SET_EXIT_INFO_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = bsl::to_u64(HYPERVISOR_EXT_PAGE_POOL_ADDR).get();
+                    mut_tls.ext_reg3 = bsl::safe_u64::magic_1().get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.test_ret = bsl::errc_failure;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_exit_info_regs"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                syscall::bf_reg_vals_t mut_regs{};
+                constexpr auto vsid{0_u16};
+                constexpr auto num{1_u64};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_regs.front().reg = static_cast<bsl::uint64>(reg);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{set_exit_info_regs(mut_vs_pool, vsid, mut_regs, num)};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(num == bsl::to_u64(mut_vs_pool.exit_info(vsid).size()));
+                        bsl::ut_check(reg == mut_vs_pool.exit_info(vsid).reg({}));
+                    };
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{set_exit_info_regs(mut_vs_pool, vsid, mut_regs, {})};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(mut_vs_pool.exit_info(vsid).empty());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"set_exit_info_regs invalid reg"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                syscall::bf_reg_vals_t mut_regs{};
+                constexpr auto vsid{0_u16};
+                constexpr auto num{1_u64};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_unsupported};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_regs.front().reg = static_cast<bsl::uint64>(reg);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const ret{set_exit_info_regs(mut_vs_pool, vsid, mut_regs, num)};
+                        bsl::ut_check(syscall::BF_STATUS_SUCCESS != ret);
+                        bsl::ut_check(mut_vs_pool.exit_info(vsid).empty());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"RUN_IDX_VAL"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 tls_t mut_tls{};
@@ -1803,6 +2805,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(bsl::to_u64(mut_tls.run_fast_path_hits).is_zero());
+                        bsl::ut_check(1_u64 == bsl::to_u64(mut_tls.run_fast_path_misses));
                     };
                 };
             };
@@ -1851,6 +2855,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(1_u64 == bsl::to_u64(mut_tls.run_fast_path_hits));
+                        bsl::ut_check(bsl::to_u64(mut_tls.run_fast_path_misses).is_zero());
                     };
                 };
             };
@@ -2751,6 +3757,9 @@ namespace mk
                     mut_tls.online_pps = bsl::to_u16(online_pps).get();
                     mut_tls.ext_syscall = syscall.get();
                     mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.active_vmid = syscall::BF_INVALID_ID.get();
+                    mut_tls.active_vpid = syscall::BF_INVALID_ID.get();
+                    mut_tls.active_vsid = syscall::BF_INVALID_ID.get();
                     mut_vm_pool.initialize();
                     mut_vp_pool.initialize();
                     mut_vs_pool.initialize();
@@ -2769,6 +3778,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(bsl::to_u64(mut_tls.run_fast_path_hits).is_zero());
+                        bsl::ut_check(1_u64 == bsl::to_u64(mut_tls.run_fast_path_misses));
                     };
                 };
             };
@@ -2817,6 +3828,8 @@ namespace mk
                                 mut_vp_pool,
                                 mut_vs_pool,
                                 mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(1_u64 == bsl::to_u64(mut_tls.run_fast_path_hits));
+                        bsl::ut_check(bsl::to_u64(mut_tls.run_fast_path_misses).is_zero());
                     };
                 };
             };
@@ -6314,6 +7327,282 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"TLB_FLUSH_RANGE_IDX_VAL by page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto num_pages{HYPERVISOR_TLB_FLUSH_THRESHOLD};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = num_pages.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(1_u64 == bsl::to_u64(mut_tls.tlb_flush_range_pages));
+                        bsl::ut_check(bsl::to_u64(mut_tls.tlb_flush_range_full).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"TLB_FLUSH_RANGE_IDX_VAL by vs"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto num_pages{(HYPERVISOR_TLB_FLUSH_THRESHOLD + 1_u64).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = num_pages.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) == syscall::BF_STATUS_SUCCESS);
+                        bsl::ut_check(bsl::to_u64(mut_tls.tlb_flush_range_pages).is_zero());
+                        bsl::ut_check(1_u64 == bsl::to_u64(mut_tls.tlb_flush_range_full));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"TLB_FLUSH_RANGE_IDX_VAL invalid vsid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto vsid{syscall::BF_INVALID_ID};
+                constexpr auto num_pages{1_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg1 = bsl::to_u64(vsid).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_tls.ext_reg3 = num_pages.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"TLB_FLUSH_RANGE_IDX_VAL invalid gla"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto gla{42_u64};
+                constexpr auto num_pages{1_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = gla.get();
+                    mut_tls.ext_reg3 = num_pages.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"TLB_FLUSH_RANGE_IDX_VAL invalid num pages #1"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = HYPERVISOR_PAGE_SIZE.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"TLB_FLUSH_RANGE_IDX_VAL invalid num pages #2"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vm_pool_t mut_vm_pool{};
+                vp_pool_t mut_vp_pool{};
+                vs_pool_t mut_vs_pool{};
+                ext_pool_t mut_ext_pool{};
+                ext_t mut_ext{};
+                constexpr auto syscall{syscall::BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL};
+                constexpr auto online_pps{0x2_u16};
+                constexpr auto gla{0xFFFFFFFFFFFFF000_u64};
+                constexpr auto num_pages{2_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext = &mut_ext;
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.online_pps = bsl::to_u16(online_pps).get();
+                    mut_tls.ext_syscall = syscall.get();
+                    mut_tls.ext_reg0 = bsl::to_u64(mut_ext.open_handle()).get();
+                    mut_tls.ext_reg2 = gla.get();
+                    mut_tls.ext_reg3 = num_pages.get();
+                    mut_vm_pool.initialize();
+                    mut_vp_pool.initialize();
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(mut_vp_pool.allocate(mut_tls, {}));
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            dispatch_syscall_bf_vs_op(
+                                mut_tls,
+                                mut_page_pool,
+                                mut_intrinsic,
+                                mut_vm_pool,
+                                mut_vp_pool,
+                                mut_vs_pool,
+                                mut_ext_pool) != syscall::BF_STATUS_SUCCESS);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -73,8 +73,10 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_ext.start(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.bootstrap(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.dump({}, {})));
+                static_assert(noexcept(mut_ext.dump_locks()));
 
                 static_assert(noexcept(ext.dump({}, {})));
+                static_assert(noexcept(ext.dump_locks()));
             };
         };
     };
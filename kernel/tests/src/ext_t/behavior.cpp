@@ -30,6 +30,8 @@
 #include <bf_constants.hpp>
 #include <bfelf/elf64_ehdr_t.hpp>
 #include <bfelf/elf64_phdr_t.hpp>
+#include <errc_types.hpp>
+#include <fast_path_t.hpp>
 #include <huge_pool_t.hpp>
 #include <intrinsic_t.hpp>
 #include <mk_args_t.hpp>
@@ -742,6 +744,43 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"fast_path"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                constexpr auto key{42_u64};
+                constexpr auto val{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.fast_path(mut_tls).empty());
+                    };
+
+                    bsl::ut_required_step(mut_ext.add_fast_path(
+                        mut_tls, syscall::BF_FAST_PATH_CPUID, key, val, val));
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const *const prule{
+                            mut_ext.fast_path(mut_tls).find(syscall::BF_FAST_PATH_CPUID, key)};
+                        bsl::ut_required_step(nullptr != prule);
+                        bsl::ut_check(val == prule->val0);
+                        bsl::ut_check(val == prule->val1);
+                    };
+
+                    mut_tls.ppid = bsl::safe_u16::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.fast_path(mut_tls).empty());
+                    };
+
+                    mut_tls.ppid = {};
+                    mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.fast_path(mut_tls).empty());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"handle"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
@@ -811,6 +850,40 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"is_page_owned"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                lib::l0e_t mut_l0e{};
+                constexpr auto page_virt{HYPERVISOR_EXT_PAGE_POOL_ADDR};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.is_page_owned(mut_tls, mut_page_pool, page_virt));
+                    };
+
+                    mut_tls.test_ents.l0e = &mut_l0e;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.is_page_owned(mut_tls, mut_page_pool, page_virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"alloc_page fails"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
@@ -1038,6 +1111,127 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"free_huge"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                constexpr auto size{0x2000_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    auto const page1{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                    auto const page2{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(page1.virt.is_valid());
+                        bsl::ut_check(page2.virt.is_valid());
+                        bsl::ut_check(mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, page1.virt));
+                        bsl::ut_check(!mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, page1.virt));
+                        auto const page3{
+                            mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                        bsl::ut_check(page3.virt.is_valid());
+                        bsl::ut_check(mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, page2.virt));
+                        bsl::ut_check(mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, page3.virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_huge shootdown times out"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                constexpr auto size{0x2000_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    auto const page1{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                    auto const page2{
+                        mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(page1.virt.is_valid());
+                        bsl::ut_check(page2.virt.is_valid());
+                        mut_tls.test_ret = tlb_shootdown_timeout;
+                        bsl::ut_check(mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, page1.virt));
+                        auto const page3{
+                            mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                        bsl::ut_check(page3.virt.is_invalid());
+                        mut_tls.test_ret = bsl::errc_success;
+                        auto const page4{
+                            mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, size)};
+                        bsl::ut_check(page4.virt.is_valid());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"free_huge unknown address"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                constexpr auto virt{(HYPERVISOR_EXT_HUGE_POOL_ADDR + 0x1000_u64).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.free_huge(
+                            mut_tls, mut_page_pool, mut_huge_pool, intrinsic, virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"map_page_direct"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
@@ -1168,6 +1362,147 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"unmap_page_direct_broadcast"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    bsl::ut_required_step(
+                        mut_ext.map_page_direct(mut_tls, mut_page_pool, {}, phys));
+                    mut_tls.test_ents.l0e = &mut_l0e;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.unmap_page_direct_broadcast(
+                            mut_tls, mut_page_pool, intrinsic, {}, virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page_direct_broadcast unmap fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_tls.test_ents.l0e = &mut_l0e;
+                    mut_tls.test_virt = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_ext.unmap_page_direct_broadcast(
+                            mut_tls, mut_page_pool, intrinsic, {}, virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page_direct_broadcast already unmapped"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_tls.test_virt = virt.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_ext.unmap_page_direct_broadcast(
+                            mut_tls, mut_page_pool, intrinsic, {}, virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_page_direct_broadcast shootdown times out"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t const intrinsic{};
+                lib::l0e_t mut_l0e{};
+                constexpr auto phys{0x1000_umx};
+                constexpr auto virt{(HYPERVISOR_EXT_DIRECT_MAP_ADDR + phys).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_tls.test_ents.l0e = &mut_l0e;
+                    mut_tls.test_ret = tlb_shootdown_timeout;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            tlb_shootdown_timeout ==
+                            mut_ext.unmap_page_direct_broadcast(
+                                mut_tls, mut_page_pool, intrinsic, {}, virt));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"signal_vm_created"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
@@ -1280,6 +1615,52 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"enter/leave direct map"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                auto const elf_file_buf{get_elf_file_buf()};
+                loader::ext_elf_file_t mut_file{};
+                phdr_table_t mut_phdr_table{};
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                huge_pool_t mut_huge_pool{};
+                root_page_table_t mut_rpt{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    load_elf_file(mut_file, mut_phdr_table);
+                    load_phdr_table(mut_phdr_table, elf_file_buf);
+                    bsl::ut_required_step(
+                        mut_ext.initialize(mut_tls, mut_page_pool, {}, &mut_file, mut_rpt));
+                    bsl::ut_required_step(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {}));
+                    mut_ext.signal_vm_active(mut_tls, mut_intrinsic, {});
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.leave_direct_map(mut_tls);
+                        mut_ext.enter_direct_map(mut_tls, mut_intrinsic);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_ext.release(mut_tls, mut_page_pool, mut_huge_pool);
+                        clr_elf_file_buf(elf_file_buf);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"enter/leave direct map invalid active vmid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                ext_t mut_ext{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.active_vmid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_ext.leave_direct_map(mut_tls);
+                        mut_ext.enter_direct_map(mut_tls, mut_intrinsic);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"start"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 auto const elf_file_buf{get_elf_file_buf()};
@@ -73,36 +73,48 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_ext.set_vmexit_ip({})));
                 static_assert(noexcept(mut_ext.fail_ip()));
                 static_assert(noexcept(mut_ext.set_fail_ip({})));
+                static_assert(noexcept(mut_ext.fast_path(mut_tls)));
+                static_assert(noexcept(mut_ext.add_fast_path(mut_tls, {}, {}, {}, {})));
                 static_assert(noexcept(mut_ext.open_handle()));
                 static_assert(noexcept(mut_ext.close_handle()));
                 static_assert(noexcept(mut_ext.is_handle_valid({})));
                 static_assert(noexcept(mut_ext.handle()));
                 static_assert(noexcept(mut_ext.is_started()));
                 static_assert(noexcept(mut_ext.is_executing_fail()));
+                static_assert(noexcept(mut_ext.is_page_owned(mut_tls, mut_page_pool, {})));
                 static_assert(noexcept(mut_ext.alloc_page(mut_tls, mut_page_pool)));
                 static_assert(
                     noexcept(mut_ext.alloc_huge(mut_tls, mut_page_pool, mut_huge_pool, {})));
+                static_assert(noexcept(
+                    mut_ext.free_huge(mut_tls, mut_page_pool, mut_huge_pool, mut_intrinsic, {})));
                 static_assert(noexcept(mut_ext.map_page_direct(mut_tls, mut_page_pool, {}, {})));
                 static_assert(
                     noexcept(mut_ext.unmap_page_direct(mut_tls, mut_page_pool, {}, {}, {})));
+                static_assert(noexcept(
+                    mut_ext.unmap_page_direct_broadcast(mut_tls, mut_page_pool, {}, {}, {})));
                 static_assert(noexcept(mut_ext.signal_vm_created(mut_tls, mut_page_pool, {})));
                 static_assert(noexcept(mut_ext.signal_vm_destroyed(mut_tls, mut_page_pool, {})));
                 static_assert(noexcept(mut_ext.signal_vm_active(mut_tls, mut_intrinsic, {})));
+                static_assert(noexcept(mut_ext.enter_direct_map(mut_tls, mut_intrinsic)));
+                static_assert(noexcept(mut_ext.leave_direct_map(mut_tls)));
                 static_assert(noexcept(mut_ext.start(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.bootstrap(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_ext.vmexit(mut_tls, mut_intrinsic, {})));
                 static_assert(noexcept(mut_ext.fail(mut_tls, mut_intrinsic, {}, {})));
                 static_assert(noexcept(mut_ext.dump({})));
+                static_assert(noexcept(mut_ext.dump_locks()));
 
                 static_assert(noexcept(ext.id()));
                 static_assert(noexcept(ext.bootstrap_ip()));
                 static_assert(noexcept(ext.vmexit_ip()));
                 static_assert(noexcept(ext.fail_ip()));
+                static_assert(noexcept(ext.fast_path(mut_tls)));
                 static_assert(noexcept(ext.is_handle_valid({})));
                 static_assert(noexcept(ext.handle()));
                 static_assert(noexcept(ext.is_started()));
                 static_assert(noexcept(ext.is_executing_fail()));
                 static_assert(noexcept(ext.dump({})));
+                static_assert(noexcept(ext.dump_locks()));
             };
         };
     };
@@ -93,6 +93,135 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"allocate more than the pool"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                constexpr auto size{(POOL_SIZE + 1_umx).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.allocate({}, size).is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate a size that is not a power of two"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                constexpr auto size{3_umx};
+                auto const expected1{(size * HYPERVISOR_PAGE_SIZE).checked()};
+                auto const expected2{(POOL_SIZE * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto const alloc1{mut_huge_pool.allocate({}, size)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(alloc1.size() == size);
+                        bsl::ut_check(mut_huge_pool.allocated({}) == expected1);
+                        bsl::ut_check(mut_huge_pool.largest({}) == HYPERVISOR_PAGE_SIZE);
+                    };
+
+                    auto const alloc2{mut_huge_pool.allocate({}, 1_umx)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(alloc2.is_valid());
+                        bsl::ut_check(mut_huge_pool.allocated({}) == expected2);
+                    };
+
+                    mut_huge_pool.deallocate({}, alloc1);
+                    mut_huge_pool.deallocate({}, alloc2);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.allocated({}).is_zero());
+                        bsl::ut_check(mut_huge_pool.largest({}) == expected2);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate then allocate reuses memory"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto const alloc1{mut_huge_pool.allocate({}, POOL_SIZE)};
+                    mut_huge_pool.deallocate({}, alloc1);
+                    auto const alloc2{mut_huge_pool.allocate({}, POOL_SIZE)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(alloc1.is_valid());
+                        bsl::ut_check(alloc2.is_valid());
+                        bsl::ut_check(alloc1.data() == alloc2.data());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_huge_pool.deallocate({}, alloc2);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate merges buddies"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                constexpr auto size{1_umx};
+                auto const expected{(POOL_SIZE * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto const alloc1{mut_huge_pool.allocate({}, size)};
+                    auto const alloc2{mut_huge_pool.allocate({}, size)};
+                    auto const alloc3{mut_huge_pool.allocate({}, size)};
+                    auto const alloc4{mut_huge_pool.allocate({}, size)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.largest({}).is_zero());
+                    };
+
+                    mut_huge_pool.deallocate({}, alloc2);
+                    mut_huge_pool.deallocate({}, alloc3);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.largest({}) == HYPERVISOR_PAGE_SIZE);
+                    };
+
+                    mut_huge_pool.deallocate({}, alloc1);
+                    mut_huge_pool.deallocate({}, alloc4);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.largest({}) == expected);
+                        bsl::ut_check(mut_huge_pool.remaining({}) == expected);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate invalid memory"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                constexpr auto size{2_umx};
+                auto const expected{(size * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    auto const alloc{mut_huge_pool.allocate({}, size)};
+                    mut_huge_pool.deallocate({}, {});
+                    mut_huge_pool.deallocate({}, alloc.subspan(bsl::safe_idx::magic_1(), 1_umx));
+                    mut_huge_pool.deallocate({}, mut_view.subspan({}, 1_umx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.allocated({}) == expected);
+                    };
+
+                    mut_huge_pool.deallocate({}, alloc);
+                    mut_huge_pool.deallocate({}, alloc);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_huge_pool.allocated({}).is_zero());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"size"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 huge_pool_t mut_huge_pool{};
@@ -211,13 +340,31 @@ namespace mk
                 };
             };
 
+            bsl::ut_given{} = [&]() noexcept {
+                huge_pool_t mut_huge_pool{};
+                bsl::array<page_4k_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                constexpr auto size{1_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_huge_pool.initialize(mut_view);
+                    bsl::discard(mut_huge_pool.allocate({}, size));
+                    auto const alloc{mut_huge_pool.allocate({}, size)};
+                    bsl::discard(mut_huge_pool.allocate({}, size));
+                    mut_huge_pool.deallocate({}, alloc);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_huge_pool.dump({});
+                    };
+                };
+            };
+
             bsl::ut_given_at_runtime{} = [&]() noexcept {
                 huge_pool_t mut_huge_pool{};
                 bsl::span mut_view{g_mut_pool};
                 constexpr auto size{2_umx};
+                constexpr auto count{(HUGE_POOL_MAX_PAGES / size).checked()};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_huge_pool.initialize(mut_view);
-                    for (bsl::safe_idx mut_i{}; mut_i < 2048_umx; ++mut_i) {
+                    for (bsl::safe_idx mut_i{}; mut_i < count; ++mut_i) {
                         bsl::discard(mut_huge_pool.allocate({}, size));
                     }
                     bsl::ut_then{} = [&]() noexcept {
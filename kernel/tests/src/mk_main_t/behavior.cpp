@@ -40,6 +40,7 @@
 #include <root_page_table_t.hpp>
 #include <state_save_t.hpp>
 #include <tls_t.hpp>
+#include <trace_ring_t.hpp>
 #include <vm_pool_t.hpp>
 #include <vm_t.hpp>
 #include <vmexit_log_t.hpp>
@@ -60,6 +61,8 @@ namespace mk
     loader::state_save_t g_mut_root_vp_state{};
     /// @brief stores the debug_ring for this test
     loader::debug_ring_t g_mut_debug_ring{};
+    /// @brief stores the trace_ring for this test
+    loader::trace_ring_t g_mut_trace_ring{};
     /// @brief stores the ext_elf_file for this test
     loader::ext_elf_file_t const g_ext_elf_file{};
     /// @brief stores the rpt for this test
@@ -108,6 +111,7 @@ namespace mk
         mut_args.mk_state = &g_mut_mk_state;
         mut_args.root_vp_state = &g_mut_root_vp_state;
         mut_args.debug_ring = &g_mut_debug_ring;
+        mut_args.trace_ring = &g_mut_trace_ring;
         mut_args.ext_elf_files.front() = &g_ext_elf_file;
         mut_args.rpt = &g_mut_rpt;
         mut_args.rpt_phys = HYPERVISOR_PAGE_SIZE.get();
@@ -169,6 +173,7 @@ namespace mk
                             mut_system_rpt,
                             mut_log,
                             mut_args));
+                        bsl::ut_check(&g_mut_trace_ring == mut_tls.trace_ring);
                     };
 
                     mut_tls.ppid = bsl::safe_u16::magic_1().get();
@@ -0,0 +1,259 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#include "../../../src/tlb_shootdown_t.hpp"
+
+#include <intrinsic_t.hpp>
+#include <root_page_table_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// @brief defines the number of online PPs used by the tests
+    constexpr auto NUM_ONLINE_PPS{2_u16};
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"activate"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_rpt{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_shootdown.activate(mut_tls, mut_intrinsic, mut_rpt);
+                        bsl::ut_check(!mut_rpt.is_inactive(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"enter nothing queued"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_rpt{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_shootdown.enter(mut_tls, mut_intrinsic, mut_rpt);
+                        mut_shootdown.leave(mut_tls);
+                        bsl::ut_check(mut_rpt.is_inactive(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"enter invalidates queued addresses"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_rpt{};
+                constexpr auto virt{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, {}));
+                    for (bsl::safe_idx mut_i{}; mut_i < TLB_SHOOTDOWN_QUEUE_SIZE; ++mut_i) {
+                        bsl::ut_check(mut_shootdown.queue(mut_tls, virt).is_pos());
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_shootdown.enter(mut_tls, mut_intrinsic, mut_rpt);
+                        mut_shootdown.leave(mut_tls);
+                        bsl::ut_check(mut_rpt.is_inactive(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"enter flushes everything when too far behind"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_rpt{};
+                constexpr auto virt{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, {}));
+                    for (bsl::safe_idx mut_i{}; mut_i <= TLB_SHOOTDOWN_QUEUE_SIZE; ++mut_i) {
+                        bsl::ut_check(mut_shootdown.queue(mut_tls, virt).is_pos());
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_shootdown.enter(mut_tls, mut_intrinsic, mut_rpt);
+                        mut_shootdown.leave(mut_tls);
+                        bsl::ut_check(!mut_rpt.is_inactive(mut_tls));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"queue returns the next generation"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(1_u64 == mut_shootdown.queue(mut_tls, virt));
+                    bsl::ut_check(2_u64 == mut_shootdown.queue(mut_tls, virt));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"wait on a PP that is not exposed"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls{};
+                constexpr auto virt{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls.online_pps = NUM_ONLINE_PPS.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gen{mut_shootdown.queue(mut_tls, virt)};
+                        bsl::ut_check(mut_shootdown.wait(mut_tls, gen));
+                        bsl::ut_check(mut_shootdown.is_acked(mut_tls, gen));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"wait on a PP that is exposed and caught up"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_rpt{};
+                constexpr auto virt{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls0.online_pps = NUM_ONLINE_PPS.get();
+                    mut_tls1.online_pps = NUM_ONLINE_PPS.get();
+                    mut_tls1.ppid = bsl::safe_u16::magic_1().get();
+                    auto const gen{mut_shootdown.queue(mut_tls0, virt)};
+                    mut_shootdown.enter(mut_tls1, mut_intrinsic, mut_rpt);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_shootdown.wait(mut_tls0, gen));
+                        bsl::ut_check(mut_shootdown.is_acked(mut_tls0, gen));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_shootdown.leave(mut_tls1);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"wait on a PP that is exposed and never catches up"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_rpt{};
+                constexpr auto virt{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls1, {}));
+                    mut_tls0.online_pps = NUM_ONLINE_PPS.get();
+                    mut_tls1.online_pps = NUM_ONLINE_PPS.get();
+                    mut_tls1.ppid = bsl::safe_u16::magic_1().get();
+                    mut_shootdown.enter(mut_tls1, mut_intrinsic, mut_rpt);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gen{mut_shootdown.queue(mut_tls0, virt)};
+                        bsl::ut_check(!mut_shootdown.wait(mut_tls0, gen));
+                        bsl::ut_check(!mut_shootdown.is_acked(mut_tls0, gen));
+                        mut_shootdown.enter(mut_tls1, mut_intrinsic, mut_rpt);
+                        bsl::ut_check(mut_shootdown.is_acked(mut_tls0, gen));
+                        bsl::ut_check(mut_rpt.is_inactive(mut_tls1));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_shootdown.leave(mut_tls1);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"queue_flush_all flushes everything on enter"} = [&]() noexcept {
+            bsl::ut_given_at_runtime{} = [&]() noexcept {
+                tlb_shootdown_t mut_shootdown{};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                intrinsic_t mut_intrinsic{};
+                root_page_table_t mut_rpt{};
+                constexpr auto virt{0x1000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls1, {}));
+                    mut_tls0.online_pps = NUM_ONLINE_PPS.get();
+                    mut_tls1.online_pps = NUM_ONLINE_PPS.get();
+                    mut_tls1.ppid = bsl::safe_u16::magic_1().get();
+                    mut_shootdown.enter(mut_tls1, mut_intrinsic, mut_rpt);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto const gen{mut_shootdown.queue_flush_all(mut_tls0)};
+                        bsl::ut_check(gen > TLB_SHOOTDOWN_QUEUE_SIZE);
+                        bsl::ut_check(!mut_shootdown.is_acked(mut_tls0, gen));
+                        mut_shootdown.enter(mut_tls1, mut_intrinsic, mut_rpt);
+                        bsl::ut_check(mut_shootdown.is_acked(mut_tls0, gen));
+                        bsl::ut_check(!mut_rpt.is_inactive(mut_tls1));
+                        bsl::ut_check(mut_shootdown.queue(mut_tls0, virt) > gen);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_shootdown.leave(mut_tls1);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
@@ -0,0 +1,131 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/trace_ring_write.hpp"
+
+#include <trace_record_t.hpp>
+#include <trace_ring_t.hpp>
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace mk
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"trace_ring_write"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                loader::trace_ring_t mut_ring{};
+                loader::trace_record_t mut_rec{};
+                constexpr auto tsc0{42_u64};
+                constexpr auto tsc1{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_rec.tsc = tsc0.get();
+                    trace_ring_write(mut_ring, mut_rec);
+                    mut_rec.tsc = tsc1.get();
+                    trace_ring_write(mut_ring, mut_rec);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(2_u64 == mut_ring.epos);
+                        bsl::ut_check(0_u64 == mut_ring.spos);
+                        bsl::ut_check(0_u64 == mut_ring.dropped);
+                        bsl::ut_check(tsc0 == mut_ring.buf.at_if(0_idx)->tsc);
+                        bsl::ut_check(tsc1 == mut_ring.buf.at_if(1_idx)->tsc);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace_ring_write wraps"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                loader::trace_ring_t mut_ring{};
+                loader::trace_record_t mut_rec{};
+                constexpr auto pos{3_u64};
+                constexpr auto tsc0{42_u64};
+                constexpr auto tsc1{23_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ring.epos = pos.get();
+                    mut_ring.spos = pos.get();
+                    mut_rec.tsc = tsc0.get();
+                    trace_ring_write(mut_ring, mut_rec);
+                    mut_rec.tsc = tsc1.get();
+                    trace_ring_write(mut_ring, mut_rec);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check((pos + 2_u64).checked() == mut_ring.epos);
+                        bsl::ut_check(0_u64 == mut_ring.dropped);
+                        bsl::ut_check(tsc0 == mut_ring.buf.at_if(3_idx)->tsc);
+                        bsl::ut_check(tsc1 == mut_ring.buf.at_if(0_idx)->tsc);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace_ring_write drops when full"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                loader::trace_ring_t mut_ring{};
+                loader::trace_record_t mut_rec{};
+                constexpr auto tsc{42_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_ring.epos = HYPERVISOR_TRACE_RING_SIZE;
+                    mut_rec.tsc = tsc.get();
+                    trace_ring_write(mut_ring, mut_rec);
+                    trace_ring_write(mut_ring, mut_rec);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(HYPERVISOR_TRACE_RING_SIZE == mut_ring.epos);
+                        bsl::ut_check(2_u64 == mut_ring.dropped);
+                        bsl::ut_check(0_u64 == mut_ring.buf.at_if(0_idx)->tsc);
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(mk::tests() == bsl::ut_success());
+    return mk::tests();
+}
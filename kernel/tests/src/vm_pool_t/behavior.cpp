@@ -169,6 +169,54 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"allocate after allocate fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vm_pool_t mut_vm_pool{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                ext_pool_t mut_ext_pool{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm_pool.initialize();
+                    mut_tls.test_ret = UNIT_TEST_VM_FAIL_ALLOCATE;
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool).is_invalid());
+                    mut_tls.test_ret = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool).is_zero());
+                        bsl::ut_check(mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                        bsl::ut_check(mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool)
+                                          .is_invalid());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate after deallocate"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vm_pool_t mut_vm_pool{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                ext_pool_t mut_ext_pool{};
+                constexpr auto vmid{1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vm_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_required_step(
+                        mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_vm_pool.deallocate(mut_tls, mut_page_pool, mut_ext_pool, vmid);
+                        mut_vm_pool.deallocate(mut_tls, mut_page_pool, mut_ext_pool, vmid);
+                        bsl::ut_check(
+                            vmid == mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool));
+                        bsl::ut_check(mut_vm_pool.allocate(mut_tls, mut_page_pool, mut_ext_pool)
+                                          .is_invalid());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"deallocate without allocate"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vm_pool_t mut_vm_pool{};
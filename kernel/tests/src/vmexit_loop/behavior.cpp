@@ -24,18 +24,25 @@
 
 #include "../../../src/vmexit_loop.hpp"
 
+#include <bf_constants.hpp>
+#include <errc_types.hpp>
 #include <ext_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <tls_t.hpp>
+#include <trace_ring_t.hpp>
 #include <vmexit_log_t.hpp>
 #include <vs_pool_t.hpp>
 
 #include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
 #include <bsl/ut.hpp>
 
 namespace mk
 {
+    /// @brief stores an exit reason that the mocks never return
+    constexpr auto FAST_PATH_UNUSED_EXIT{0x42_u64};
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -64,7 +71,7 @@ namespace mk
                         mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
                     mut_tls.test_ret = bsl::errc_failure;
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!vmexit_loop(mut_tls, mut_intrinsic, mut_vs_pool, mut_log));
+                        bsl::ut_check(!vmexit_loop(mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_log));
                     };
                 };
             };
@@ -86,7 +93,101 @@ namespace mk
                         mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
                     mut_tls.test_ret = {};
                     bsl::ut_then{} = [&]() noexcept {
-                        bsl::ut_check(!vmexit_loop(mut_tls, mut_intrinsic, mut_vs_pool, mut_log));
+                        bsl::ut_check(!vmexit_loop(mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_log));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmexit_loop fast path handles the exit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                vmexit_log_t mut_log{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    bsl::ut_required_step(mut_ext.add_fast_path(
+                        mut_tls, syscall::BF_FAST_PATH_ADVANCE_IP, {}, {}, {}));
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.test_ret = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!vmexit_loop(mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_log));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmexit_loop fast path does not match"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                vmexit_log_t mut_log{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    bsl::ut_required_step(mut_ext.add_fast_path(
+                        mut_tls, syscall::BF_FAST_PATH_ADVANCE_IP, FAST_PATH_UNUSED_EXIT, {}, {}));
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.test_ret = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!vmexit_loop(mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_log));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmexit_loop advance ip"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                vmexit_log_t mut_log{};
+                ext_t mut_ext{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.test_ret = vmexit_success_advance_ip;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!vmexit_loop(mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_log));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmexit_loop with a trace ring"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vs_pool_t mut_vs_pool{};
+                vmexit_log_t mut_log{};
+                ext_t mut_ext{};
+                loader::trace_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ext.initialize({}, {}, {}, {}, {}));
+                    mut_tls.ext_vmexit = &mut_ext;
+                    mut_tls.trace_ring = &mut_ring;
+                    mut_vs_pool.initialize();
+                    bsl::ut_required_step(
+                        mut_vs_pool.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_tls.test_ret = {};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!vmexit_loop(mut_tls, mut_page_pool, mut_intrinsic, mut_vs_pool, mut_log));
                     };
                 };
             };
@@ -136,6 +136,24 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"allocate after deallocate"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vp_pool_t mut_vp_pool{};
+                constexpr auto vpid{1_u16};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vp_pool.initialize();
+                    bsl::ut_required_step(mut_vp_pool.allocate({}, {}));
+                    bsl::ut_required_step(mut_vp_pool.allocate({}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_vp_pool.deallocate({}, vpid);
+                        mut_vp_pool.deallocate({}, vpid);
+                        bsl::ut_check(vpid == mut_vp_pool.allocate({}, {}));
+                        bsl::ut_check(mut_vp_pool.allocate({}, {}).is_invalid());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"deallocate without allocate"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vp_pool_t mut_vp_pool{};
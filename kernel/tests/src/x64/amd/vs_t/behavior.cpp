@@ -26,10 +26,13 @@
 
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <exit_info_t.hpp>
+#include <fast_path_t.hpp>
 #include <intrinsic_t.hpp>
 #include <page_pool_t.hpp>
 #include <state_save_t.hpp>
 #include <tls_t.hpp>
+#include <trace_ring_t.hpp>
 #include <vmexit_log_t.hpp>
 
 #include <bsl/convert.hpp>
@@ -40,6 +43,41 @@
 
 namespace mk
 {
+    /// @brief stores the CPUID exit reason used by the fast path tests
+    constexpr auto FP_EXIT_CPUID{0x72_umx};
+    /// @brief stores the RDMSR exit reason used by the fast path tests
+    constexpr auto FP_EXIT_RDMSR{0x7C_umx};
+    /// @brief stores the WRMSR exit reason used by the fast path tests
+    constexpr auto FP_EXIT_WRMSR{0x7C_umx};
+    /// @brief stores the exitinfo1 of a WRMSR used by the fast path tests
+    constexpr auto FP_WRMSR{0x1_u64};
+    /// @brief stores the HLT exit code used by the fast path tests
+    constexpr auto FP_EXIT_OTHER{0x78_umx};
+    /// @brief stores the NPF exit code used by the fast path tests
+    constexpr auto FP_EXIT_EVENT{0x400_umx};
+    /// @brief stores the CPUID leaf used by the fast path tests
+    constexpr auto FP_LEAF{0x40000000_u64};
+    /// @brief stores the CPUID subleaf used by the fast path tests
+    constexpr auto FP_SUBLEAF{0x1_u64};
+    /// @brief stores the CPUID leaf/subleaf key used by the fast path tests
+    constexpr auto FP_EXACT{FP_LEAF | (FP_SUBLEAF << 32_u64)};
+    /// @brief stores the CPUID any subleaf key used by the fast path tests
+    constexpr auto FP_ANY{FP_LEAF | (syscall::BF_FAST_PATH_CPUID_ANY_SUBLEAF << 32_u64)};
+    /// @brief stores the MSR used by the fast path tests
+    constexpr auto FP_MSR{0x10_u64};
+    /// @brief stores the first value used by the fast path tests
+    constexpr auto FP_VAL0{0x2222222211111111_u64};
+    /// @brief stores the second value used by the fast path tests
+    constexpr auto FP_VAL1{0x4444444433333333_u64};
+    /// @brief stores the lower 32 bits of FP_VAL0
+    constexpr auto FP_LO0{0x11111111_u64};
+    /// @brief stores the upper 32 bits of FP_VAL0
+    constexpr auto FP_HI0{0x22222222_u64};
+    /// @brief stores the lower 32 bits of FP_VAL1
+    constexpr auto FP_LO1{0x33333333_u64};
+    /// @brief stores the upper 32 bits of FP_VAL1
+    constexpr auto FP_HI1{0x44444444_u64};
+
     /// <!-- description -->
     ///   @brief Used to execute the actual checks. We put the checks in this
     ///     function so that we can validate the tests both at compile-time
@@ -565,8 +603,6 @@ namespace mk
                             mut_tls, mut_intrinsic, reg_t::bf_reg_t_pause_filter_threshold, val));
                         bsl::ut_check(!mut_vs.write(
                             mut_tls, mut_intrinsic, reg_t::bf_reg_t_pause_filter_count, val));
-                        bsl::ut_check(
-                            !mut_vs.write(mut_tls, mut_intrinsic, reg_t::bf_reg_t_guest_asid, val));
                         bsl::ut_check(!mut_vs.write(
                             mut_tls, mut_intrinsic, reg_t::bf_reg_t_tlb_control, val));
                         bsl::ut_check(!mut_vs.write(
@@ -664,6 +700,258 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"run with a trace ring"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vmexit_log_t mut_log{};
+                loader::trace_ring_t mut_ring{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    mut_tls.trace_ring = &mut_ring;
+                    mut_tls.trace_rec.vsid = syscall::BF_INVALID_ID.get();
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(bsl::to_umx(mut_ring.epos).is_zero());
+                        bsl::ut_check(mut_tls.active_vsid == mut_tls.trace_rec.vsid);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"run publishes exit info"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vmexit_log_t mut_log{};
+                exit_info_t mut_info{};
+                constexpr auto bad_reg{static_cast<syscall::bf_reg_t>(121)};
+                constexpr auto offs0{syscall::TLS_OFFSET_EXIT_INFO};
+                constexpr auto offs1{(syscall::TLS_OFFSET_EXIT_INFO + 8_u64).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_info.add(syscall::bf_reg_t::bf_reg_t_rax));
+                    bsl::ut_required_step(mut_info.add(bad_reg));
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, 42_u64);
+                    mut_intrinsic.set_tls_reg(offs1, 23_u64);
+                    mut_vs.set_exit_info(mut_info);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.exit_info().size() == mut_info.size());
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(42_u64 == mut_intrinsic.tls_reg(offs0));
+                        bsl::ut_check(mut_intrinsic.tls_reg(offs1).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"vmcb clean bits"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vmexit_log_t mut_log{};
+                constexpr auto reg{syscall::bf_reg_t::bf_reg_t_vmcb_clean_bits};
+                constexpr auto all{bsl::to_u64(VMCB_CLEAN_BITS_ALL)};
+                constexpr auto crx{bsl::to_u64(VMCB_CLEAN_BITS_CRX)};
+                constexpr auto seg{bsl::to_u64(VMCB_CLEAN_BITS_SEG)};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.read(mut_tls, mut_intrinsic, reg).is_zero());
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(all == mut_vs.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(mut_vs.write(
+                            mut_tls, mut_intrinsic, syscall::bf_reg_t::bf_reg_t_cr3, {}));
+                        bsl::ut_check((all & ~crx) == mut_vs.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(mut_vs.write(
+                            mut_tls, mut_intrinsic, syscall::bf_reg_t::bf_reg_t_cs_base, {}));
+                        bsl::ut_check(
+                            (all & ~crx & ~seg) == mut_vs.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(mut_vs.write(
+                            mut_tls, mut_intrinsic, syscall::bf_reg_t::bf_reg_t_rip, {}));
+                        bsl::ut_check(
+                            (all & ~crx & ~seg) == mut_vs.read(mut_tls, mut_intrinsic, reg));
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(all == mut_vs.read(mut_tls, mut_intrinsic, reg));
+                        mut_vs.migrate(mut_tls, mut_intrinsic, {});
+                        bsl::ut_check(mut_vs.read(mut_tls, mut_intrinsic, reg).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"run assigns an asid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vmexit_log_t mut_log{};
+                constexpr auto asid{syscall::bf_reg_t::bf_reg_t_guest_asid};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.read(mut_tls, mut_intrinsic, asid).is_zero());
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(1_u64 == mut_vs.read(mut_tls, mut_intrinsic, asid));
+                        bsl::ut_check(mut_vs.write(mut_tls, mut_intrinsic, asid, 42_u64));
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(1_u64 == mut_vs.read(mut_tls, mut_intrinsic, asid));
+                        bsl::ut_check(1_u64 == mut_tls.vs_tag_generation);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"run assigns each vs its own asid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs0{};
+                vs_t mut_vs1{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vmexit_log_t mut_log{};
+                constexpr auto asid{syscall::bf_reg_t::bf_reg_t_guest_asid};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs0.initialize(0_u16);
+                    mut_vs1.initialize(1_u16);
+                    bsl::ut_required_step(
+                        mut_vs0.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(
+                        mut_vs1.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs0.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(mut_vs1.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(mut_vs0.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(1_u64 == mut_vs0.read(mut_tls, mut_intrinsic, asid));
+                        bsl::ut_check(2_u64 == mut_vs1.read(mut_tls, mut_intrinsic, asid));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs0.release(mut_tls, mut_page_pool);
+                        mut_vs1.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"migrate and deallocate drop the asid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vmexit_log_t mut_log{};
+                constexpr auto asid{syscall::bf_reg_t::bf_reg_t_guest_asid};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_vs.migrate(mut_tls, mut_intrinsic, {});
+                        bsl::ut_check(mut_vs.read(mut_tls, mut_intrinsic, asid).is_zero());
+                        bsl::ut_check(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(2_u64 == mut_vs.read(mut_tls, mut_intrinsic, asid));
+                        mut_vs.deallocate(mut_tls, mut_page_pool);
+                        bsl::ut_check(
+                            mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                        bsl::ut_check(mut_vs.read(mut_tls, mut_intrinsic, asid).is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"asid generation rollover"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs0{};
+                vs_t mut_vs1{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                vmexit_log_t mut_log{};
+                constexpr auto asid{syscall::bf_reg_t::bf_reg_t_guest_asid};
+                constexpr auto nasid{3_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs0.initialize(0_u16);
+                    mut_vs1.initialize(1_u16);
+                    mut_intrinsic.set_nasid(nasid);
+                    bsl::ut_required_step(
+                        mut_vs0.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(
+                        mut_vs1.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs0.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(mut_vs1.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(2_u64 == mut_vs1.read(mut_tls, mut_intrinsic, asid));
+                        mut_vs0.migrate(mut_tls, mut_intrinsic, {});
+                        bsl::ut_check(mut_vs0.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(1_u64 == mut_vs0.read(mut_tls, mut_intrinsic, asid));
+                        bsl::ut_check(2_u64 == mut_tls.vs_tag_generation);
+                        bsl::ut_check(mut_vs1.run(mut_tls, mut_intrinsic, mut_log));
+                        bsl::ut_check(2_u64 == mut_vs1.read(mut_tls, mut_intrinsic, asid));
+                        bsl::ut_check(2_u64 == mut_tls.vs_tag_generation);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs0.release(mut_tls, mut_page_pool);
+                        mut_vs1.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate clears exit info"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                exit_info_t mut_info{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_info.add(syscall::bf_reg_t::bf_reg_t_rax));
+                    mut_vs.set_exit_info(mut_info);
+                    mut_vs.deallocate(mut_tls, mut_page_pool);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.exit_info().empty());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"advance_ip"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -684,6 +972,238 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"handle_fast_path no rules"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, FP_LEAF);
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, FP_SUBLEAF);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, FP_EXIT_CPUID));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path cpuid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(
+                        mut_rules.add(syscall::BF_FAST_PATH_CPUID, FP_EXACT, FP_VAL0, FP_VAL1));
+                    bsl::ut_required_step(
+                        mut_rules.add(syscall::BF_FAST_PATH_CPUID, FP_ANY, {}, {}));
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, FP_LEAF);
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, FP_SUBLEAF);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, FP_EXIT_CPUID));
+                        bsl::ut_check(FP_LO0 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RAX));
+                        bsl::ut_check(FP_HI0 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RBX));
+                        bsl::ut_check(FP_LO1 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RCX));
+                        bsl::ut_check(FP_HI1 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RDX));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path cpuid any subleaf"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(
+                        mut_rules.add(syscall::BF_FAST_PATH_CPUID, FP_ANY, FP_VAL0, FP_VAL1));
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, FP_LEAF);
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, FP_SUBLEAF);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, FP_EXIT_CPUID));
+                        bsl::ut_check(FP_LO0 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RAX));
+                        bsl::ut_check(FP_HI0 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RBX));
+                        bsl::ut_check(FP_LO1 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RCX));
+                        bsl::ut_check(FP_HI1 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RDX));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path cpuid no match"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(
+                        mut_rules.add(syscall::BF_FAST_PATH_CPUID, FP_LEAF, FP_VAL0, FP_VAL1));
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, FP_LEAF);
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, FP_SUBLEAF);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, FP_EXIT_CPUID));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path rdmsr"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(
+                        mut_rules.add(syscall::BF_FAST_PATH_RDMSR, FP_MSR, {}, {}));
+                    bsl::ut_required_step(mut_intrinsic.wrmsr(bsl::to_u32(FP_MSR), FP_VAL0));
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, FP_MSR);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, FP_EXIT_RDMSR));
+                        bsl::ut_check(FP_LO0 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RAX));
+                        bsl::ut_check(FP_HI0 == mut_intrinsic.tls_reg(syscall::TLS_OFFSET_RDX));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path wrmsr"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(
+                        mut_rules.add(syscall::BF_FAST_PATH_WRMSR, FP_MSR, {}, {}));
+                    bsl::ut_required_step(mut_vs.write(
+                        mut_tls, mut_intrinsic, syscall::bf_reg_t::bf_reg_t_exitinfo1, FP_WRMSR));
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RCX, FP_MSR);
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RAX, FP_LO0);
+                    mut_intrinsic.set_tls_reg(syscall::TLS_OFFSET_RDX, FP_HI0);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, FP_EXIT_WRMSR));
+                        bsl::ut_check(FP_VAL0 == mut_intrinsic.rdmsr(bsl::to_u32(FP_MSR)));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path advance_ip"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_rules.add(
+                        syscall::BF_FAST_PATH_ADVANCE_IP, bsl::to_u64(FP_EXIT_OTHER), {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, FP_EXIT_OTHER));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"handle_fast_path advance_ip event exit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vs_t mut_vs{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                intrinsic_t mut_intrinsic{};
+                fast_path_t mut_rules{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_vs.initialize({});
+                    bsl::ut_required_step(
+                        mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
+                    bsl::ut_required_step(mut_rules.add(
+                        syscall::BF_FAST_PATH_ADVANCE_IP, bsl::to_u64(FP_EXIT_EVENT), {}, {}));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vs.handle_fast_path(
+                            mut_tls, mut_intrinsic, mut_rules, FP_EXIT_EVENT));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_vs.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"is_instruction_exit"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(vs_t::is_instruction_exit(FP_EXIT_CPUID));
+                    bsl::ut_check(vs_t::is_instruction_exit(FP_EXIT_RDMSR));
+                    bsl::ut_check(vs_t::is_instruction_exit(FP_EXIT_WRMSR));
+                    bsl::ut_check(vs_t::is_instruction_exit(FP_EXIT_OTHER));
+                    bsl::ut_check(!vs_t::is_instruction_exit(FP_EXIT_EVENT));
+                    bsl::ut_check(!vs_t::is_instruction_exit(0x60_umx));
+                    bsl::ut_check(!vs_t::is_instruction_exit(bsl::safe_umx::max_value()));
+                };
+            };
+        };
+
         bsl::ut_scenario{"clear"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 vs_t mut_vs{};
@@ -710,17 +1230,16 @@ namespace mk
                 tls_t mut_tls{};
                 page_pool_t mut_page_pool{};
                 intrinsic_t mut_intrinsic{};
-                constexpr auto asid{1_u64};
-                using reg_t = syscall::bf_reg_t;
+                vmexit_log_t mut_log{};
                 bsl::ut_when{} = [&]() noexcept {
                     mut_vs.initialize({});
                     bsl::ut_required_step(
                         mut_vs.allocate(mut_tls, mut_page_pool, mut_intrinsic, {}, {}, {}));
-                    bsl::ut_required_step(
-                        mut_vs.write(mut_tls, mut_intrinsic, reg_t::bf_reg_t_guest_asid, asid));
+                    bsl::ut_required_step(mut_vs.run(mut_tls, mut_intrinsic, mut_log));
                     bsl::ut_then{} = [&]() noexcept {
                         mut_vs.tlb_flush(mut_tls, mut_intrinsic);
                         mut_vs.tlb_flush(mut_tls, mut_intrinsic, HYPERVISOR_PAGE_SIZE);
+                        mut_vs.tlb_flush_all(mut_tls, mut_intrinsic);
                     };
                     bsl::ut_cleanup{} = [&]() noexcept {
                         mut_vs.release(mut_tls, mut_page_pool);
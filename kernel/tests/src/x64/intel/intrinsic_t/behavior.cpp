@@ -61,6 +61,25 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"tlb_flush_vpid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                constexpr auto vpid{0x1_u16};
+                bsl::ut_then{} = [&]() noexcept {
+                    intrinsic.tlb_flush_vpid(vpid);
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tlb_flush_all_vpids"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                intrinsic_t const intrinsic{};
+                bsl::ut_then{} = [&]() noexcept {
+                    intrinsic.tlb_flush_all_vpids();
+                };
+            };
+        };
+
         bsl::ut_scenario{"es_selector"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 intrinsic_t const intrinsic{};
@@ -90,9 +90,14 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_vs.write(mut_tls, mut_intrinsic, {}, {})));
                 static_assert(noexcept(mut_vs.run(mut_tls, mut_intrinsic, mut_log)));
                 static_assert(noexcept(mut_vs.advance_ip(mut_tls, mut_intrinsic)));
+                static_assert(noexcept(mut_vs.handle_fast_path(mut_tls, mut_intrinsic, {}, {})));
+                static_assert(noexcept(vs_t::is_instruction_exit({})));
+                static_assert(noexcept(mut_vs.set_exit_info({})));
+                static_assert(noexcept(mut_vs.exit_info()));
                 static_assert(noexcept(mut_vs.clear(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_vs.tlb_flush(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_vs.tlb_flush(mut_tls, mut_intrinsic, {})));
+                static_assert(noexcept(mut_vs.tlb_flush_all(mut_tls, mut_intrinsic)));
                 static_assert(noexcept(mut_vs.dump(mut_tls, mut_intrinsic)));
 
                 static_assert(noexcept(vs.id()));
@@ -104,6 +109,7 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(vs.assigned_vp()));
                 static_assert(noexcept(vs.assigned_pp()));
                 static_assert(noexcept(vs.read(mut_tls, mut_intrinsic, {})));
+                static_assert(noexcept(vs.exit_info()));
                 static_assert(noexcept(vs.dump(mut_tls, mut_intrinsic)));
             };
         };
@@ -25,6 +25,7 @@
 #include "../../../../src/x64/vmexit_log_t.hpp"
 
 #include <vmexit_log_record_t.hpp>
+#include <vmexit_stats_record_t.hpp>
 
 #include <bsl/convert.hpp>
 #include <bsl/safe_idx.hpp>
@@ -100,6 +101,77 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"add_stats"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmexit_log_t mut_log{};
+                constexpr auto ppid0{0x0_u16};
+                constexpr auto ppid1{0x1_u16};
+                constexpr auto reason0{0x0_u64};
+                constexpr auto reason1{0x1_u64};
+                constexpr auto alias{(reason1 + bsl::to_u64(VMEXIT_STATS_SIZE)).checked()};
+                constexpr auto large{0xFFFFFFFFFFFFFFFF_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_log.add_stats(ppid0, reason0, {});
+                    mut_log.add_stats(ppid0, reason0, bsl::safe_u64::magic_1());
+                    mut_log.add_stats(ppid0, reason1, large);
+                    mut_log.add_stats(ppid0, alias, {});
+                    mut_log.add_stats(ppid1, alias, {});
+                };
+            };
+        };
+
+        bsl::ut_scenario{"add_stats large exit reasons"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmexit_log_t mut_log{};
+                constexpr auto ppid0{0x0_u16};
+                constexpr auto reason0{0x21_u64};
+                constexpr auto reason1{0x80000021_u64};
+                constexpr auto reason2{0x400_u64};
+                constexpr auto reason3{0xFFFFFFFFFFFFFFFF_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_log.add_stats(ppid0, reason0, {});
+                    mut_log.add_stats(ppid0, reason1, {});
+                    mut_log.add_stats(ppid0, reason2, {});
+                    mut_log.add_stats(ppid0, reason3, {});
+                    mut_log.add_stats(ppid0, reason1, {});
+                };
+            };
+        };
+
+        bsl::ut_scenario{"add_stats table full"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmexit_log_t mut_log{};
+                constexpr auto ppid0{0x0_u16};
+                constexpr auto loops{(VMEXIT_STATS_SIZE + bsl::safe_umx::magic_1()).checked()};
+                bsl::ut_then{} = [&]() noexcept {
+                    for (bsl::safe_idx mut_i{}; mut_i < loops; ++mut_i) {
+                        mut_log.add_stats(ppid0, bsl::to_u64(mut_i), {});
+                    }
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump_stats"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                vmexit_log_t mut_log{};
+                constexpr auto ppid0{0x0_u16};
+                constexpr auto ppid1{0x1_u16};
+                constexpr auto loops{(VMEXIT_STATS_SIZE + bsl::safe_umx::magic_1()).checked()};
+                constexpr auto cycles{0x100_u64};
+                bsl::ut_then{} = [&]() noexcept {
+                    mut_log.dump_stats(ppid0);
+                    mut_log.dump_stats(ppid1);
+
+                    for (bsl::safe_idx mut_i{}; mut_i < loops; ++mut_i) {
+                        mut_log.add_stats(ppid0, bsl::to_u64(mut_i), cycles);
+                    }
+
+                    mut_log.dump_stats(ppid0);
+                    mut_log.dump_stats(ppid1);
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
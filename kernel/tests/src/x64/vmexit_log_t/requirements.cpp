@@ -57,8 +57,11 @@ main() noexcept -> bsl::exit_code
 
                 static_assert(noexcept(mut_log.add({}, {})));
                 static_assert(noexcept(mut_log.dump({})));
+                static_assert(noexcept(mut_log.add_stats({}, {}, {})));
+                static_assert(noexcept(mut_log.dump_stats({})));
 
                 static_assert(noexcept(log.dump({})));
+                static_assert(noexcept(log.dump_stats({})));
             };
         };
     };
@@ -0,0 +1,134 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef BASIC_FREE_ID_STACK_T_HPP
+#define BASIC_FREE_ID_STACK_T_HPP
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Stores the IDs in [0, N) that are not in use so that a
+    ///     pool can allocate and deallocate an ID without having to search
+    ///     for one. IDs are handed out from lowest to highest after
+    ///     initialize() is called, and the most recently pushed ID is
+    ///     always the next one popped.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam N the total number of IDs. Cannot be 0
+    ///
+    template<bsl::uintmx N>
+    class basic_free_id_stack_t final
+    {
+        /// @brief stores the IDs that are not in use
+        bsl::array<bsl::safe_u16, N> m_ids{};
+        /// @brief stores the number of IDs that are not in use
+        bsl::safe_idx m_size{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Marks every ID as not in use.
+        ///
+        constexpr void
+        initialize() noexcept
+        {
+            auto mut_id{bsl::to_u16(m_ids.size())};
+            for (auto &mut_elem : m_ids) {
+                --mut_id;
+                mut_elem = mut_id.checked();
+            }
+
+            m_size = bsl::to_idx(m_ids.size());
+        }
+
+        /// <!-- description -->
+        ///   @brief Marks every ID as in use.
+        ///
+        constexpr void
+        release() noexcept
+        {
+            m_size = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Removes an ID from the stack and returns it. If every
+        ///     ID is already in use, returns bsl::safe_u16::failure().
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Removes an ID from the stack and returns it. If every
+        ///     ID is already in use, returns bsl::safe_u16::failure().
+        ///
+        [[nodiscard]] constexpr auto
+        pop() noexcept -> bsl::safe_u16
+        {
+            if (bsl::unlikely(this->empty())) {
+                return bsl::safe_u16::failure();
+            }
+
+            --m_size;
+            return *m_ids.at_if(m_size);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns an ID previously returned by pop() to the
+        ///     stack.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param id the ID to return to the stack
+        ///
+        constexpr void
+        push(bsl::safe_u16 const &id) noexcept
+        {
+            bsl::expects(id.is_valid_and_checked());
+            bsl::expects(bsl::to_umx(id) < m_ids.size());
+            bsl::expects(bsl::to_umx(m_size) < m_ids.size());
+
+            *m_ids.at_if(m_size) = id;
+            ++m_size;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if every ID is in use. Returns false
+        ///     otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if every ID is in use. Returns false
+        ///     otherwise.
+        ///
+        [[nodiscard]] constexpr auto
+        empty() const noexcept -> bool
+        {
+            return m_size.is_zero();
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,339 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_LOCK_STATS_T_HPP
+#define BASIC_LOCK_STATS_T_HPP
+
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+#ifdef HYPERVISOR_DEBUG_LOCK_STATS
+    /// @brief set to true if the locks should record contention statistics
+    constexpr bool BASIC_LOCK_STATS_ENABLED{HYPERVISOR_DEBUG_LOCK_STATS};
+#else
+    /// @brief set to true if the locks should record contention statistics
+    constexpr bool BASIC_LOCK_STATS_ENABLED{};
+#endif
+
+    /// <!-- description -->
+    ///   @brief Stores the contention and hold time statistics of a single
+    ///     lock. Hold times are measured using the TSC, and as a result are
+    ///     reported in cycles. All of the statistics are only ever written
+    ///     to by the PP that currently owns the lock, which means that no
+    ///     atomics are needed. Reading the statistics while the lock is in
+    ///     use (i.e., while dumping them) can produce slightly stale
+    ///     results, which is fine for debugging.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam ENABLED if false, this class is empty and does nothing
+    ///
+    template<bool ENABLED = BASIC_LOCK_STATS_ENABLED>
+    class basic_lock_stats_t final
+    {
+        /// @brief stores the total number of times the lock was acquired
+        bsl::safe_u64 m_acquisitions{};
+        /// @brief stores the number of times the lock was already held
+        bsl::safe_u64 m_contended{};
+        /// @brief stores the total number of times a PP spun on the lock
+        bsl::safe_u64 m_spins{};
+        /// @brief stores the TSC of the last time the lock was acquired
+        bsl::safe_u64 m_hold_start{};
+        /// @brief stores the total number of cycles the lock was held for
+        bsl::safe_u64 m_hold_total{};
+        /// @brief stores the max number of cycles the lock was held for
+        bsl::safe_u64 m_hold_max{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Records that the lock was acquired.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param contended true if the lock was held by another PP
+        ///   @param spins the number of times the PP spun on the lock
+        ///   @param tsc the current value of the TSC
+        ///
+        constexpr void
+        acquired(
+            bool const contended, bsl::safe_u64 const &spins, bsl::safe_u64 const &tsc) noexcept
+        {
+            ++m_acquisitions;
+            if (contended) {
+                ++m_contended;
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_spins += spins;
+            m_hold_start = tsc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Records that the lock was released.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc the current value of the TSC
+        ///
+        constexpr void
+        released(bsl::safe_u64 const &tsc) noexcept
+        {
+            if (bsl::unlikely(tsc < m_hold_start)) {
+                return;
+            }
+
+            auto const hold{(tsc - m_hold_start).checked()};
+            m_hold_total += hold;
+
+            if (hold > m_hold_max) {
+                m_hold_max = hold;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times the lock was acquired
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times the lock was acquired
+        ///
+        [[nodiscard]] constexpr auto
+        acquisitions() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_acquisitions;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of times the lock was acquired while
+        ///     it was held by another PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of times the lock was acquired while
+        ///     it was held by another PP.
+        ///
+        [[nodiscard]] constexpr auto
+        contended() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_contended;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times a PP spun on the lock
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times a PP spun on the lock
+        ///
+        [[nodiscard]] constexpr auto
+        spins() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_spins;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of cycles the lock was held for
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of cycles the lock was held for
+        ///
+        [[nodiscard]] constexpr auto
+        hold_total() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_hold_total;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the max number of cycles the lock was held for
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the max number of cycles the lock was held for
+        ///
+        [[nodiscard]] constexpr auto
+        hold_max() const noexcept -> bsl::safe_u64 const &
+        {
+            return m_hold_max;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the header of the table that dump() adds rows
+        ///     to. This should be called before dumping any locks.
+        ///
+        static constexpr void
+        dump_header() noexcept
+        {
+            bsl::print() << bsl::mag << "lock stats dump: ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+--------------------------------------";
+            bsl::print() << bsl::ylw << "---------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^16s", "lock "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "acquired "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "contended "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "spins "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "hold avg "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^10s", "hold max "};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+--------------------------------------";
+            bsl::print() << bsl::ylw << "---------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the footer of the table that dump() adds rows
+        ///     to. This should be called after all locks are dumped.
+        ///
+        static constexpr void
+        dump_footer() noexcept
+        {
+            bsl::print() << bsl::ylw << "+--------------------------------------";
+            bsl::print() << bsl::ylw << "---------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of this lock as a single row
+        ///     in the table started by dump_header(). Locks that have never
+        ///     been acquired are not outputted.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param name the name of the lock being dumped
+        ///
+        constexpr void
+        dump(bsl::string_view const &name) const noexcept
+        {
+            if (m_acquisitions.is_zero()) {
+                return;
+            }
+
+            auto const avg{(m_hold_total / m_acquisitions).checked()};
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"<16s", name};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"10d", m_acquisitions};
+            bsl::print() << bsl::ylw << "| ";
+            if (m_contended.is_pos()) {
+                bsl::print() << bsl::ylw << bsl::fmt{"10d", m_contended};
+            }
+            else {
+                bsl::print() << bsl::rst << bsl::fmt{"10d", m_contended};
+            }
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"10d", m_spins};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"10d", avg};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::fmt{"10d", m_hold_max};
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::rst << bsl::endl;
+        }
+    };
+
+    /// <!-- description -->
+    ///   @brief Defines the basic_lock_stats_t that is used when lock
+    ///     statistics are disabled. This version stores nothing, and all
+    ///     of its functions compile away to nothing.
+    ///
+    template<>
+    class basic_lock_stats_t<false> final
+    {
+    public:
+        /// <!-- description -->
+        ///   @brief Does nothing
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param contended ignored
+        ///   @param spins ignored
+        ///   @param tsc ignored
+        ///
+        static constexpr void
+        acquired(
+            bool const contended, bsl::safe_u64 const &spins, bsl::safe_u64 const &tsc) noexcept
+        {
+            bsl::discard(contended);
+            bsl::discard(spins);
+            bsl::discard(tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Does nothing
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tsc ignored
+        ///
+        static constexpr void
+        released(bsl::safe_u64 const &tsc) noexcept
+        {
+            bsl::discard(tsc);
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the user that lock statistics are disabled.
+        ///
+        static constexpr void
+        dump_header() noexcept
+        {
+            bsl::print() << bsl::mag << "lock stats dump: ";
+            bsl::print() << bsl::rst << "disabled (see HYPERVISOR_DEBUG_LOCK_STATS)";
+            bsl::print() << bsl::endl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Does nothing
+        ///
+        static constexpr void
+        dump_footer() noexcept
+        {}
+
+        /// <!-- description -->
+        ///   @brief Does nothing
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param name ignored
+        ///
+        static constexpr void
+        dump(bsl::string_view const &name) noexcept
+        {
+            bsl::discard(name);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,50 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_MCS_LOCK_NODE_T_HPP
+#define BASIC_MCS_LOCK_NODE_T_HPP
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace lib
+{
+    /// @brief stores the alignment of a basic_mcs_lock_node_t (a cache line)
+    constexpr auto BASIC_MCS_LOCK_NODE_ALIGNMENT{64_umx};
+
+    /// <!-- description -->
+    ///   @brief Defines the queue node used by the basic_mcs_lock_t. Each
+    ///     node is given its own cache line so that a waiting PP only ever
+    ///     spins on memory that no other waiting PP touches.
+    ///
+    struct alignas(BASIC_MCS_LOCK_NODE_ALIGNMENT.get()) basic_mcs_lock_node_t final
+    {
+        /// @brief stores the node of the PP that is waiting behind this one
+        _Atomic(basic_mcs_lock_node_t *) next;
+        /// @brief stores true while the PP that owns this node must wait
+        _Atomic bool locked;
+    };
+}
+
+#endif
@@ -0,0 +1,74 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_PAGE_POOL_CACHE_T_HPP
+#define BASIC_PAGE_POOL_CACHE_T_HPP
+
+#include <basic_page_pool_node_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace lib
+{
+    /// @brief defines the max number of pages a PP's page cache can hold
+    constexpr auto BASIC_PAGE_POOL_CACHE_SIZE{64_umx};
+    /// @brief defines the number of pages moved to/from the global free list
+    constexpr auto BASIC_PAGE_POOL_CACHE_BATCH{32_umx};
+    /// @brief defines the max number of pre-zeroed pages a PP's cache can hold
+    constexpr auto BASIC_PAGE_POOL_ZEROED_SIZE{64_umx};
+
+    /// @brief make sure that a drain always leaves pages in the cache
+    static_assert(BASIC_PAGE_POOL_CACHE_BATCH < BASIC_PAGE_POOL_CACHE_SIZE);
+
+    /// <!-- description -->
+    ///   @brief Defines a per-PP page cache (i.e., a magazine) that sits in
+    ///     front of the basic_page_pool_t's global free list. Each PP only
+    ///     ever touches its own cache, which means that most allocations
+    ///     and deallocations do not need to take the pool's lock. Each
+    ///     cache has two lists: dirty pages which must be zeroed before
+    ///     they are handed out, and pages that were zeroed ahead of time.
+    ///
+    struct basic_page_pool_cache_t final
+    {
+        /// @brief stores the head of this PP's list of dirty pages
+        basic_page_pool_node_t *head;
+        /// @brief stores the total number of dirty pages in this PP's cache
+        bsl::safe_umx count;
+        /// @brief stores the head of this PP's list of pre-zeroed pages
+        basic_page_pool_node_t *zeroed;
+        /// @brief stores the total number of pre-zeroed pages in this PP's cache
+        bsl::safe_umx zeroed_count;
+        /// @brief stores the number of allocations served by the cache
+        bsl::safe_umx hits;
+        /// @brief stores the number of allocations that had to refill
+        bsl::safe_umx misses;
+        /// @brief stores the number of allocations given a pre-zeroed page
+        bsl::safe_umx prezeroed;
+        /// @brief stores the number of allocations that zeroed on demand
+        bsl::safe_umx on_demand;
+    };
+}
+
+#endif
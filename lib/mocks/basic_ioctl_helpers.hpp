@@ -28,6 +28,7 @@
 #include <dump_vmm_args_t.hpp>
 #include <start_vmm_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <trace_vmm_args_t.hpp>
 
 #include <bsl/debug.hpp>
 #include <bsl/expects.hpp>
@@ -51,6 +52,8 @@ namespace helpers
         loader::stop_vmm_args_t stop_vmm_args;
         /// @brief store a dump_vmm_args_t
         loader::dump_vmm_args_t dump_vmm_args;
+        /// @brief store a trace_vmm_args_t
+        loader::trace_vmm_args_t trace_vmm_args;
         /// @brief store a safe_i64
         bsl::int64 i64;
     };
@@ -83,6 +86,11 @@ namespace helpers
             return;
         }
 
+        if constexpr (bsl::is_same<bsl::remove_cvref_t<T>, loader::trace_vmm_args_t>::value) {
+            mut_store.trace_vmm_args = val;
+            return;
+        }
+
         if constexpr (bsl::is_same<bsl::remove_cvref_t<T>, bsl::safe_i64>::value) {
             mut_store.i64 = val.get();
             return;
@@ -117,6 +125,10 @@ namespace helpers
             return store.dump_vmm_args;
         }
 
+        if constexpr (bsl::is_same<bsl::remove_cvref_t<T>, loader::trace_vmm_args_t>::value) {
+            return store.trace_vmm_args;
+        }
+
         if constexpr (bsl::is_same<bsl::remove_cvref_t<T>, bsl::safe_i64>::value) {
             return T{store.i64};
         }
@@ -0,0 +1,107 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCK_BASIC_MCS_LOCK_T_HPP
+#define MOCK_BASIC_MCS_LOCK_T_HPP
+
+#include <basic_lock_stats_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Implements a mocked version of basic_mcs_lock_t
+    ///
+    /// <!-- notes -->
+    ///   @note Implements a basic_mcs_lock_t, a fair, queued lock that has
+    ///     the same interface as the basic_spinlock_t. PPs acquire the
+    ///     lock in the order that they asked for it, and each waiting PP
+    ///     spins on its own cache line.
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam MAX_PPS the max number of PPs that can use this lock
+    ///
+    template<bsl::uintmx MAX_PPS>
+    class basic_mcs_lock_t final
+    {
+        /// @brief stores whether or not the lock is locked.
+        bool m_flag{};
+        /// @brief stores the lock's statistics (always empty)
+        basic_lock_stats_t<> m_stats{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Locks the basic_mcs_lock_t. This will not return until
+        ///     the basic_mcs_lock_t can be successfully acquired.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_TYPE the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_TYPE>
+        constexpr void
+        lock(TLS_TYPE const &tls) noexcept
+        {
+            bsl::discard(tls);
+            m_flag = true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unlocks the basic_mcs_lock_t.
+        ///
+        constexpr void
+        unlock() noexcept
+        {
+            m_flag = false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the basic_mcs_lock_t is locked
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the basic_mcs_lock_t is locked
+        ///
+        [[nodiscard]] constexpr auto
+        is_locked() const noexcept -> bool
+        {
+            return m_flag;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the statistics recorded by this lock
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the statistics recorded by this lock
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> basic_lock_stats_t<> const &
+        {
+            return m_stats;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,158 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef MOCKS_BASIC_OFILE_T_HPP
+#define MOCKS_BASIC_OFILE_T_HPP
+
+#include <bsl/errc_type.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Opens a file as write-only (truncating whatever was there),
+    ///     and appends raw bytes to it via write().
+    ///
+    class basic_ofile_t final
+    {
+        /// @brief stores the number of bytes written to the file
+        bsl::safe_umx m_size{};
+        /// @brief stores whether or not the ofile should fail to open
+        bool m_failure{};
+        /// @brief stores whether or not write() should return an error
+        bool m_write_failure{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a lib::basic_ofile_t given a the filename and path
+        ///     of the file to open as write-only.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param filename the filename and path of the file to open
+        ///
+        explicit constexpr basic_ofile_t(bsl::string_view const &filename) noexcept
+        {
+            m_failure = filename.starts_with("failure");
+            m_write_failure = filename.starts_with("write_failure");
+        }
+
+        /// <!-- description -->
+        ///   @brief Destructor closes a previously opened file.
+        ///
+        constexpr ~basic_ofile_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr basic_ofile_t(basic_ofile_t const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr basic_ofile_t(basic_ofile_t &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(basic_ofile_t const &o) &noexcept
+            -> basic_ofile_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(basic_ofile_t &&mut_o) &noexcept
+            -> basic_ofile_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief Closes the file, releasing all of the resource back to
+        ///     the OS kernel.
+        ///
+        constexpr void
+        release() noexcept
+        {
+            m_size = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Appends size bytes from data to the file. The mock only
+        ///     counts the bytes that were written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param data a pointer to the bytes to write
+        ///   @param size the number of bytes to write
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write(void const *const data, bsl::safe_umx const &size) noexcept -> bsl::errc_type
+        {
+            if (m_failure || m_write_failure || nullptr == data) {
+                return bsl::errc_failure;
+            }
+
+            m_size += size;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the file was opened successfully
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the file was opened successfully
+        ///
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return !m_failure;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes written to the file.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes written to the file.
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> bsl::safe_umx
+        {
+            return m_size;
+        }
+    };
+}
+
+#endif
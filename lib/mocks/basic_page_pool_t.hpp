@@ -261,6 +261,36 @@ namespace lib
             m_phys_to_virt.at(phys) = {};
         }
 
+        /// <!-- description -->
+        ///   @brief Zeroes pages owned by the current PP ahead of time so
+        ///     that allocate() does not have to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param num the max number of pages to zero
+        ///
+        constexpr void
+        zero_pages(TLS_TYPE const &tls, bsl::safe_umx const &num) const noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(num);
+        }
+
+        /// <!-- description -->
+        ///   @brief Zeroes dirty pages that are already in the current PP's
+        ///     cache ahead of time so that allocate() does not have to.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param num the max number of pages to zero
+        ///
+        constexpr void
+        zero_cached_pages(TLS_TYPE const &tls, bsl::safe_umx const &num) const noexcept
+        {
+            bsl::discard(tls);
+            bsl::discard(num);
+        }
+
         /// <!-- description -->
         ///   @brief Returns the number of bytes in the pool.
         ///
@@ -355,6 +385,13 @@ namespace lib
         {
             bsl::discard(tls);
         }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the basic_page_pool_t's lock
+        ///
+        static constexpr void
+        dump_locks() noexcept
+        {}
     };
 }
 
@@ -43,11 +43,13 @@
 
 #include <basic_alloc_page_t.hpp>
 #include <basic_entries_t.hpp>
+#include <basic_lock_stats_t.hpp>
 #include <basic_page_1g_t.hpp>
 #include <basic_page_2m_t.hpp>
 #include <basic_page_4k_t.hpp>
 #include <basic_page_pool_t.hpp>
 #include <basic_page_table_t.hpp>
+#include <basic_range_status_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>
@@ -206,6 +208,8 @@ namespace lib
         bsl::array<helpers::page_pool_storage_t, RPT_MAX_ALLOCATIONS.get()> m_allocations{};
         /// @brief stores the index into m_allocations
         bsl::safe_idx m_allocations_idx{};
+        /// @brief stores the lock's statistics (always empty)
+        basic_lock_stats_t<> m_lock_stats{};
 
         /// <!-- description -->
         ///   @brief Returns true if the provided address is 1g page aligned.
@@ -529,6 +533,7 @@ namespace lib
         ///   @param tls the current TLS block
         ///   @param page_pool the page_pool_t to use
         ///   @param page_virt the virtual address to unmap
+        ///   @param sys the bf_syscall_t to use (optional)
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -537,12 +542,14 @@ namespace lib
         unmap(
             TLS_TYPE const &tls,
             PAGE_POOL_TYPE const &page_pool,
-            bsl::safe_u64 const &page_virt) noexcept -> bsl::errc_type
+            bsl::safe_u64 const &page_virt,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> bsl::errc_type
         {
             static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
 
             bsl::discard(tls);
             bsl::discard(page_pool);
+            bsl::discard(sys);
 
             bsl::expects(m_initialized);
             bsl::expects(page_virt.is_valid_and_checked());
@@ -566,6 +573,91 @@ namespace lib
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Maps a range of contiguous 4k pages into the root page
+        ///     table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the virtual address of the first page to map
+        ///   @param phys the physical address of the first page to map
+        ///   @param num_pages the total number of 4k pages to map
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param explicit_unmap tells the RPT that the virtual
+        ///     addresses must be explicitly unmapped before the RPT can be
+        ///     released. Otherwise the release will fail.
+        ///   @param sys the bf_syscall_t to use (optional)
+        ///   @return Returns a basic_range_status_t containing the number of
+        ///     pages that were mapped and bsl::errc_success on success.
+        ///
+        [[nodiscard]] constexpr auto
+        map_range(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &virt,
+            bsl::safe_u64 const &phys,
+            bsl::safe_umx const &num_pages,
+            bsl::safe_u64 const &page_flgs,
+            bool const explicit_unmap = false,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> basic_range_status_t
+        {
+            bsl::discard(page_pool);
+            bsl::discard(explicit_unmap);
+            bsl::discard(sys);
+
+            bsl::expects(m_initialized);
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(is_page_4k_aligned(virt));
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(is_page_4k_aligned(phys));
+            bsl::expects(num_pages.is_valid_and_checked());
+            bsl::expects(page_flgs.is_valid_and_checked());
+
+            if (tls.test_virt == virt) {
+                return {{}, bsl::errc_failure};
+            }
+
+            return {num_pages, bsl::errc_success};
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a range of contiguous 4k pages from the root page
+        ///     table. It is the caller's responsibility to flush the TLB as
+        ///     needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @param virt the virtual address of the first page to unmap
+        ///   @param num_pages the total number of 4k pages to unmap
+        ///   @param sys the bf_syscall_t to use (optional)
+        ///   @return Returns a basic_range_status_t containing the number of
+        ///     pages that were unmapped and bsl::errc_success on success.
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_range(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE const &page_pool,
+            bsl::safe_u64 const &virt,
+            bsl::safe_umx const &num_pages,
+            SYS_TYPE const &sys = bsl::dontcare) noexcept -> basic_range_status_t
+        {
+            bsl::discard(page_pool);
+            bsl::discard(sys);
+
+            bsl::expects(m_initialized);
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(is_page_4k_aligned(virt));
+            bsl::expects(num_pages.is_valid_and_checked());
+
+            if (tls.test_virt == virt) {
+                return {{}, bsl::errc_failure};
+            }
+
+            return {num_pages, bsl::errc_success};
+        }
+
         /// <!-- description -->
         ///   @brief Returns all of the entries that are identified during the
         ///     translation of the provided virtual address.
@@ -609,6 +701,27 @@ namespace lib
             return tls.test_ents;
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the number of pages that are being used to
+        ///     store the page tables of this root page table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @return Returns the number of pages that are being used to
+        ///     store the page tables of this root page table.
+        ///
+        [[nodiscard]] constexpr auto
+        tables(TLS_TYPE const &tls, PAGE_POOL_TYPE const &page_pool) const noexcept
+            -> bsl::safe_umx
+        {
+            bsl::discard(tls);
+            bsl::discard(page_pool);
+
+            bsl::expects(m_initialized);
+            return bsl::safe_umx::magic_1();
+        }
+
         /// <!-- description -->
         ///   @brief Given a root page table, the enties are aliased into
         ///     this root page table, allowing software using this root page
@@ -646,6 +759,20 @@ namespace lib
             bsl::discard(tls);
             bsl::discard(rpt);
         }
+
+        /// <!-- description -->
+        ///   @brief Returns the statistics recorded by the lock that
+        ///     protects this basic_root_page_table_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the statistics recorded by the lock that
+        ///     protects this basic_root_page_table_t.
+        ///
+        [[nodiscard]] constexpr auto
+        lock_stats() const noexcept -> basic_lock_stats_t<> const &
+        {
+            return m_lock_stats;
+        }
     };
 }
 
@@ -0,0 +1,140 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef MOCK_BASIC_RWLOCK_T_HPP
+#define MOCK_BASIC_RWLOCK_T_HPP
+
+#include <basic_lock_stats_t.hpp>
+
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Implements a mocked version of basic_rwlock_t
+    ///
+    /// <!-- notes -->
+    ///   @note Implements a basic_rwlock_t. A basic_rwlock_t can either be
+    ///     locked exclusively by a single PP, or it can be locked by any
+    ///     number of PPs at the same time for reading.
+    ///
+    class basic_rwlock_t final
+    {
+        /// @brief stores whether or not the lock is locked exclusively.
+        bool m_flag{};
+        /// @brief stores the number of times the lock is locked for reading.
+        bsl::safe_u64 m_readers{};
+        /// @brief stores the lock's statistics (always empty)
+        basic_lock_stats_t<> m_stats{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Locks the basic_rwlock_t exclusively.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_TYPE the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_TYPE>
+        constexpr void
+        lock(TLS_TYPE const &tls) noexcept
+        {
+            bsl::discard(tls);
+            m_flag = true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unlocks an exclusively locked basic_rwlock_t.
+        ///
+        constexpr void
+        unlock() noexcept
+        {
+            m_flag = false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Locks the basic_rwlock_t for reading.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_TYPE the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_TYPE>
+        constexpr void
+        lock_shared(TLS_TYPE const &tls) noexcept
+        {
+            bsl::discard(tls);
+            ++m_readers;
+        }
+
+        /// <!-- description -->
+        ///   @brief Unlocks a basic_rwlock_t that was locked for reading.
+        ///
+        constexpr void
+        unlock_shared() noexcept
+        {
+            --m_readers;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the basic_rwlock_t is locked exclusively
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the basic_rwlock_t is locked exclusively
+        ///
+        [[nodiscard]] constexpr auto
+        is_locked() const noexcept -> bool
+        {
+            return m_flag;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of times the lock is locked for reading
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of times the lock is locked for reading
+        ///
+        [[nodiscard]] constexpr auto
+        readers() const noexcept -> bsl::safe_u64
+        {
+            return m_readers;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the statistics recorded by this lock
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the statistics recorded by this lock
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> basic_lock_stats_t<> const &
+        {
+            return m_stats;
+        }
+    };
+}
+
+#endif
@@ -25,6 +25,8 @@
 #ifndef MOCK_BASIC_SPINLOCK_T_HPP
 #define MOCK_BASIC_SPINLOCK_T_HPP
 
+#include <basic_lock_stats_t.hpp>
+
 #include <bsl/discard.hpp>
 
 namespace lib
@@ -42,6 +44,8 @@ namespace lib
     {
         /// @brief stores whether or not the spin lock is locked.
         bool m_flag{};
+        /// @brief stores the lock's statistics (always empty)
+        basic_lock_stats_t<> m_stats{};
 
     public:
         /// <!-- description -->
@@ -80,6 +84,18 @@ namespace lib
         {
             return m_flag;
         }
+
+        /// <!-- description -->
+        ///   @brief Returns the statistics recorded by this lock
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the statistics recorded by this lock
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> basic_lock_stats_t<> const &
+        {
+            return m_stats;
+        }
     };
 }
 
@@ -0,0 +1,290 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_MCS_LOCK_T_HPP
+#define BASIC_MCS_LOCK_T_HPP
+
+#if __has_include("spinlock_helpers.hpp")
+#include <spinlock_helpers.hpp>    // IWYU pragma: export
+#endif
+
+#if __has_include("basic_spinlock_helpers.hpp")
+#include <basic_spinlock_helpers.hpp>    // IWYU pragma: export
+#endif
+
+// IWYU pragma: no_include "spinlock_helpers.hpp"
+// IWYU pragma: no_include "basic_spinlock_helpers.hpp"
+
+#include <basic_lock_stats_t.hpp>
+#include <basic_mcs_lock_node_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/touch.hpp>
+
+#pragma clang diagnostic ignored "-Watomic-implicit-seq-cst"
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Implements a basic_mcs_lock_t, a fair, queued lock that
+    ///     has the same interface as the basic_spinlock_t, and as a result
+    ///     can be used with the basic_lock_guard_t. Each PP that attempts
+    ///     to acquire the lock adds itself to the end of a queue and then
+    ///     spins on its own queue node. Unlike the basic_spinlock_t, PPs
+    ///     acquire the lock in the order that they asked for it, and when
+    ///     the lock is released, only the cache line of the next PP in the
+    ///     queue is written to. Like the basic_spinlock_t, this lock is
+    ///     aware of which PP has acquired the lock. If the same PP attempts
+    ///     to acquire the lock, the lock is ignored, and a warning is
+    ///     outputted. If HYPERVISOR_DEBUG_LOCK_STATS is enabled, the lock
+    ///     also records how often it is contended and how long it is held
+    ///     for (see basic_lock_stats_t).
+    ///
+    /// <!-- template parameters -->
+    ///   @tparam MAX_PPS the max number of PPs that can use this lock
+    ///
+    template<bsl::uintmx MAX_PPS>
+    class basic_mcs_lock_t final
+    {
+        /// @brief stores the ppid that currently owns the lock
+        bsl::safe_u16 m_ppid;
+        /// @brief stores the node at the end of the queue (nullptr if unlocked)
+        _Atomic(basic_mcs_lock_node_t *) m_tail;
+        /// @brief stores the queue node used by each PP
+        bsl::array<basic_mcs_lock_node_t, MAX_PPS> m_nodes;
+        /// @brief stores the lock's statistics (empty if disabled)
+        [[no_unique_address]] basic_lock_stats_t<> m_stats;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor.
+        ///
+        // We cannot member initialize atomics so this is not possible
+        // NOLINTNEXTLINE(bsl-class-member-init)
+        constexpr basic_mcs_lock_t() noexcept    // --
+            : m_ppid{}, m_stats{}
+        {
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_tail = nullptr;
+
+            for (auto &mut_node : m_nodes) {
+                // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+                mut_node.next = nullptr;
+                // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+                mut_node.locked = false;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Destructor
+        ///
+        constexpr ~basic_mcs_lock_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr basic_mcs_lock_t(basic_mcs_lock_t const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr basic_mcs_lock_t(basic_mcs_lock_t &&mut_o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(basic_mcs_lock_t const &o) &noexcept
+            -> basic_mcs_lock_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(basic_mcs_lock_t &&mut_o) &noexcept
+            -> basic_mcs_lock_t & = default;
+
+        /// <!-- description -->
+        ///   @brief Locks the basic_mcs_lock_t. This will not return until
+        ///     every PP that asked for the lock before this PP has released
+        ///     the lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_TYPE the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_TYPE>
+        constexpr void
+        lock(TLS_TYPE const &tls) noexcept
+        {
+            /// NOTE:
+            /// - Perform deadlock detection. If deadlock is detected, we
+            ///   return as it means that this PP has already acquired the
+            ///   lock with no means that unlock.
+            ///
+
+            if (tls.ppid == ~m_ppid) {
+                bsl::alert() << "pp "                                       // --
+                             << bsl::hex(tls.ppid)                          // --
+                             << " acquired the same lock more than once"    // --
+                             << bsl::endl;                                  // --
+
+                return;
+            }
+
+            auto *const pmut_node{m_nodes.at_if(bsl::to_idx(tls.ppid))};
+            bsl::expects(nullptr != pmut_node);
+
+            __c11_atomic_store(&pmut_node->next, nullptr, __ATOMIC_RELAXED);
+            __c11_atomic_store(&pmut_node->locked, true, __ATOMIC_RELAXED);
+
+            /// NOTE:
+            /// - The __c11_atomic_exchange adds this PP's node to the end
+            ///   of the queue. If the queue was empty, the lock is ours and
+            ///   there is nothing else to do. Otherwise, we link ourselves
+            ///   to the node that was in front of us, and then spin on our
+            ///   own node until the PP in front of us hands us the lock.
+            /// - Since each node has its own cache line, the spin below
+            ///   only reads memory that is local to this PP until it is
+            ///   written to by the PP that is handing us the lock, which
+            ///   is what prevents all of the waiting PPs from bouncing the
+            ///   same cache line back and forth.
+            ///
+
+            bsl::safe_u64 mut_spins{};
+
+            auto *const pmut_prev{__c11_atomic_exchange(&m_tail, pmut_node, __ATOMIC_ACQ_REL)};
+            if (nullptr != pmut_prev) {
+                __c11_atomic_store(&pmut_prev->next, pmut_node, __ATOMIC_RELEASE);
+                while (__c11_atomic_load(&pmut_node->locked, __ATOMIC_ACQUIRE)) {
+                    if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                        ++mut_spins;
+                    }
+
+                    helpers::yield();
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_ppid = ~bsl::to_u16(tls.ppid);
+
+            if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                m_stats.acquired(nullptr != pmut_prev, mut_spins, helpers::tsc());
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Unlocks the basic_mcs_lock_t, handing the lock to the
+        ///     next PP in the queue (if there is one).
+        ///
+        constexpr void
+        unlock() noexcept
+        {
+            auto *const pmut_node{m_nodes.at_if(bsl::to_idx(~m_ppid))};
+            bsl::expects(nullptr != pmut_node);
+
+            if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                m_stats.released(helpers::tsc());
+            }
+
+            m_ppid = {};
+
+            auto *mut_next{__c11_atomic_load(&pmut_node->next, __ATOMIC_ACQUIRE)};
+            if (nullptr == mut_next) {
+                /// NOTE:
+                /// - If no one is waiting behind us, the queue is emptied
+                ///   and we are done. If the __c11_atomic_compare_exchange
+                ///   fails, it means that another PP has added itself to
+                ///   the queue, but has not yet linked itself to our node,
+                ///   so we wait for that to happen before handing it the
+                ///   lock.
+                ///
+
+                basic_mcs_lock_node_t *mut_expected{pmut_node};
+                if (__c11_atomic_compare_exchange_strong(
+                        &m_tail, &mut_expected, nullptr, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+                    return;
+                }
+
+                mut_next = __c11_atomic_load(&pmut_node->next, __ATOMIC_ACQUIRE);
+                while (nullptr == mut_next) {
+                    helpers::yield();
+                    mut_next = __c11_atomic_load(&pmut_node->next, __ATOMIC_ACQUIRE);
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            __c11_atomic_store(&mut_next->locked, false, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the basic_mcs_lock_t is locked
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the basic_mcs_lock_t is locked
+        ///
+        [[nodiscard]] constexpr auto
+        is_locked() const noexcept -> bool
+        {
+            return nullptr != m_tail;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the statistics recorded by this lock. If
+        ///     HYPERVISOR_DEBUG_LOCK_STATS is disabled, the statistics
+        ///     are empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the statistics recorded by this lock
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> basic_lock_stats_t<> const &
+        {
+            return m_stats;
+        }
+    };
+}
+
+#endif
@@ -37,10 +37,12 @@
 // IWYU pragma: no_include "basic_page_pool_helpers.hpp"
 // IWYU pragma: no_include "basic_page_pool_node_t.hpp"
 
-#include <basic_lock_guard_t.hpp>        // IWYU pragma: keep
-#include <basic_page_pool_node_t.hpp>    // IWYU pragma: export
-#include <basic_spinlock_t.hpp>          // IWYU pragma: keep
+#include <basic_lock_guard_t.hpp>         // IWYU pragma: keep
+#include <basic_page_pool_cache_t.hpp>    // IWYU pragma: export
+#include <basic_page_pool_node_t.hpp>     // IWYU pragma: export
+#include <basic_spinlock_t.hpp>           // IWYU pragma: keep
 
+#include <bsl/array.hpp>
 #include <bsl/construct_at.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/cstring.hpp>
@@ -50,6 +52,7 @@
 #include <bsl/ensures.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/is_pod.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/span.hpp>
 #include <bsl/touch.hpp>
@@ -62,7 +65,13 @@ namespace lib
     ///      pages. The loader provides a linked list with the pages that
     ///      this code will allocate as requested. Each page exists in the
     ///      direct map, so all virt to phys translations of allocated pages
-    ///      can be done using simple arithmetic.
+    ///      can be done using simple arithmetic. To reduce contention on
+    ///      the pool's lock, each PP is given its own page cache. Most
+    ///      allocations and deallocations are served from this cache, and
+    ///      the global free list is only touched (in batches) when a PP's
+    ///      cache is either empty or full. Pages can also be zeroed ahead
+    ///      of time (see zero_pages()) so that allocate() can hand out an
+    ///      already zeroed page without having to memset it.
     ///
     /// <!-- template parameters -->
     ///   @tparam TLS_TYPE the type of TLS block to use
@@ -77,10 +86,14 @@ namespace lib
         basic_page_pool_node_t *m_head{};
         /// @brief stores the total number of bytes given to the basic_page_pool_t.
         bsl::safe_umx m_size{};
-        /// @brief stores the total number of bytes given to the basic_page_pool_t.
+        /// @brief stores the total number of bytes taken from the free list.
         bsl::safe_umx m_used{};
         /// @brief safe guards operations on the pool.
         mutable basic_spinlock_t m_lock{};
+        /// @brief stores each PP's page cache.
+        bsl::array<basic_page_pool_cache_t, HYPERVISOR_MAX_PPS.get()> m_caches{};
+        /// @brief safe guards each PP's page cache.
+        mutable bsl::array<basic_spinlock_t, HYPERVISOR_MAX_PPS.get()> m_cache_locks{};
 
         /// <!-- description -->
         ///   @brief Converts a virtual address to a physical address.
@@ -121,37 +134,473 @@ namespace lib
         }
 
         /// <!-- description -->
-        ///   @brief Returns the number of bytes allocated.
+        ///   @brief Returns the number of bytes sitting in the PP caches.
+        ///     Each cache is read while holding its lock. The caller must
+        ///     hold m_lock so that the result is consistent with m_used.
         ///
         /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the number of bytes sitting in the PP caches.
+        ///
+        [[nodiscard]] constexpr auto
+        cached(TLS_TYPE const &tls) const noexcept -> bsl::safe_umx
+        {
+            bsl::safe_umx mut_count{};
+            for (bsl::safe_idx mut_i{}; mut_i < m_caches.size(); ++mut_i) {
+                basic_lock_guard_t mut_lock{tls, *m_cache_locks.at_if(mut_i)};
+                auto const *const cache{m_caches.at_if(mut_i)};
+
+                mut_count += cache->count;
+                mut_count += cache->zeroed_count;
+            }
+
+            return (mut_count * HYPERVISOR_PAGE_SIZE).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes allocated. The caller must
+        ///     hold m_lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
         ///   @return Returns the number of bytes allocated.
         ///
         [[nodiscard]] constexpr auto
-        allocated() const noexcept -> bsl::safe_umx
+        allocated_locked(TLS_TYPE const &tls) const noexcept -> bsl::safe_umx
         {
             /// NOTE:
             /// - The following is marked checked because the allocation
-            ///   function ensures this math will never overflow.
+            ///   function ensures this math will never overflow. Pages
+            ///   that are sitting in a PP's cache were taken from the
+            ///   free list, but have not been allocated yet. Pages only
+            ///   move between the free list and a cache while holding
+            ///   m_lock, so m_used and the caches always agree here.
             ///
 
-            return m_used.checked();
+            return (m_used - this->cached(tls)).checked();
         }
 
         /// <!-- description -->
-        ///   @brief Returns this->size() - this->allocated().
+        ///   @brief Returns this->size() - this->allocated(). The caller
+        ///     must hold m_lock.
         ///
         /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
         ///   @return Returns this->size() - this->allocated().
         ///
         [[nodiscard]] constexpr auto
-        remaining() const noexcept -> bsl::safe_umx
+        remaining_locked(TLS_TYPE const &tls) const noexcept -> bsl::safe_umx
         {
             /// NOTE:
             /// - The following is marked checked because the allocation
             ///   function ensures this math will never overflow.
             ///
 
-            return (this->size() - this->allocated()).checked();
+            return (this->size() - this->allocated_locked(tls)).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the page cache owned by the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the page cache owned by the current PP.
+        ///
+        [[nodiscard]] constexpr auto
+        cache(TLS_TYPE const &tls) noexcept -> basic_page_pool_cache_t *
+        {
+            auto *const pmut_cache{m_caches.at_if(bsl::to_idx(tls.ppid))};
+            bsl::expects(nullptr != pmut_cache);
+
+            return pmut_cache;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the lock that guards the page cache owned by
+        ///     the current PP.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the lock that guards the page cache owned by
+        ///     the current PP.
+        ///
+        [[nodiscard]] constexpr auto
+        cache_lock(TLS_TYPE const &tls) const noexcept -> basic_spinlock_t &
+        {
+            auto *const pmut_lock{m_cache_locks.at_if(bsl::to_idx(tls.ppid))};
+            bsl::expects(nullptr != pmut_lock);
+
+            return *pmut_lock;
+        }
+
+        /// <!-- description -->
+        ///   @brief Adds a chain of dirty pages to the current PP's cache.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param pmut_head the first page in the chain
+        ///   @param pmut_tail the last page in the chain
+        ///   @param count the total number of pages in the chain
+        ///
+        constexpr void
+        give(
+            TLS_TYPE const &tls,
+            basic_page_pool_node_t *const pmut_head,
+            basic_page_pool_node_t *const pmut_tail,
+            bsl::safe_umx const &count) noexcept
+        {
+            basic_lock_guard_t mut_lock{tls, this->cache_lock(tls)};
+            auto *const pmut_cache{this->cache(tls)};
+
+            pmut_tail->next = pmut_cache->head;
+            pmut_cache->head = pmut_head;
+            pmut_cache->count += count;
+        }
+
+        /// <!-- description -->
+        ///   @brief Takes every page out of the first PP cache (other than
+        ///     the current PP's) that is not empty, and gives them to the
+        ///     current PP's cache. This is only used once the global free
+        ///     list is empty and cannot be refilled, so that allocations
+        ///     do not fail while other PPs are still sitting on pages. The
+        ///     caller must hold m_lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if pages were stolen, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        steal(TLS_TYPE const &tls) noexcept -> bool
+        {
+            auto const self{bsl::to_idx(tls.ppid)};
+            for (bsl::safe_idx mut_i{}; mut_i < m_caches.size(); ++mut_i) {
+                if (self == mut_i) {
+                    continue;
+                }
+
+                basic_page_pool_node_t *mut_head{};
+                bsl::safe_umx mut_count{};
+
+                {
+                    basic_lock_guard_t mut_lock{tls, *m_cache_locks.at_if(mut_i)};
+                    auto *const pmut_victim{m_caches.at_if(mut_i)};
+
+                    if (nullptr != pmut_victim->head) {
+                        mut_head = pmut_victim->head;
+                        mut_count = pmut_victim->count;
+                        pmut_victim->head = nullptr;
+                        pmut_victim->count = {};
+                    }
+                    else {
+                        mut_head = pmut_victim->zeroed;
+                        mut_count = pmut_victim->zeroed_count;
+                        pmut_victim->zeroed = nullptr;
+                        pmut_victim->zeroed_count = {};
+                    }
+                }
+
+                if (nullptr == mut_head) {
+                    continue;
+                }
+
+                auto *mut_tail{mut_head};
+                while (nullptr != mut_tail->next) {
+                    mut_tail = mut_tail->next;
+                }
+
+                this->give(tls, mut_head, mut_tail, mut_count);
+                return true;
+            }
+
+            bsl::print<bsl::V>() << bsl::here();
+            return false;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves up to BASIC_PAGE_POOL_CACHE_BATCH pages from the
+        ///     global free list into the current PP's cache. The caller
+        ///     must hold m_lock, and the free list must not be empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        take_batch(TLS_TYPE const &tls) noexcept
+        {
+            bsl::expects(nullptr != m_head);
+
+            /// NOTE:
+            /// - The batch is moved as a single chain, which means that
+            ///   the cache hands out pages in the same order that they
+            ///   appear in the free list.
+            ///
+
+            auto *const pmut_head{m_head};
+            auto *mut_tail{m_head};
+            auto mut_count{bsl::safe_umx::magic_1()};
+            while (mut_count < BASIC_PAGE_POOL_CACHE_BATCH) {
+                if (nullptr == mut_tail->next) {
+                    break;
+                }
+
+                mut_tail = mut_tail->next;
+                ++mut_count;
+            }
+
+            m_head = mut_tail->next;
+            m_used += (mut_count * HYPERVISOR_PAGE_SIZE).checked();
+            this->give(tls, pmut_head, mut_tail, mut_count);
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves up to BASIC_PAGE_POOL_CACHE_BATCH pages from the
+        ///     global free list into the current PP's cache. If the free
+        ///     list is empty, more pages are requested using
+        ///     helpers::add_to_page_pool(). If that fails as well, the
+        ///     pages sitting in another PP's cache are stolen.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_sys the bf_syscall_t to use
+        ///   @return Returns true if the cache was refilled, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        refill(TLS_TYPE const &tls, SYS_TYPE &mut_sys) noexcept -> bool
+        {
+            /// NOTE:
+            /// - Locks are always acquired in the following order: m_lock
+            ///   and then a PP's cache lock. A PP never holds its cache
+            ///   lock while acquiring m_lock.
+            ///
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            if (bsl::unlikely(nullptr == m_head)) {
+                m_head = helpers::add_to_page_pool(mut_sys);
+                if (bsl::unlikely(nullptr == m_head)) {
+                    return this->steal(tls);
+                }
+
+                for (auto const *mut_node{m_head}; nullptr != mut_node; mut_node = mut_node->next) {
+                    m_size += HYPERVISOR_PAGE_SIZE;
+                }
+            }
+            else {
+                bsl::touch();
+            }
+
+            this->take_batch(tls);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Same as refill(), but only takes pages that are already
+        ///     on the global free list. The pool is never grown and pages
+        ///     are never stolen from other PPs, which is what zero_pages()
+        ///     needs as it is only an optimization.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns true if the cache was refilled, false otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        refill_from_free_list(TLS_TYPE const &tls) noexcept -> bool
+        {
+            basic_lock_guard_t mut_lock{tls, m_lock};
+            if (nullptr == m_head) {
+                return false;
+            }
+
+            this->take_batch(tls);
+            return true;
+        }
+
+        /// <!-- description -->
+        ///   @brief Moves BASIC_PAGE_POOL_CACHE_BATCH pages from the current
+        ///     PP's cache back to the global free list if the cache is
+        ///     (still) full.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///
+        constexpr void
+        drain(TLS_TYPE const &tls) noexcept
+        {
+            basic_lock_guard_t mut_lock{tls, m_lock};
+            basic_lock_guard_t mut_cache_lock{tls, this->cache_lock(tls)};
+            auto *const pmut_cache{this->cache(tls)};
+
+            /// NOTE:
+            /// - Another PP might have stolen from this cache since the
+            ///   decision to drain it was made.
+            ///
+
+            if (pmut_cache->count <= BASIC_PAGE_POOL_CACHE_BATCH) {
+                return;
+            }
+
+            auto *const pmut_head{pmut_cache->head};
+            auto *mut_tail{pmut_head};
+            constexpr auto batch{BASIC_PAGE_POOL_CACHE_BATCH};
+            for (bsl::safe_idx mut_i{bsl::safe_idx::magic_1()}; mut_i < batch; ++mut_i) {
+                mut_tail = mut_tail->next;
+            }
+
+            pmut_cache->head = mut_tail->next;
+            pmut_cache->count -= BASIC_PAGE_POOL_CACHE_BATCH;
+
+            mut_tail->next = m_head;
+            m_head = pmut_head;
+            m_used -= (BASIC_PAGE_POOL_CACHE_BATCH * HYPERVISOR_PAGE_SIZE).checked();
+        }
+
+        /// <!-- description -->
+        ///   @brief Takes a page out of the current PP's cache, preferring
+        ///     pages that were zeroed ahead of time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param refilled true if the cache was just refilled
+        ///   @param mut_zeroed set to true if the page is already zeroed
+        ///   @return Returns the page, or a nullptr if the cache is empty
+        ///
+        [[nodiscard]] constexpr auto
+        pop(TLS_TYPE const &tls, bool const refilled, bool &mut_zeroed) noexcept
+            -> basic_page_pool_node_t *
+        {
+            basic_lock_guard_t mut_lock{tls, this->cache_lock(tls)};
+            auto *const pmut_cache{this->cache(tls)};
+
+            basic_page_pool_node_t *mut_node{};
+            if (nullptr != pmut_cache->zeroed) {
+                mut_node = pmut_cache->zeroed;
+                pmut_cache->zeroed = mut_node->next;
+                --pmut_cache->zeroed_count;
+                ++pmut_cache->prezeroed;
+                mut_zeroed = true;
+            }
+            else if (nullptr != pmut_cache->head) {
+                mut_node = pmut_cache->head;
+                pmut_cache->head = mut_node->next;
+                --pmut_cache->count;
+                ++pmut_cache->on_demand;
+                mut_zeroed = false;
+            }
+            else {
+                return nullptr;
+            }
+
+            if (refilled) {
+                ++pmut_cache->misses;
+            }
+            else {
+                ++pmut_cache->hits;
+            }
+
+            return mut_node;
+        }
+
+        /// <!-- description -->
+        ///   @brief Takes a dirty page out of the current PP's cache.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @return Returns the page, or a nullptr if there are no dirty
+        ///     pages in the cache
+        ///
+        [[nodiscard]] constexpr auto
+        pop_dirty(TLS_TYPE const &tls) noexcept -> basic_page_pool_node_t *
+        {
+            basic_lock_guard_t mut_lock{tls, this->cache_lock(tls)};
+            auto *const pmut_cache{this->cache(tls)};
+
+            auto *const pmut_node{pmut_cache->head};
+            if (nullptr != pmut_node) {
+                pmut_cache->head = pmut_node->next;
+                --pmut_cache->count;
+            }
+            else {
+                bsl::touch();
+            }
+
+            return pmut_node;
+        }
+
+        /// <!-- description -->
+        ///   @brief Zeroes up to "num" dirty pages owned by the current PP
+        ///     and moves them to the PP's list of pre-zeroed pages. If
+        ///     "can_refill" is true and the PP's cache does not have any
+        ///     dirty pages, it is refilled from the global free list first
+        ///     (but the pool is never grown and nothing is stolen from other
+        ///     PPs). None of the zeroing is performed while holding a lock.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param num the max number of pages to zero
+        ///   @param can_refill if true, the PP's cache may be refilled from
+        ///     the global free list, which takes the pool's lock
+        ///
+        constexpr void
+        zero_pages_impl(
+            TLS_TYPE const &tls, bsl::safe_umx const &num, bool const can_refill) noexcept
+        {
+            bsl::expects(num.is_valid_and_checked());
+
+            /// NOTE:
+            /// - Only this PP adds to its list of pre-zeroed pages, so the
+            ///   amount of room that is left can only grow after it has
+            ///   been read (if another PP steals from this cache).
+            ///
+
+            bsl::safe_umx mut_room{};
+            {
+                basic_lock_guard_t mut_lock{tls, this->cache_lock(tls)};
+                auto const *const cache{this->cache(tls)};
+
+                if (cache->zeroed_count < BASIC_PAGE_POOL_ZEROED_SIZE) {
+                    mut_room = (BASIC_PAGE_POOL_ZEROED_SIZE - cache->zeroed_count).checked();
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            for (bsl::safe_idx mut_i{}; mut_i < num; ++mut_i) {
+                if (mut_room.is_zero()) {
+                    break;
+                }
+
+                auto *mut_node{this->pop_dirty(tls)};
+                if (nullptr == mut_node) {
+                    if (!can_refill) {
+                        break;
+                    }
+
+                    if (!this->refill_from_free_list(tls)) {
+                        break;
+                    }
+
+                    mut_node = this->pop_dirty(tls);
+                    if (nullptr == mut_node) {
+                        break;
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                bsl::builtin_memset(mut_node, '\0', HYPERVISOR_PAGE_SIZE);
+
+                basic_lock_guard_t mut_lock{tls, this->cache_lock(tls)};
+                auto *const pmut_cache{this->cache(tls)};
+
+                mut_node->next = pmut_cache->zeroed;
+                pmut_cache->zeroed = mut_node;
+                ++pmut_cache->zeroed_count;
+                --mut_room;
+            }
         }
 
     public:
@@ -169,6 +618,8 @@ namespace lib
             m_head = mut_pool.data();
             m_size = (mut_pool.size() * HYPERVISOR_PAGE_SIZE).checked();
             m_used = {};
+            m_caches = {};
+            m_cache_locks = {};
         }
 
         /// <!-- description -->
@@ -187,24 +638,43 @@ namespace lib
             static_assert(bsl::is_pod<T>::value);
             static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
 
-            basic_lock_guard_t mut_lock{tls, m_lock};
+            bool mut_zeroed{};
+            auto *mut_node{this->pop(tls, false, mut_zeroed)};
+            if (nullptr == mut_node) {
+                if (bsl::unlikely(!this->refill(tls, mut_sys))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return {};
+                }
 
-            if (bsl::unlikely(nullptr == m_head)) {
-                m_head = helpers::add_to_page_pool(mut_sys);
-                if (bsl::unlikely(nullptr == m_head)) {
+                /// NOTE:
+                /// - Another PP can steal the pages that were just given
+                ///   to this PP's cache before they are popped.
+                ///
+
+                mut_node = this->pop(tls, true, mut_zeroed);
+                if (bsl::unlikely(nullptr == mut_node)) {
                     bsl::print<bsl::V>() << bsl::here();
                     return {};
                 }
 
-                m_size += HYPERVISOR_PAGE_SIZE;
+                bsl::touch();
             }
             else {
                 bsl::touch();
             }
 
-            auto *const pmut_node{m_head};
-            m_head = m_head->next;
-            m_used += HYPERVISOR_PAGE_SIZE;
+            if (mut_zeroed) {
+
+                /// NOTE:
+                /// - The next field is the only part of a zeroed page that
+                ///   was written to after it was zeroed.
+                ///
+
+                mut_node->next = nullptr;
+
+                bsl::destroy_at(mut_node);
+                return bsl::construct_at<T>(mut_node);
+            }
 
             /// NOTE:
             /// - Since we only support POD types, we have two options on
@@ -220,8 +690,8 @@ namespace lib
             ///   node and then creating our type T.
             ///
 
-            bsl::destroy_at(pmut_node);
-            auto *const pmut_virt{bsl::construct_at<T>(pmut_node)};
+            bsl::destroy_at(mut_node);
+            auto *const pmut_virt{bsl::construct_at<T>(mut_node)};
 
             return bsl::builtin_memset(pmut_virt, '\0', HYPERVISOR_PAGE_SIZE);
         }
@@ -243,20 +713,70 @@ namespace lib
             static_assert(sizeof(T) == HYPERVISOR_PAGE_SIZE);
 
             bsl::expects(nullptr != pmut_virt);
-            basic_lock_guard_t mut_lock{tls, m_lock};
 
             /// NOTE:
             /// - To deallocate, we simply do the reverse, again treating
             ///   the node as a union. First we destroy the type T * that we
             ///   were given and then create our node using placement new.
+            /// - The page is returned to this PP's cache. Only once the
+            ///   cache is full are pages returned to the global free list.
             ///
 
             bsl::destroy_at(pmut_virt);
             auto *const pmut_node{bsl::construct_at<basic_page_pool_node_t>(pmut_virt)};
 
-            pmut_node->next = m_head;
-            m_head = pmut_node;
-            m_used -= HYPERVISOR_PAGE_SIZE;
+            bool mut_full{};
+            {
+                basic_lock_guard_t mut_lock{tls, this->cache_lock(tls)};
+                auto *const pmut_cache{this->cache(tls)};
+
+                pmut_node->next = pmut_cache->head;
+                pmut_cache->head = pmut_node;
+                ++pmut_cache->count;
+
+                mut_full = pmut_cache->count > BASIC_PAGE_POOL_CACHE_SIZE;
+            }
+
+            if (mut_full) {
+                this->drain(tls);
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Zeroes up to "num" dirty pages owned by the current PP
+        ///     and moves them to the PP's list of pre-zeroed pages. If the
+        ///     PP's cache does not have any dirty pages, it is refilled from
+        ///     the global free list first. This should be called when a PP
+        ///     has nothing better to do so that page zeroing is taken off of
+        ///     the allocation path.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param num the max number of pages to zero
+        ///
+        constexpr void
+        zero_pages(TLS_TYPE const &tls, bsl::safe_umx const &num) noexcept
+        {
+            this->zero_pages_impl(tls, num, true);
+        }
+
+        /// <!-- description -->
+        ///   @brief Same as zero_pages(), but only zeroes dirty pages that
+        ///     are already in the current PP's cache. The pool's lock is
+        ///     never taken, which makes this safe to call from paths that
+        ///     must not contend with other PPs.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param num the max number of pages to zero
+        ///
+        constexpr void
+        zero_cached_pages(TLS_TYPE const &tls, bsl::safe_umx const &num) noexcept
+        {
+            this->zero_pages_impl(tls, num, false);
         }
 
         /// <!-- description -->
@@ -283,7 +803,7 @@ namespace lib
         allocated(TLS_TYPE const &tls) const noexcept -> bsl::safe_umx
         {
             basic_lock_guard_t mut_lock{tls, m_lock};
-            return this->allocated();
+            return this->allocated_locked(tls);
         }
 
         /// <!-- description -->
@@ -297,7 +817,7 @@ namespace lib
         remaining(TLS_TYPE const &tls) const noexcept -> bsl::safe_umx
         {
             basic_lock_guard_t mut_lock{tls, m_lock};
-            return this->remaining();
+            return this->remaining_locked(tls);
         }
 
         /// <!-- description -->
@@ -400,8 +920,8 @@ namespace lib
             /// Used
             ///
 
-            auto const used_kb{(this->allocated() / kb).checked()};
-            auto const used_mb{(this->allocated() / mb).checked()};
+            auto const used_kb{(this->allocated_locked(tls) / kb).checked()};
+            auto const used_mb{(this->allocated_locked(tls) / mb).checked()};
 
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::fmt{"<23s", "used "};
@@ -418,8 +938,8 @@ namespace lib
             /// Remaining
             ///
 
-            auto const remaining_kb{(this->remaining() / kb).checked()};
-            auto const remaining_mb{(this->remaining() / mb).checked()};
+            auto const remaining_kb{(this->remaining_locked(tls) / kb).checked()};
+            auto const remaining_mb{(this->remaining_locked(tls) / mb).checked()};
 
             bsl::print() << bsl::ylw << "| ";
             bsl::print() << bsl::rst << bsl::fmt{"<23s", "remaining "};
@@ -438,6 +958,78 @@ namespace lib
 
             bsl::print() << bsl::ylw << "+----------------------------------+";
             bsl::print() << bsl::rst << bsl::endl;
+
+            /// PP Caches
+            ///
+
+            bsl::print() << bsl::mag << "page pool caches: ";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+------------------------------------------";
+            bsl::print() << bsl::ylw << "-------------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "| ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^4s", "pp"};
+            bsl::print() << bsl::ylw << " | ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^8s", "cached"};
+            bsl::print() << bsl::ylw << " | ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^14s", "hits"};
+            bsl::print() << bsl::ylw << " | ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^14s", "misses"};
+            bsl::print() << bsl::ylw << " | ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^14s", "pre-zeroed"};
+            bsl::print() << bsl::ylw << " | ";
+            bsl::print() << bsl::cyn << bsl::fmt{"^14s", "on demand"};
+            bsl::print() << bsl::ylw << " |";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            bsl::print() << bsl::ylw << "+------------------------------------------";
+            bsl::print() << bsl::ylw << "-------------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+
+            for (bsl::safe_idx mut_i{}; mut_i < m_caches.size(); ++mut_i) {
+                basic_page_pool_cache_t mut_cache{};
+                {
+                    basic_lock_guard_t mut_cache_lock{tls, *m_cache_locks.at_if(mut_i)};
+                    mut_cache = *m_caches.at_if(mut_i);
+                }
+
+                auto const total{(mut_cache.count + mut_cache.zeroed_count).checked()};
+                if (mut_cache.hits.is_zero() && mut_cache.misses.is_zero() && total.is_zero()) {
+                    continue;
+                }
+
+                bsl::print() << bsl::ylw << "| ";
+                bsl::print() << bsl::rst << bsl::fmt{"04x", bsl::to_u16(mut_i)};
+                bsl::print() << bsl::ylw << " | ";
+                bsl::print() << bsl::rst << bsl::fmt{"8d", total};
+                bsl::print() << bsl::ylw << " | ";
+                bsl::print() << bsl::grn << bsl::fmt{"14d", mut_cache.hits};
+                bsl::print() << bsl::ylw << " | ";
+                bsl::print() << bsl::red << bsl::fmt{"14d", mut_cache.misses};
+                bsl::print() << bsl::ylw << " | ";
+                bsl::print() << bsl::grn << bsl::fmt{"14d", mut_cache.prezeroed};
+                bsl::print() << bsl::ylw << " | ";
+                bsl::print() << bsl::red << bsl::fmt{"14d", mut_cache.on_demand};
+                bsl::print() << bsl::ylw << " |";
+                bsl::print() << bsl::rst << bsl::endl;
+            }
+
+            bsl::print() << bsl::ylw << "+------------------------------------------";
+            bsl::print() << bsl::ylw << "-------------------------------------------+";
+            bsl::print() << bsl::rst << bsl::endl;
+        }
+
+        /// <!-- description -->
+        ///   @brief Outputs the statistics of the basic_page_pool_t's
+        ///     lock. The header of the table must already be outputted
+        ///     (see basic_lock_stats_t::dump_header()).
+        ///
+        constexpr void
+        dump_locks() const noexcept
+        {
+            m_lock.stats().dump("page pool");
         }
     };
 }
@@ -45,13 +45,16 @@
 #include <basic_entries_t.hpp>
 #include <basic_entry_status_t.hpp>
 #include <basic_lock_guard_t.hpp>    // IWYU pragma: keep
+#include <basic_lock_stats_t.hpp>
 #include <basic_map_page_flags.hpp>
 #include <basic_page_1g_t.hpp>
 #include <basic_page_2m_t.hpp>
 #include <basic_page_4k_t.hpp>
 #include <basic_page_pool_t.hpp>    // IWYU pragma: keep
 #include <basic_page_table_t.hpp>
-#include <basic_spinlock_t.hpp>    // IWYU pragma: keep
+#include <basic_range_status_t.hpp>
+#include <basic_rwlock_t.hpp>                 // IWYU pragma: keep
+#include <basic_shared_lock_guard_t.hpp>    // IWYU pragma: keep
 
 #include <bsl/construct_at.hpp>
 #include <bsl/convert.hpp>
@@ -216,8 +219,8 @@ namespace lib
         l3t_t *m_l3t{};
         /// @brief stores the physical address of the l3t
         bsl::safe_umx m_l3t_spa{};
-        /// @brief safe guards operations on the RPT.
-        mutable basic_spinlock_t m_lock{};
+        /// @brief safe guards operations on the RPT (queries are shared).
+        mutable basic_rwlock_t m_lock{};
 
         /// <!-- description -->
         ///   @brief Returns reserved if the entry is marked as an alias.
@@ -1766,6 +1769,521 @@ namespace lib
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Given the entries of a 4k map, releases the l0t_t, l1t_t
+        ///     and l2t_t that were used by the map if they are empty. This is
+        ///     used by unmap_range() to cleanup tables once per 2m span
+        ///     instead of once per page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param ents the entries of the 4k map to cleanup
+        ///
+        static constexpr void
+        release_empty_tables(
+            TLS_TYPE const &tls, PAGE_POOL_TYPE &mut_page_pool, entries_t const &ents) noexcept
+        {
+            if (nullptr == ents.l1e) {
+                return;
+            }
+
+            release_entry(tls, mut_page_pool, ents.l1e, false);
+            release_entry(tls, mut_page_pool, ents.l2e, false);
+            release_entry(tls, mut_page_pool, ents.l3e, false);
+        }
+
+        /// <!-- description -->
+        ///   @brief Configures the provided entry as a leaf that maps the
+        ///     provided physical address. If E is a L2E_TYPE or L1E_TYPE, the
+        ///     entry is configured as a 1g or 2m page.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to configure
+        ///   @param pmut_entry the entry to configure
+        ///   @param page_phys the physical address to map
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param explicit_unmap tells the RPT that the virtual
+        ///     address must be explicitly unmapped before the RPT can be
+        ///     released.
+        ///
+        template<typename E>
+        static constexpr void
+        configure_block(
+            E *const pmut_entry,
+            bsl::safe_u64 const &page_phys,
+            bsl::safe_u64 const &page_flgs,
+            bool const explicit_unmap) noexcept
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
+
+            if (explicit_unmap) {
+                pmut_entry->explicit_unmap = bsl::safe_u64::magic_1().get();
+            }
+            else {
+                pmut_entry->explicit_unmap = bsl::safe_u64::magic_0().get();
+            }
+
+            pmut_entry->auto_release = bsl::safe_u64::magic_0().get();
+            pmut_entry->points_to_block = bsl::safe_u64::magic_1().get();
+            pmut_entry->alias = bsl::safe_u64::magic_0().get();
+            pmut_entry->phys = (page_phys >> BASIC_PAGE_4K_T_SHFT).get();
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                helpers::configure_entry_as_ptr_to_block(pmut_entry, page_flgs);
+            }
+            else {
+                helpers::configure_entry_as_ptr_to_large_block(pmut_entry, page_flgs);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns all of the entries that are identified during the
+        ///     translation of the provided virtual address. Unlike
+        ///     get_for_query(), this function does not report an error. The
+        ///     walk simply stops at the first entry that is not present, or
+        ///     that maps a 1g or 2m page, leaving the remaining entries set
+        ///     to a nullptr.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to decode
+        ///   @return Returns all of the entries that are identified during the
+        ///     translation of the provided virtual address.
+        ///
+        [[nodiscard]] constexpr auto
+        get_for_probe(PAGE_POOL_TYPE const &page_pool, bsl::safe_u64 const &page_virt)
+            const noexcept -> entries_t
+        {
+            entries_t mut_ret{};
+
+            mut_ret.l3e = m_l3t->entries.at_if(virt_to_l3to(page_virt));
+            if (entry_status(mut_ret.l3e) != basic_entry_status_t::present) {
+                return mut_ret;
+            }
+
+            auto *const pmut_l2t{entry_to_table(page_pool, mut_ret.l3e)};
+            mut_ret.l2e = pmut_l2t->entries.at_if(virt_to_l2to(page_virt));
+            if (entry_status(mut_ret.l2e) != basic_entry_status_t::present) {
+                return mut_ret;
+            }
+
+            if (bsl::safe_u64::magic_1() == mut_ret.l2e->points_to_block) {
+                return mut_ret;
+            }
+
+            auto *const pmut_l1t{entry_to_table(page_pool, mut_ret.l2e)};
+            mut_ret.l1e = pmut_l1t->entries.at_if(virt_to_l1to(page_virt));
+            if (entry_status(mut_ret.l1e) != basic_entry_status_t::present) {
+                return mut_ret;
+            }
+
+            if (bsl::safe_u64::magic_1() == mut_ret.l1e->points_to_block) {
+                return mut_ret;
+            }
+
+            auto *const pmut_l0t{entry_to_table(page_pool, mut_ret.l1e)};
+            mut_ret.l0e = pmut_l0t->entries.at_if(virt_to_l0to(page_virt));
+
+            return mut_ret;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the entries returned by get_for_probe()
+        ///     show that a 1g (L2E_TYPE) or 2m (L1E_TYPE) page could be
+        ///     mapped without overwriting an existing map. Returns false
+        ///     otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry that would be mapped
+        ///   @param ents the entries returned by get_for_probe()
+        ///   @return Returns true if the entries returned by get_for_probe()
+        ///     show that a 1g (L2E_TYPE) or 2m (L1E_TYPE) page could be
+        ///     mapped without overwriting an existing map. Returns false
+        ///     otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        is_free_for_block(entries_t const &ents) noexcept -> bool
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE>::value);
+
+            if (nullptr == ents.l2e) {
+                return entry_status(ents.l3e) == basic_entry_status_t::not_present;
+            }
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                return entry_status(ents.l2e) == basic_entry_status_t::not_present;
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                if (nullptr == ents.l1e) {
+                    return entry_status(ents.l2e) == basic_entry_status_t::not_present;
+                }
+
+                return entry_status(ents.l1e) == basic_entry_status_t::not_present;
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the entries returned by get_for_probe()
+        ///     show that the provided entry type maps a 1g (L2E_TYPE) or
+        ///     2m (L1E_TYPE) page. Returns false otherwise.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to query
+        ///   @param ents the entries returned by get_for_probe()
+        ///   @return Returns true if the entries returned by get_for_probe()
+        ///     show that the provided entry type maps a 1g (L2E_TYPE) or
+        ///     2m (L1E_TYPE) page. Returns false otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        is_block(entries_t const &ents) noexcept -> bool
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE>::value);
+
+            auto const *const entry{get_entry_from_entries<E>(ents)};
+            if (nullptr == entry) {
+                return false;
+            }
+
+            if (entry_status(entry) != basic_entry_status_t::present) {
+                return false;
+            }
+
+            return bsl::safe_u64::magic_1() == entry->points_to_block;
+        }
+
+        /// <!-- description -->
+        ///   @brief Demotes a 1g (L2E_TYPE) or 2m (L1E_TYPE) page into a
+        ///     newly allocated table of 2m or 4k pages that map the same
+        ///     physical memory with the same flags. If the table cannot be
+        ///     allocated, the entry is left unmodified.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to split
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param pmut_entry the entry to split
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        split_block(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            E *const pmut_entry,
+            SYS_TYPE &mut_sys) noexcept -> bsl::errc_type
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE>::value);
+
+            auto const blk{*pmut_entry};
+            auto const blk_flgs{helpers::entry_flags(&blk)};
+            bool const explicit_unmap{bsl::safe_u64::magic_1() == blk.explicit_unmap};
+
+            /// NOTE:
+            /// - The new table is filled in before the live entry is
+            ///   touched. The live entry is then replaced with a single
+            ///   write, which means that a walk of this entry (by another
+            ///   PP or by hardware) either sees the old block or the new
+            ///   table, both of which map the same memory with the same
+            ///   flags, and never sees a not-present entry.
+            ///
+
+            E mut_tbl_entry{};
+            auto *const pmut_table{add_table(tls, mut_page_pool, &mut_tbl_entry, mut_sys)};
+            if (bsl::unlikely(nullptr == pmut_table)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return bsl::errc_failure;
+            }
+
+            bsl::safe_u64 mut_page_phys{blk.phys << BASIC_PAGE_4K_T_SHFT};
+            for (bsl::safe_idx mut_i{}; mut_i < pmut_table->entries.size(); ++mut_i) {
+                configure_block(
+                    pmut_table->entries.at_if(mut_i), mut_page_phys, blk_flgs, explicit_unmap);
+
+                if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                    mut_page_phys += bsl::to_u64(BASIC_PAGE_2M_T_SIZE);
+                }
+                else {
+                    mut_page_phys += bsl::to_u64(BASIC_PAGE_4K_T_SIZE);
+                }
+            }
+
+            *pmut_entry = mut_tbl_entry;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Demotes any 1g or 2m page that contains the provided
+        ///     virtual address so that the provided virtual address can be
+        ///     unmapped using the provided entry type. If E is L1E_TYPE,
+        ///     only a 1g page is split. If E is L0E_TYPE, a 1g page is split
+        ///     into 2m pages and then the 2m page is split into 4k pages.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry that will be unmapped
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address that will be unmapped
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        template<typename E>
+        [[nodiscard]] constexpr auto
+        split_blocks(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &page_virt,
+            SYS_TYPE &mut_sys) noexcept -> bsl::errc_type
+        {
+            static_assert(bsl::is_one_of<E, L1E_TYPE, L0E_TYPE>::value);
+
+            auto mut_ents{this->get_for_probe(mut_page_pool, page_virt)};
+            if (is_block<L2E_TYPE>(mut_ents)) {
+                if (bsl::unlikely(!split_block(tls, mut_page_pool, mut_ents.l2e, mut_sys))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                mut_ents = this->get_for_probe(mut_page_pool, page_virt);
+            }
+            else {
+                bsl::touch();
+            }
+
+            if constexpr (bsl::is_same<E, L0E_TYPE>::value) {
+                if (is_block<L1E_TYPE>(mut_ents)) {
+                    if (bsl::unlikely(!split_block(tls, mut_page_pool, mut_ents.l1e, mut_sys))) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return bsl::errc_failure;
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
+                }
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of 4k pages that a 1g (L2E_TYPE) or
+        ///     2m (L1E_TYPE) page covers.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to query
+        ///   @return Returns the number of 4k pages that a 1g (L2E_TYPE) or
+        ///     2m (L1E_TYPE) page covers.
+        ///
+        template<typename E>
+        [[nodiscard]] static constexpr auto
+        pages_per_block() noexcept -> bsl::safe_umx
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE>::value);
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                return (BASIC_PAGE_1G_T_SIZE >> BASIC_PAGE_4K_T_SHFT).checked();
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                return (BASIC_PAGE_2M_T_SIZE >> BASIC_PAGE_4K_T_SHFT).checked();
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Used by map_range() to map a 1g (L2E_TYPE) or 2m
+        ///     (L1E_TYPE) page instead of 4k pages. A large page is only
+        ///     used if the virtual and physical addresses are both aligned,
+        ///     the range covers the entire page and nothing is already
+        ///     mapped in its place.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to map
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to map
+        ///   @param page_phys the physical address to map
+        ///   @param num_pages the number of 4k pages left in the range
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param explicit_unmap tells the RPT that the virtual
+        ///     address must be explicitly unmapped before the RPT can be
+        ///     released.
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns the number of 4k pages that were mapped (0 if
+        ///     a large page could not be used) and bsl::errc_success on
+        ///     success, bsl::errc_failure and friends otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] constexpr auto
+        map_range_block(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &page_virt,
+            bsl::safe_u64 const &page_phys,
+            bsl::safe_umx const &num_pages,
+            bsl::safe_u64 const &page_flgs,
+            bool const explicit_unmap,
+            SYS_TYPE &mut_sys) noexcept -> basic_range_status_t
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE>::value);
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                if (!is_page_1g_aligned(page_virt) || !is_page_1g_aligned(page_phys)) {
+                    return {{}, bsl::errc_success};
+                }
+
+                bsl::touch();
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                if (!is_page_2m_aligned(page_virt) || !is_page_2m_aligned(page_phys)) {
+                    return {{}, bsl::errc_success};
+                }
+
+                bsl::touch();
+            }
+
+            auto const pages{pages_per_block<E>()};
+            if (num_pages < pages) {
+                return {{}, bsl::errc_success};
+            }
+
+            if (!is_free_for_block<E>(this->get_for_probe(mut_page_pool, page_virt))) {
+                return {{}, bsl::errc_success};
+            }
+
+            auto *const pmut_entry{get_entry_from_entries<E>(
+                this->get_for_map<E>(tls, mut_page_pool, page_virt, mut_sys))};
+
+            if (bsl::unlikely(nullptr == pmut_entry)) {
+                bsl::print<bsl::V>() << bsl::here();
+                return {{}, bsl::errc_failure};
+            }
+
+            configure_block(pmut_entry, page_phys, page_flgs, explicit_unmap);
+            return {pages, bsl::errc_success};
+        }
+
+        /// <!-- description -->
+        ///   @brief Used by unmap_range() to unmap a 1g (L2E_TYPE) or 2m
+        ///     (L1E_TYPE) page that is entirely covered by the range. If E
+        ///     is L1E_TYPE and the 2m range is part of a 1g page, the 1g
+        ///     page is split first.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam E the type of entry to unmap
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param page_virt the virtual address to unmap
+        ///   @param num_pages the number of 4k pages left in the range
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns the number of 4k pages that were unmapped (0 if
+        ///     a large page is not mapped at page_virt) and
+        ///     bsl::errc_success on success, bsl::errc_failure and friends
+        ///     otherwise.
+        ///
+        template<typename E>
+        [[nodiscard]] constexpr auto
+        unmap_range_block(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &page_virt,
+            bsl::safe_umx const &num_pages,
+            SYS_TYPE &mut_sys) noexcept -> basic_range_status_t
+        {
+            static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE>::value);
+
+            if constexpr (bsl::is_same<E, L2E_TYPE>::value) {
+                if (!is_page_1g_aligned(page_virt)) {
+                    return {{}, bsl::errc_success};
+                }
+
+                bsl::touch();
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                if (!is_page_2m_aligned(page_virt)) {
+                    return {{}, bsl::errc_success};
+                }
+
+                bsl::touch();
+            }
+
+            auto const pages{pages_per_block<E>()};
+            if (num_pages < pages) {
+                return {{}, bsl::errc_success};
+            }
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                if (bsl::unlikely(!this->split_blocks<E>(tls, mut_page_pool, page_virt, mut_sys))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return {{}, bsl::errc_failure};
+                }
+
+                bsl::touch();
+            }
+
+            auto const ents{this->get_for_probe(mut_page_pool, page_virt)};
+            if (!is_block<E>(ents)) {
+                return {{}, bsl::errc_success};
+            }
+
+            auto *const pmut_entry{get_entry_from_entries<E>(ents)};
+            pmut_entry->explicit_unmap = bsl::safe_u64::magic_0().get();
+            release_entry(tls, mut_page_pool, pmut_entry, true);
+
+            if constexpr (bsl::is_same<E, L1E_TYPE>::value) {
+                release_entry(tls, mut_page_pool, ents.l2e, false);
+            }
+
+            release_entry(tls, mut_page_pool, ents.l3e, false);
+            return {pages, bsl::errc_success};
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of tables (including the provided
+        ///     table) that are reachable from the provided table. Aliased
+        ///     entries and entries that map a page are not followed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam T the type of table to count
+        ///   @param page_pool the page_pool_t to use
+        ///   @param table the table to count
+        ///   @return Returns the number of tables (including the provided
+        ///     table) that are reachable from the provided table.
+        ///
+        template<typename T>
+        [[nodiscard]] static constexpr auto
+        count_tables(PAGE_POOL_TYPE const &page_pool, T const *const table) noexcept
+            -> bsl::safe_umx
+        {
+            bsl::safe_umx mut_tables{bsl::safe_umx::magic_1()};
+
+            if constexpr (!bsl::is_same<T, l0t_t>::value) {
+                for (bsl::safe_idx mut_i{}; mut_i < table->entries.size(); ++mut_i) {
+                    auto const *const entry{table->entries.at_if(mut_i)};
+                    if (entry_status(entry) != basic_entry_status_t::present) {
+                        continue;
+                    }
+
+                    if (bsl::safe_u64::magic_1() == entry->points_to_block) {
+                        continue;
+                    }
+
+                    mut_tables += count_tables(page_pool, entry_to_table(page_pool, entry));
+                }
+            }
+
+            return mut_tables.checked();
+        }
+
     public:
         /// <!-- description -->
         ///   @brief Initializes this basic_root_page_table_t
@@ -1935,19 +2453,7 @@ namespace lib
                 return bsl::errc_failure;
             }
 
-            if (explicit_unmap) {
-                pmut_entry->explicit_unmap = bsl::safe_u64::magic_1().get();
-            }
-            else {
-                pmut_entry->explicit_unmap = bsl::safe_u64::magic_0().get();
-            }
-
-            pmut_entry->auto_release = bsl::safe_u64::magic_0().get();
-            pmut_entry->points_to_block = bsl::safe_u64::magic_1().get();
-            pmut_entry->alias = bsl::safe_u64::magic_0().get();
-            pmut_entry->phys = (page_phys >> BASIC_PAGE_4K_T_SHFT).get();
-            helpers::configure_entry_as_ptr_to_block(pmut_entry, page_flgs);
-
+            configure_block(pmut_entry, page_phys, page_flgs, explicit_unmap);
             return bsl::errc_success;
         }
 
@@ -2089,7 +2595,10 @@ namespace lib
         ///     list of all of the entries associated with the map. It is
         ///     the caller's responsibility to flush the TLB as needed. This
         ///     might include the need to flush the unmapped page on all PPs
-        ///     that have touched the page.
+        ///     that have touched the page. If the page is part of a larger
+        ///     1g or 2m page (e.g. one created by map_range()), the larger
+        ///     page is split first so that only the requested page is
+        ///     unmapped.
         ///
         /// <!-- inputs/outputs -->
         ///   @tparam E the entry type to use. Valid inputs are L2E_TYPE, L1E_TYPE
@@ -2099,6 +2608,7 @@ namespace lib
         ///   @param tls the current TLS block
         ///   @param mut_page_pool the page_pool_t to use
         ///   @param page_virt the virtual address to unmap
+        ///   @param mut_sys the bf_syscall_t to use (optional)
         ///   @return Returns bsl::errc_success on success, bsl::errc_failure
         ///     and friends otherwise
         ///
@@ -2107,7 +2617,8 @@ namespace lib
         unmap(
             TLS_TYPE const &tls,
             PAGE_POOL_TYPE &mut_page_pool,
-            bsl::safe_u64 const &page_virt) noexcept -> bsl::errc_type
+            bsl::safe_u64 const &page_virt,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> bsl::errc_type
         {
             static_assert(bsl::is_one_of<E, L2E_TYPE, L1E_TYPE, L0E_TYPE>::value);
 
@@ -2127,6 +2638,16 @@ namespace lib
             }
 
             basic_lock_guard_t mut_lock{tls, m_lock};
+
+            if constexpr (!bsl::is_same<E, L2E_TYPE>::value) {
+                if (bsl::unlikely(!this->split_blocks<E>(tls, mut_page_pool, page_virt, mut_sys))) {
+                    bsl::print<bsl::V>() << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+
             auto const ents{this->get_for_query<E>(mut_page_pool, page_virt)};
 
             if (bsl::unlikely(nullptr == ents.l3e)) {
@@ -2159,6 +2680,282 @@ namespace lib
             }
         }
 
+        /// <!-- description -->
+        ///   @brief Maps a range of contiguous 4k pages into the root page
+        ///     table. This is the same as calling map() for each page in the
+        ///     range, except that the lock is only acquired once, and the
+        ///     page tables are only walked (and allocated if needed) once
+        ///     for each 2m span in the range. The remaining pages in a span
+        ///     are mapped directly using the l0t_t that was found (or
+        ///     created) for the first page in that span. Whenever the
+        ///     virtual and physical addresses are both 1g or 2m aligned, the
+        ///     range covers the entire page and nothing is already mapped in
+        ///     its place, a single 1g or 2m page is mapped instead of 4k
+        ///     pages (i.e. the range is automatically promoted to large
+        ///     pages). Use unmap() or unmap_range() to remove any part of
+        ///     the range, as both will split a large page as needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param virt the virtual address of the first page to map
+        ///   @param phys the physical address of the first page to map
+        ///   @param num_pages the total number of 4k pages to map
+        ///   @param page_flgs defines how memory should be mapped
+        ///   @param explicit_unmap tells the RPT that the virtual
+        ///     addresses must be explicitly unmapped before the RPT can be
+        ///     released. Otherwise the release will fail.
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns a basic_range_status_t containing the number of
+        ///     pages that were mapped and bsl::errc_success on success. On
+        ///     failure, the pages that were mapped before the failure remain
+        ///     mapped, and it is up to the caller to unmap them if needed.
+        ///
+        [[nodiscard]] constexpr auto
+        map_range(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &virt,
+            bsl::safe_u64 const &phys,
+            bsl::safe_umx const &num_pages,
+            bsl::safe_u64 const &page_flgs,
+            bool const explicit_unmap = false,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> basic_range_status_t
+        {
+            bsl::expects(nullptr != m_l3t);
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(is_page_4k_aligned(virt));
+            bsl::expects(phys.is_valid_and_checked());
+            bsl::expects(is_page_4k_aligned(phys));
+            bsl::expects(num_pages.is_valid_and_checked());
+            bsl::expects(page_flgs.is_valid_and_checked());
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            l0t_t *pmut_mut_l0t{};
+            bsl::safe_umx mut_step{};
+            for (bsl::safe_umx mut_i{}; mut_i < num_pages; mut_i += mut_step) {
+                auto const offs{(bsl::to_u64(mut_i) << BASIC_PAGE_4K_T_SHFT).checked()};
+                auto const page_virt{(virt + offs).checked()};
+                auto const page_phys{(phys + offs).checked()};
+
+                if (bsl::unlikely(page_virt.is_invalid() || page_phys.is_invalid())) {
+                    bsl::error() << "map_range overflowed" << bsl::endl << bsl::here();
+                    return {mut_i, bsl::errc_failure};
+                }
+
+                mut_step = bsl::safe_umx::magic_1();
+
+                auto const l0to{virt_to_l0to(page_virt)};
+                if (l0to.is_zero()) {
+                    auto const left{(num_pages - mut_i).checked()};
+                    auto mut_blk{this->map_range_block<L2E_TYPE>(
+                        tls,
+                        mut_page_pool,
+                        page_virt,
+                        page_phys,
+                        left,
+                        page_flgs,
+                        explicit_unmap,
+                        mut_sys)};
+
+                    if (mut_blk.pages.is_zero() && mut_blk.ret) {
+                        mut_blk = this->map_range_block<L1E_TYPE>(
+                            tls,
+                            mut_page_pool,
+                            page_virt,
+                            page_phys,
+                            left,
+                            page_flgs,
+                            explicit_unmap,
+                            mut_sys);
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    if (bsl::unlikely(!mut_blk.ret)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return {mut_i, bsl::errc_failure};
+                    }
+
+                    pmut_mut_l0t = {};
+                    if (mut_blk.pages.is_pos()) {
+                        mut_step = mut_blk.pages;
+                        continue;
+                    }
+
+                    bsl::touch();
+                }
+                else {
+                    bsl::touch();
+                }
+
+                L0E_TYPE *pmut_mut_entry{};
+                if (nullptr == pmut_mut_l0t) {
+                    auto const ents{this->get_4k_for_map(tls, mut_page_pool, page_virt, mut_sys)};
+                    if (bsl::unlikely(nullptr == ents.l0e)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return {mut_i, bsl::errc_failure};
+                    }
+
+                    pmut_mut_l0t = entry_to_table(mut_page_pool, ents.l1e);
+                    pmut_mut_entry = ents.l0e;
+                }
+                else {
+                    pmut_mut_entry = pmut_mut_l0t->entries.at_if(l0to);
+                    if (bsl::unlikely(
+                            entry_status(pmut_mut_entry) != basic_entry_status_t::not_present)) {
+                        bsl::error() << "the virtual address "                   // --
+                                     << bsl::hex(page_virt)                      // --
+                                     << " is already mapped or is reserved"    // --
+                                     << bsl::endl                                // --
+                                     << bsl::here();                             // --
+
+                        return {mut_i, bsl::errc_failure};
+                    }
+
+                    bsl::touch();
+                }
+
+                configure_block(pmut_mut_entry, page_phys, page_flgs, explicit_unmap);
+            }
+
+            return {num_pages, bsl::errc_success};
+        }
+
+        /// <!-- description -->
+        ///   @brief Unmaps a range of contiguous 4k pages from the root page
+        ///     table. This is the same as calling unmap() for each page in
+        ///     the range, except that the lock is only acquired once, the
+        ///     page tables are only walked once for each 2m span in the
+        ///     range, and empty tables are only released once the last page
+        ///     of a span has been unmapped (instead of checking after every
+        ///     page). A 1g or 2m page that is entirely covered by the range
+        ///     is unmapped as a whole, while a 1g or 2m page that is only
+        ///     partially covered is split so that only the pages in the
+        ///     range are unmapped. It is the caller's responsibility to flush
+        ///     the TLB as needed.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param mut_page_pool the page_pool_t to use
+        ///   @param virt the virtual address of the first page to unmap
+        ///   @param num_pages the total number of 4k pages to unmap
+        ///   @param mut_sys the bf_syscall_t to use (optional)
+        ///   @return Returns a basic_range_status_t containing the number of
+        ///     pages that were unmapped and bsl::errc_success on success. On
+        ///     failure, the pages that were unmapped before the failure
+        ///     remain unmapped.
+        ///
+        [[nodiscard]] constexpr auto
+        unmap_range(
+            TLS_TYPE const &tls,
+            PAGE_POOL_TYPE &mut_page_pool,
+            bsl::safe_u64 const &virt,
+            bsl::safe_umx const &num_pages,
+            SYS_TYPE &mut_sys = bsl::dontcare) noexcept -> basic_range_status_t
+        {
+            bsl::expects(nullptr != m_l3t);
+            bsl::expects(virt.is_valid_and_checked());
+            bsl::expects(is_page_4k_aligned(virt));
+            bsl::expects(num_pages.is_valid_and_checked());
+
+            basic_lock_guard_t mut_lock{tls, m_lock};
+
+            entries_t mut_ents{};
+            l0t_t *pmut_mut_l0t{};
+
+            bsl::finally mut_release_on_exit{
+                [&tls, &mut_page_pool, &mut_ents]() noexcept -> void {
+                    release_empty_tables(tls, mut_page_pool, mut_ents);
+                }};
+
+            bsl::safe_umx mut_step{};
+            for (bsl::safe_umx mut_i{}; mut_i < num_pages; mut_i += mut_step) {
+                auto const offs{(bsl::to_u64(mut_i) << BASIC_PAGE_4K_T_SHFT).checked()};
+                auto const page_virt{(virt + offs).checked()};
+
+                if (bsl::unlikely(page_virt.is_invalid())) {
+                    bsl::error() << "unmap_range overflowed" << bsl::endl << bsl::here();
+                    return {mut_i, bsl::errc_failure};
+                }
+
+                mut_step = bsl::safe_umx::magic_1();
+
+                auto const l0to{virt_to_l0to(page_virt)};
+                if (l0to.is_zero()) {
+                    release_empty_tables(tls, mut_page_pool, mut_ents);
+                    mut_ents = {};
+                    pmut_mut_l0t = {};
+                }
+                else {
+                    bsl::touch();
+                }
+
+                L0E_TYPE *pmut_mut_entry{};
+                if (nullptr == pmut_mut_l0t) {
+                    auto const left{(num_pages - mut_i).checked()};
+                    auto mut_blk{this->unmap_range_block<L2E_TYPE>(
+                        tls, mut_page_pool, page_virt, left, mut_sys)};
+
+                    if (mut_blk.pages.is_zero() && mut_blk.ret) {
+                        mut_blk = this->unmap_range_block<L1E_TYPE>(
+                            tls, mut_page_pool, page_virt, left, mut_sys);
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    if (bsl::unlikely(!mut_blk.ret)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return {mut_i, bsl::errc_failure};
+                    }
+
+                    if (mut_blk.pages.is_pos()) {
+                        mut_step = mut_blk.pages;
+                        continue;
+                    }
+
+                    auto const ret{this->split_blocks<L0E_TYPE>(
+                        tls, mut_page_pool, page_virt, mut_sys)};
+                    if (bsl::unlikely(!ret)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return {mut_i, bsl::errc_failure};
+                    }
+
+                    mut_ents = this->get_for_query<L0E_TYPE>(mut_page_pool, page_virt);
+                    if (bsl::unlikely(nullptr == mut_ents.l0e)) {
+                        bsl::print<bsl::V>() << bsl::here();
+                        return {mut_i, bsl::errc_failure};
+                    }
+
+                    pmut_mut_l0t = entry_to_table(mut_page_pool, mut_ents.l1e);
+                    pmut_mut_entry = mut_ents.l0e;
+                }
+                else {
+                    pmut_mut_entry = pmut_mut_l0t->entries.at_if(l0to);
+                    if (bsl::unlikely(
+                            entry_status(pmut_mut_entry) != basic_entry_status_t::present)) {
+                        bsl::error() << "l0t_t entry for the virtual address "    // --
+                                     << bsl::hex(page_virt)                       // --
+                                     << " is not marked present"                  // --
+                                     << bsl::endl                                 // --
+                                     << bsl::here();                              // --
+
+                        return {mut_i, bsl::errc_failure};
+                    }
+
+                    bsl::touch();
+                }
+
+                pmut_mut_entry->explicit_unmap = bsl::safe_u64::magic_0().get();
+                release_entry(tls, mut_page_pool, pmut_mut_entry, true);
+            }
+
+            return {num_pages, bsl::errc_success};
+        }
+
         /// <!-- description -->
         ///   @brief Returns all of the entries that are identified during the
         ///     translation of the provided virtual address.
@@ -2196,17 +2993,41 @@ namespace lib
                 bsl::expects(is_page_4k_aligned(page_virt));
             }
 
-            basic_lock_guard_t mut_lock{tls, m_lock};
+            basic_shared_lock_guard_t mut_lock{tls, m_lock};
             return this->get_for_query<E>(mut_page_pool, page_virt);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the number of pages that are being used to
+        ///     store the page tables of this root page table, including the
+        ///     l3t_t itself. Tables that were aliased using add_tables() are
+        ///     not counted as they are owned by another root page table.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param tls the current TLS block
+        ///   @param page_pool the page_pool_t to use
+        ///   @return Returns the number of pages that are being used to
+        ///     store the page tables of this root page table.
+        ///
+        [[nodiscard]] constexpr auto
+        tables(TLS_TYPE const &tls, PAGE_POOL_TYPE const &page_pool) const noexcept
+            -> bsl::safe_umx
+        {
+            bsl::expects(nullptr != m_l3t);
+
+            basic_shared_lock_guard_t mut_lock{tls, m_lock};
+            return count_tables(page_pool, m_l3t);
+        }
+
         /// <!-- description -->
         ///   @brief Given a root page table, the enties are aliased into
         ///     this root page table, allowing software using this root page
         ///     table to access the memory mapped into the provided root page
         ///     table. The additions are aliases only, meaning when this root
         ///     page table loses scope, aliased entries added by this function
-        ///     are not returned back to the page_pool_t.
+        ///     are not returned back to the page_pool_t. Aliases whose entry
+        ///     is no longer present in the provided root page table (e.g.
+        ///     because unmap() released the table it pointed to) are removed.
         ///
         /// <!-- inputs/outputs -->
         ///   @param tls the current TLS block
@@ -2225,6 +3046,13 @@ namespace lib
                 auto *const pmut_dst_l3e{m_l3t->entries.at_if(mut_i)};
 
                 if (entry_status(src_l3e) == basic_entry_status_t::not_present) {
+                    if (bsl::safe_u64::magic_1() == pmut_dst_l3e->alias) {
+                        *pmut_dst_l3e = {};
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
                     continue;
                 }
 
@@ -2250,6 +3078,20 @@ namespace lib
         {
             this->add_tables(tls, rpt.m_l3t);
         }
+
+        /// <!-- description -->
+        ///   @brief Returns the statistics recorded by the lock that
+        ///     protects this basic_root_page_table_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the statistics recorded by the lock that
+        ///     protects this basic_root_page_table_t.
+        ///
+        [[nodiscard]] constexpr auto
+        lock_stats() const noexcept -> basic_lock_stats_t<> const &
+        {
+            return m_lock.stats();
+        }
     };
 }
 
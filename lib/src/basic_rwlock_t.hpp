@@ -0,0 +1,315 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+
+#ifndef BASIC_RWLOCK_T_HPP
+#define BASIC_RWLOCK_T_HPP
+
+#if __has_include("spinlock_helpers.hpp")
+#include <spinlock_helpers.hpp>    // IWYU pragma: export
+#endif
+
+#if __has_include("basic_spinlock_helpers.hpp")
+#include <basic_spinlock_helpers.hpp>    // IWYU pragma: export
+#endif
+
+// IWYU pragma: no_include "spinlock_helpers.hpp"
+// IWYU pragma: no_include "basic_spinlock_helpers.hpp"
+
+#include <basic_lock_stats_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/cstdint.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/safe_integral.hpp>
+
+#pragma clang diagnostic ignored "-Watomic-implicit-seq-cst"
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Implements a basic_rwlock_t. A basic_rwlock_t can either be
+    ///     locked exclusively by a single PP (using lock()/unlock(), which
+    ///     means it can be used with a basic_lock_guard_t), or it can be
+    ///     locked by any number of PPs at the same time using
+    ///     lock_shared()/unlock_shared() (i.e., with a
+    ///     basic_shared_lock_guard_t). This lock prefers writers. Once a
+    ///     PP asks for an exclusive lock, new readers wait until that PP
+    ///     is done, which ensures that a steady stream of readers cannot
+    ///     starve a writer. Like the basic_spinlock_t, the exclusive side
+    ///     of this lock is aware of which PP has acquired the lock. If the
+    ///     same PP attempts to acquire the lock, the lock is ignored, and a
+    ///     warning is outputted. The shared side of the lock cannot be
+    ///     acquired by a PP that already owns the lock (shared or
+    ///     exclusive) as that would deadlock with a waiting writer.
+    ///
+    class basic_rwlock_t final
+    {
+        /// @brief stores the ppid that currently owns the exclusive lock
+        bsl::safe_u16 m_ppid;
+        /// @brief stores whether or not a writer owns (or wants) the lock
+        _Atomic bool m_writer;
+        /// @brief stores the number of PPs that own the shared lock
+        _Atomic(bsl::uint64) m_readers;
+        /// @brief stores the statistics of the exclusive side (if enabled)
+        [[no_unique_address]] basic_lock_stats_t<> m_stats;
+
+    public:
+        /// <!-- description -->
+        ///   @brief Default constructor.
+        ///
+        // We cannot member initialize atomics so this is not possible
+        // NOLINTNEXTLINE(bsl-class-member-init)
+        constexpr basic_rwlock_t() noexcept    // --
+            : m_ppid{}, m_stats{}
+        {
+            // This is the only way to initialize this
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_writer = false;
+            // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
+            m_readers = {};
+        }
+
+        /// <!-- description -->
+        ///   @brief Destructor
+        ///
+        constexpr ~basic_rwlock_t() noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr basic_rwlock_t(basic_rwlock_t const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr basic_rwlock_t(basic_rwlock_t &&mut_o) noexcept = default;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(basic_rwlock_t const &o) &noexcept
+            -> basic_rwlock_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] auto operator=(basic_rwlock_t &&mut_o) &noexcept
+            -> basic_rwlock_t & = default;
+
+        /// <!-- description -->
+        ///   @brief Locks the basic_rwlock_t exclusively. This will not
+        ///     return until no other PP owns the lock (shared or exclusive).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_TYPE the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_TYPE>
+        constexpr void
+        lock(TLS_TYPE const &tls) noexcept
+        {
+            /// NOTE:
+            /// - Perform deadlock detection. If deadlock is detected, we
+            ///   return as it means that this PP has already acquired the
+            ///   lock with no means that unlock.
+            ///
+
+            if (tls.ppid == ~m_ppid) {
+                bsl::alert() << "pp "                                       // --
+                             << bsl::hex(tls.ppid)                          // --
+                             << " acquired the same lock more than once"    // --
+                             << bsl::endl;                                  // --
+
+                return;
+            }
+
+            /// NOTE:
+            /// - First we claim the writer flag, the same way the
+            ///   basic_spinlock_t claims its flag. Once the writer flag is
+            ///   set, no new readers can get in, so all that is left to do
+            ///   is to wait for the readers that are already in to leave.
+            /// - Both the exchange below and the load of m_readers must be
+            ///   sequentially consistent, as must the increment/load pair
+            ///   in lock_shared(). Otherwise, a reader and a writer could
+            ///   both see the other as absent and enter at the same time.
+            ///
+
+            bool mut_contended{};
+            bsl::safe_u64 mut_spins{};
+
+            while (__c11_atomic_exchange(&m_writer, true, __ATOMIC_SEQ_CST)) {
+                mut_contended = true;
+                while (__c11_atomic_load(&m_writer, __ATOMIC_RELAXED)) {
+                    if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                        ++mut_spins;
+                    }
+
+                    helpers::yield();
+                }
+            }
+
+            while (bsl::to_u64(__c11_atomic_load(&m_readers, __ATOMIC_SEQ_CST)).is_pos()) {
+                mut_contended = true;
+                if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                    ++mut_spins;
+                }
+
+                helpers::yield();
+            }
+
+            m_ppid = ~bsl::to_u16(tls.ppid);
+
+            if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                m_stats.acquired(mut_contended, mut_spins, helpers::tsc());
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Unlocks an exclusively locked basic_rwlock_t.
+        ///
+        constexpr void
+        unlock() noexcept
+        {
+            if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                m_stats.released(helpers::tsc());
+            }
+
+            m_ppid = {};
+            __c11_atomic_store(&m_writer, false, __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Locks the basic_rwlock_t for reading. This will not
+        ///     return until no PP owns (or is waiting for) the exclusive
+        ///     lock. Any number of PPs can own the shared lock at the same
+        ///     time.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @tparam TLS_TYPE the type of TLS block to use
+        ///   @param tls the current TLS block
+        ///
+        template<typename TLS_TYPE>
+        constexpr void
+        lock_shared(TLS_TYPE const &tls) noexcept
+        {
+            bsl::discard(tls);
+
+            /// NOTE:
+            /// - A reader announces itself by incrementing m_readers and
+            ///   then checks to see if a writer showed up in the meantime.
+            ///   If a writer did show up, the reader backs out (so that the
+            ///   writer is not waiting on a reader that is waiting on the
+            ///   writer) and tries again once the writer is done.
+            /// - When there are no writers, this is a single atomic add, and
+            ///   readers never write to memory that is owned by another
+            ///   reader, which is what lets lookups scale across PPs.
+            ///
+
+            constexpr auto one{bsl::safe_u64::magic_1()};
+
+            while (true) {
+                while (__c11_atomic_load(&m_writer, __ATOMIC_RELAXED)) {
+                    helpers::yield();
+                }
+
+                __c11_atomic_fetch_add(&m_readers, one.get(), __ATOMIC_SEQ_CST);
+                if (!__c11_atomic_load(&m_writer, __ATOMIC_SEQ_CST)) {
+                    return;
+                }
+
+                __c11_atomic_fetch_sub(&m_readers, one.get(), __ATOMIC_RELEASE);
+            }
+        }
+
+        /// <!-- description -->
+        ///   @brief Unlocks a basic_rwlock_t that was locked for reading.
+        ///
+        constexpr void
+        unlock_shared() noexcept
+        {
+            constexpr auto one{bsl::safe_u64::magic_1()};
+            __c11_atomic_fetch_sub(&m_readers, one.get(), __ATOMIC_RELEASE);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the basic_rwlock_t is locked exclusively
+        ///     (or if a PP is waiting for the exclusive lock).
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the basic_rwlock_t is locked exclusively
+        ///     (or if a PP is waiting for the exclusive lock).
+        ///
+        [[nodiscard]] constexpr auto
+        is_locked() const noexcept -> bool
+        {
+            return static_cast<bool>(m_writer);
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of PPs that own the shared lock
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of PPs that own the shared lock
+        ///
+        [[nodiscard]] constexpr auto
+        readers() const noexcept -> bsl::safe_u64
+        {
+            return bsl::to_u64(static_cast<bsl::uint64>(m_readers));
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the statistics recorded by the exclusive side of
+        ///     this lock. Since any number of PPs can own the shared side of
+        ///     the lock at the same time, readers are not recorded. If
+        ///     HYPERVISOR_DEBUG_LOCK_STATS is disabled, the statistics are
+        ///     empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the statistics recorded by this lock
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> basic_lock_stats_t<> const &
+        {
+            return m_stats;
+        }
+    };
+}
+
+#endif
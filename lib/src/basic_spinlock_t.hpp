@@ -36,6 +36,8 @@
 // IWYU pragma: no_include "spinlock_helpers.hpp"
 // IWYU pragma: no_include "basic_spinlock_helpers.hpp"
 
+#include <basic_lock_stats_t.hpp>
+
 #include <bsl/convert.hpp>
 #include <bsl/debug.hpp>
 #include <bsl/safe_integral.hpp>
@@ -48,7 +50,9 @@ namespace lib
     ///   @brief Implements a basic_spinlock_t. Unlike the std::lock_guard_t
     ///     this lock is aware of which PP has acquired the lock. If the same
     ///     PP attempts to acquire the lock, the lock is ignored, and a
-    ///     warning is outputted.
+    ///     warning is outputted. If HYPERVISOR_DEBUG_LOCK_STATS is
+    ///     enabled, the lock also records how often it is contended and
+    ///     how long it is held for (see basic_lock_stats_t).
     ///
     class basic_spinlock_t final
     {
@@ -56,6 +60,8 @@ namespace lib
         bsl::safe_u16 m_ppid;
         /// @brief stores whether or not the lock is acquired
         _Atomic bool m_flag;
+        /// @brief stores the lock's statistics (empty if disabled)
+        [[no_unique_address]] basic_lock_stats_t<> m_stats;
 
     public:
         /// <!-- description -->
@@ -64,7 +70,7 @@ namespace lib
         // We cannot member initialize atomics so this is not possible
         // NOLINTNEXTLINE(bsl-class-member-init)
         constexpr basic_spinlock_t() noexcept    // --
-            : m_ppid{}
+            : m_ppid{}, m_stats{}
         {
             // This is the only way to initialize this
             // NOLINTNEXTLINE(bsl-implicit-conversions-forbidden)
@@ -166,13 +172,25 @@ namespace lib
             ///   overall performance.
             ///
 
+            bool mut_contended{};
+            bsl::safe_u64 mut_spins{};
+
             while (__c11_atomic_exchange(&m_flag, true, __ATOMIC_ACQUIRE)) {
+                mut_contended = true;
                 while (__c11_atomic_load(&m_flag, __ATOMIC_RELAXED)) {
+                    if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                        ++mut_spins;
+                    }
+
                     helpers::yield();
                 }
             }
 
             m_ppid = ~bsl::to_u16(tls.ppid);
+
+            if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                m_stats.acquired(mut_contended, mut_spins, helpers::tsc());
+            }
         }
 
         /// <!-- description -->
@@ -181,6 +199,10 @@ namespace lib
         constexpr void
         unlock() noexcept
         {
+            if constexpr (BASIC_LOCK_STATS_ENABLED) {
+                m_stats.released(helpers::tsc());
+            }
+
             m_ppid = {};
 
             /// NOTE:
@@ -203,6 +225,20 @@ namespace lib
         {
             return static_cast<bool>(m_flag);
         }
+
+        /// <!-- description -->
+        ///   @brief Returns the statistics recorded by this lock. If
+        ///     HYPERVISOR_DEBUG_LOCK_STATS is disabled, the statistics
+        ///     are empty.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the statistics recorded by this lock
+        ///
+        [[nodiscard]] constexpr auto
+        stats() const noexcept -> basic_lock_stats_t<> const &
+        {
+            return m_stats;
+        }
     };
 }
 
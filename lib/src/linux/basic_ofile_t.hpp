@@ -0,0 +1,212 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef BASIC_OFILE_T_HPP
+#define BASIC_OFILE_T_HPP
+
+#include <fcntl.h>       // IWYU pragma: export
+#include <sys/stat.h>    // IWYU pragma: export
+#include <unistd.h>      // IWYU pragma: export
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/errc_type.hpp>
+#include <bsl/expects.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+
+namespace lib
+{
+    /// @brief defines what an error looks like from a POSIX call.
+    constexpr auto OFILE_POSIX_ERROR{-1_i64};
+    /// @brief defines what an invalid file is.
+    constexpr auto OFILE_INVALID_FILE{-1_i32};
+
+    /// <!-- description -->
+    ///   @brief Opens a file as write-only (truncating whatever was there),
+    ///     and appends raw bytes to it via write().
+    ///
+    class basic_ofile_t final
+    {
+        /// @brief stores a handle to the opened file.
+        bsl::safe_i32 m_file{OFILE_INVALID_FILE};
+        /// @brief stores the number of bytes written to the file
+        bsl::safe_umx m_size{};
+
+    public:
+        /// <!-- description -->
+        ///   @brief Creates a lib::basic_ofile_t given a the filename and path
+        ///     of the file to open as write-only.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param filename the filename and path of the file to open
+        ///
+        explicit constexpr basic_ofile_t(bsl::string_view const &filename) noexcept
+        {
+            constexpr auto mode{0644U};
+
+            // We don't have a choice here
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg, hicpp-vararg, hicpp-signed-bitwise)
+            m_file = open(filename.data(), O_WRONLY | O_CREAT | O_TRUNC, mode);
+            if (bsl::unlikely(OFILE_INVALID_FILE == m_file)) {
+                bsl::error() << "failed to open write-only file: "    // --
+                             << filename                              // --
+                             << bsl::endl;                            // --
+
+                return;
+            }
+
+            bsl::touch();
+        }
+
+        /// <!-- description -->
+        ///   @brief Destructor closes a previously opened file.
+        ///
+        constexpr ~basic_ofile_t() noexcept
+        {
+            this->release();
+        }
+
+        /// <!-- description -->
+        ///   @brief copy constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///
+        constexpr basic_ofile_t(basic_ofile_t const &o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief move constructor
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///
+        constexpr basic_ofile_t(basic_ofile_t &&mut_o) noexcept = delete;
+
+        /// <!-- description -->
+        ///   @brief copy assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param o the object being copied
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(basic_ofile_t const &o) &noexcept
+            -> basic_ofile_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief move assignment
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_o the object being moved
+        ///   @return a reference to *this
+        ///
+        [[maybe_unused]] constexpr auto operator=(basic_ofile_t &&mut_o) &noexcept
+            -> basic_ofile_t & = delete;
+
+        /// <!-- description -->
+        ///   @brief Closes the file, releasing all of the resource back to
+        ///     the OS kernel.
+        ///
+        constexpr void
+        release() noexcept
+        {
+            if (OFILE_INVALID_FILE != m_file) {
+                bsl::discard(close(m_file.get()));
+            }
+            else {
+                bsl::touch();
+            }
+
+            m_size = {};
+            m_file = OFILE_INVALID_FILE;
+        }
+
+        /// <!-- description -->
+        ///   @brief Appends size bytes from data to the file. Short writes
+        ///     are retried until all of the bytes have been written.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param data a pointer to the bytes to write
+        ///   @param size the number of bytes to write
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     and friends otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        write(void const *const data, bsl::safe_umx const &size) noexcept -> bsl::errc_type
+        {
+            bsl::expects(nullptr != data);
+            bsl::expects(size.is_valid_and_checked());
+
+            auto const *const bytes{static_cast<bsl::uint8 const *>(data)};
+            auto mut_done{0_umx};
+
+            while (mut_done < size) {
+                auto const ret{bsl::to_i64(::write(
+                    m_file.get(),
+                    // We don't have a choice here
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                    bytes + mut_done.get(),
+                    (size - mut_done).checked().get()))};
+
+                if (bsl::unlikely(OFILE_POSIX_ERROR == ret)) {
+                    bsl::error() << "failed to write to file\n" << bsl::here();
+                    return bsl::errc_failure;
+                }
+
+                mut_done += bsl::to_umx(ret);
+            }
+
+            m_size += size;
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns true if the file was opened successfully
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns true if the file was opened successfully
+        ///
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return OFILE_INVALID_FILE != m_file;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the number of bytes written to the file.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the number of bytes written to the file.
+        ///
+        [[nodiscard]] constexpr auto
+        size() const noexcept -> bsl::safe_umx
+        {
+            return m_size;
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,152 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../include/basic_lock_stats_t.hpp"    // IWYU pragma: keep
+
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"empty stats"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_lock_stats_t<true> const stats{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(stats.acquisitions().is_zero());
+                    bsl::ut_check(stats.contended().is_zero());
+                    bsl::ut_check(stats.spins().is_zero());
+                    bsl::ut_check(stats.hold_total().is_zero());
+                    bsl::ut_check(stats.hold_max().is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"uncontended acquire/release"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_lock_stats_t<true> mut_stats{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_stats.acquired(false, {}, 10_u64);
+                    mut_stats.released(15_u64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(1_u64 == mut_stats.acquisitions());
+                        bsl::ut_check(mut_stats.contended().is_zero());
+                        bsl::ut_check(mut_stats.spins().is_zero());
+                        bsl::ut_check(5_u64 == mut_stats.hold_total());
+                        bsl::ut_check(5_u64 == mut_stats.hold_max());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"contended acquire/release"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_lock_stats_t<true> mut_stats{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_stats.acquired(false, {}, 10_u64);
+                    mut_stats.released(30_u64);
+                    mut_stats.acquired(true, 42_u64, 40_u64);
+                    mut_stats.released(45_u64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(2_u64 == mut_stats.acquisitions());
+                        bsl::ut_check(1_u64 == mut_stats.contended());
+                        bsl::ut_check(42_u64 == mut_stats.spins());
+                        bsl::ut_check(25_u64 == mut_stats.hold_total());
+                        bsl::ut_check(20_u64 == mut_stats.hold_max());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"release with a TSC that went backwards"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_lock_stats_t<true> mut_stats{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_stats.acquired(false, {}, 10_u64);
+                    mut_stats.released(5_u64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(1_u64 == mut_stats.acquisitions());
+                        bsl::ut_check(mut_stats.hold_total().is_zero());
+                        bsl::ut_check(mut_stats.hold_max().is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"dump"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                basic_lock_stats_t<true> mut_stats{};
+                basic_lock_stats_t<true> const unused{};
+                basic_lock_stats_t<false> const disabled{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_stats.acquired(false, {}, 10_u64);
+                    mut_stats.released(30_u64);
+                    mut_stats.acquired(true, 42_u64, 40_u64);
+                    mut_stats.released(45_u64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_stats.dump_header();
+                        mut_stats.dump("used");
+                        unused.dump("unused");
+                        mut_stats.dump_footer();
+
+                        disabled.dump_header();
+                        disabled.dump("disabled");
+                        disabled.dump_footer();
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
@@ -0,0 +1,77 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../include/basic_lock_stats_t.hpp"    // IWYU pragma: keep
+
+#include <bsl/ut.hpp>
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::ut_scenario{"verify noexcept"} = []() noexcept {
+        bsl::ut_given{} = []() noexcept {
+            lib::basic_lock_stats_t<true> mut_stats{};
+            lib::basic_lock_stats_t<true> const stats{};
+            lib::basic_lock_stats_t<false> mut_empty{};
+            bsl::ut_then{} = []() noexcept {
+                static_assert(noexcept(lib::basic_lock_stats_t<true>{}));
+                static_assert(noexcept(lib::basic_lock_stats_t<false>{}));
+
+                static_assert(noexcept(mut_stats.acquired({}, {}, {})));
+                static_assert(noexcept(mut_stats.released({})));
+                static_assert(noexcept(mut_stats.acquisitions()));
+                static_assert(noexcept(mut_stats.contended()));
+                static_assert(noexcept(mut_stats.spins()));
+                static_assert(noexcept(mut_stats.hold_total()));
+                static_assert(noexcept(mut_stats.hold_max()));
+                static_assert(noexcept(mut_stats.dump_header()));
+                static_assert(noexcept(mut_stats.dump_footer()));
+                static_assert(noexcept(mut_stats.dump({})));
+
+                static_assert(noexcept(stats.acquisitions()));
+                static_assert(noexcept(stats.contended()));
+                static_assert(noexcept(stats.spins()));
+                static_assert(noexcept(stats.hold_total()));
+                static_assert(noexcept(stats.hold_max()));
+                static_assert(noexcept(stats.dump({})));
+
+                static_assert(noexcept(mut_empty.acquired({}, {}, {})));
+                static_assert(noexcept(mut_empty.released({})));
+                static_assert(noexcept(mut_empty.dump_header()));
+                static_assert(noexcept(mut_empty.dump_footer()));
+                static_assert(noexcept(mut_empty.dump({})));
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -0,0 +1,97 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../include/basic_shared_lock_guard_t.hpp"    // IWYU pragma: keep
+
+#include <basic_rwlock_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"lock/unlock"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_rwlock_t mut_rwlock{};
+                bsl::ut_then{} = [&]() noexcept {
+                    {
+                        bsl::ut_check(mut_rwlock.readers().is_zero());
+                        basic_shared_lock_guard_t mut_lock{tls_t{}, mut_rwlock};
+                        bsl::ut_check(mut_rwlock.readers() == bsl::safe_u64::magic_1());
+                        bsl::ut_check(!mut_rwlock.is_locked());
+                    }
+                    bsl::ut_check(mut_rwlock.readers().is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"nested guards"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_rwlock_t mut_rwlock{};
+                bsl::ut_then{} = [&]() noexcept {
+                    {
+                        basic_shared_lock_guard_t mut_lock1{tls_t{}, mut_rwlock};
+                        {
+                            basic_shared_lock_guard_t mut_lock2{tls_t{}, mut_rwlock};
+                            bsl::ut_check(mut_rwlock.readers() == 2_u64);
+                        }
+                        bsl::ut_check(mut_rwlock.readers() == bsl::safe_u64::magic_1());
+                    }
+                    bsl::ut_check(mut_rwlock.readers().is_zero());
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
@@ -0,0 +1,119 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../mocks/basic_ofile_t.hpp"
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_ofile_t mut_ofile{"success"};
+                bsl::array<bsl::uint8, 4_umx.get()> const data{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!!mut_ofile);
+                    bsl::ut_check(mut_ofile.size().is_zero());
+                    bsl::ut_check(mut_ofile.write(data.data(), data.size()));
+                    bsl::ut_check(mut_ofile.write(data.data(), data.size()));
+                    bsl::ut_check(8_umx == mut_ofile.size());
+                };
+                bsl::ut_cleanup{} = [&]() noexcept {
+                    mut_ofile.release();
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write nullptr"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_ofile_t mut_ofile{"success"};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_ofile.write(nullptr, 4_umx));
+                    bsl::ut_check(mut_ofile.size().is_zero());
+                };
+            };
+        };
+
+        bsl::ut_scenario{"failure"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_ofile_t mut_ofile{"failure"};
+                bsl::array<bsl::uint8, 4_umx.get()> const data{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_ofile);
+                    bsl::ut_check(!mut_ofile.write(data.data(), data.size()));
+                    bsl::ut_check(mut_ofile.size().is_zero());
+                };
+                bsl::ut_cleanup{} = [&]() noexcept {
+                    mut_ofile.release();
+                };
+            };
+        };
+
+        bsl::ut_scenario{"write failure"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                basic_ofile_t mut_ofile{"write_failure"};
+                bsl::array<bsl::uint8, 4_umx.get()> const data{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!!mut_ofile);
+                    bsl::ut_check(!mut_ofile.write(data.data(), data.size()));
+                    bsl::ut_check(mut_ofile.size().is_zero());
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
@@ -62,17 +62,21 @@ main() noexcept -> bsl::exit_code
 
                 static_assert(noexcept(mut_pool.allocate<lib::basic_page_4k_t>(mut_tls)));
                 static_assert(noexcept(mut_pool.deallocate<lib::basic_page_4k_t>(mut_tls, {})));
+                static_assert(noexcept(mut_pool.zero_pages(mut_tls, {})));
+                static_assert(noexcept(mut_pool.zero_cached_pages(mut_tls, {})));
                 static_assert(noexcept(mut_pool.size()));
                 static_assert(noexcept(mut_pool.allocated(mut_tls)));
                 static_assert(noexcept(mut_pool.remaining(mut_tls)));
                 static_assert(noexcept(mut_pool.virt_to_phys<lib::basic_page_4k_t>(&mut_page)));
                 // static_assert(noexcept(mut_pool.phys_to_virt<lib::basic_page_4k_t>({})));
                 static_assert(noexcept(mut_pool.dump(mut_tls)));
+                static_assert(noexcept(mut_pool.dump_locks()));
 
                 static_assert(noexcept(pool.size()));
                 static_assert(noexcept(pool.allocated(mut_tls)));
                 static_assert(noexcept(pool.remaining(mut_tls)));
                 static_assert(noexcept(pool.dump(mut_tls)));
+                static_assert(noexcept(pool.dump_locks()));
             };
         };
     };
@@ -503,6 +503,111 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"map_range"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1000_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x4_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, {})};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x0_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x4_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, {})};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!ret.ret);
+                        bsl::ut_check(ret.pages.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1000_u64};
+                constexpr auto pages{0x4_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{mut_rpt.unmap_range(mut_tls, mut_page_pool, virt, pages)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x0_u64};
+                constexpr auto pages{0x4_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{mut_rpt.unmap_range(mut_tls, mut_page_pool, virt, pages)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!ret.ret);
+                        bsl::ut_check(ret.pages.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tables"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 1_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"entries"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 root_page_table_t mut_rpt{};
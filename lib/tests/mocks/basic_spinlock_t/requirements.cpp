@@ -60,8 +60,10 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_spinlock.lock(lib::tls_t{})));
                 static_assert(noexcept(mut_spinlock.unlock()));
                 static_assert(noexcept(mut_spinlock.is_locked()));
+                static_assert(noexcept(mut_spinlock.stats()));
 
                 static_assert(noexcept(spinlock.is_locked()));
+                static_assert(noexcept(spinlock.stats()));
             };
         };
     };
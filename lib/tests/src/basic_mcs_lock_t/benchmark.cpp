@@ -0,0 +1,195 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/basic_mcs_lock_t.hpp"
+#include "../../../src/basic_spinlock_t.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the number of threads that fight over each lock
+    constexpr auto BENCHMARK_THREADS{8_umx};
+    /// @brief defines the number of times each thread acquires the lock
+    constexpr auto BENCHMARK_ITERATIONS{20000_umx};
+
+    /// @brief defines the basic_mcs_lock_t used by the benchmark
+    using mcs_lock_t = basic_mcs_lock_t<BENCHMARK_THREADS.get()>;
+
+    /// @brief defines the basic_spinlock_t that is benchmarked
+    constinit basic_spinlock_t g_mut_spinlock{};
+    /// @brief defines the basic_mcs_lock_t that is benchmarked
+    constinit mcs_lock_t g_mut_mcs_lock{};
+    /// @brief stores the counter that is protected by the lock
+    constinit bsl::safe_u64 g_mut_counter{};
+    /// @brief stores the longest that each thread waited for the lock (ns)
+    constinit bsl::array<bsl::safe_u64, BENCHMARK_THREADS.get()> g_mut_worst{};
+    /// @brief used to release all of the threads at the same time
+    constinit std::atomic<bool> g_mut_go{};
+
+    /// <!-- description -->
+    ///   @brief Acquires and releases the provided lock
+    ///     BENCHMARK_ITERATIONS times, recording the longest that this
+    ///     thread had to wait to acquire the lock.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LOCK_TYPE the type of lock to benchmark
+    ///   @param pmut_lock the lock to benchmark
+    ///   @param ppid the ppid to use for this thread
+    ///
+    template<typename LOCK_TYPE>
+    void
+    benchmark_thread(LOCK_TYPE *const pmut_lock, bsl::safe_u16 const &ppid) noexcept
+    {
+        tls_t mut_tls{};
+        mut_tls.ppid = ppid.get();
+
+        while (!g_mut_go) {
+            helpers::yield();
+        }
+
+        bsl::safe_u64 mut_worst{};
+        for (bsl::safe_idx mut_i{}; mut_i < BENCHMARK_ITERATIONS; ++mut_i) {
+            auto const start{std::chrono::steady_clock::now()};
+            pmut_lock->lock(mut_tls);
+            auto const stop{std::chrono::steady_clock::now()};
+            ++g_mut_counter;
+            pmut_lock->unlock();
+
+            auto const wait{std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)};
+            auto const wait_ns{bsl::to_u64(static_cast<bsl::uint64>(wait.count()))};
+            if (wait_ns > mut_worst) {
+                mut_worst = wait_ns;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        *g_mut_worst.at_if(bsl::to_idx(ppid)) = mut_worst;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs the benchmark for the provided lock and outputs the
+    ///     average cost of each lock/unlock pair, as well as the longest
+    ///     time any one thread had to wait for the lock, which is where an
+    ///     unfair lock shows up.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LOCK_TYPE the type of lock to benchmark
+    ///   @param pmut_lock the lock to benchmark
+    ///   @param name the name of the lock to output
+    ///   @return Returns the value of the counter protected by the lock
+    ///
+    template<typename LOCK_TYPE>
+    [[nodiscard]] auto
+    benchmark(LOCK_TYPE *const pmut_lock, bsl::string_view const &name) noexcept -> bsl::safe_u64
+    {
+        bsl::array<std::thread, BENCHMARK_THREADS.get()> mut_threads{};
+
+        g_mut_counter = {};
+        g_mut_worst = {};
+        g_mut_go = false;
+
+        for (bsl::safe_idx mut_i{}; mut_i < BENCHMARK_THREADS; ++mut_i) {
+            *mut_threads.at_if(mut_i) =
+                std::thread{&benchmark_thread<LOCK_TYPE>, pmut_lock, bsl::to_u16(mut_i)};
+        }
+
+        auto const start{std::chrono::steady_clock::now()};
+        g_mut_go = true;
+
+        for (bsl::safe_idx mut_i{}; mut_i < BENCHMARK_THREADS; ++mut_i) {
+            mut_threads.at_if(mut_i)->join();
+        }
+
+        auto const stop{std::chrono::steady_clock::now()};
+        auto const total{std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start)};
+        auto const total_ns{bsl::to_u64(static_cast<bsl::uint64>(total.count()))};
+
+        bsl::safe_u64 mut_worst{};
+        for (auto const &worst : g_mut_worst) {
+            if (worst > mut_worst) {
+                mut_worst = worst;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        constexpr auto ops{(BENCHMARK_THREADS * BENCHMARK_ITERATIONS).checked()};
+        auto const avg_ns{(total_ns / ops).checked()};
+
+        bsl::print() << bsl::mag << bsl::fmt{"<18s", name};
+        bsl::print() << bsl::rst << "avg: " << bsl::cyn << bsl::fmt{"6d", avg_ns} << " ns";
+        bsl::print() << bsl::rst << ", worst wait: ";
+        bsl::print() << bsl::cyn << bsl::fmt{"10d", mut_worst} << " ns";
+        bsl::print() << bsl::rst << bsl::endl;
+
+        return g_mut_counter;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this benchmark. Each lock is hammered by
+///     BENCHMARK_THREADS threads at the same time so that the cost of
+///     contention (and the fairness of each lock) can be compared. If a
+///     call to bsl::ut_check() fails the application will fast fail. If
+///     all calls to bsl::ut_check() pass, this function will successfully
+///     return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    bsl::ut_scenario{"lock contention"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            constexpr auto expected{(lib::BENCHMARK_THREADS * lib::BENCHMARK_ITERATIONS).checked()};
+            bsl::ut_then{} = [&]() noexcept {
+                auto const spinlock{lib::benchmark(&lib::g_mut_spinlock, "basic_spinlock_t")};
+                bsl::ut_check(spinlock == expected);
+
+                auto const mcs_lock{lib::benchmark(&lib::g_mut_mcs_lock, "basic_mcs_lock_t")};
+                bsl::ut_check(mcs_lock == expected);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -40,6 +40,8 @@ namespace lib
     constexpr auto POOL_SIZE{3_umx};
     /// @brief only used by the dump test as this is too large for the stack
     constexpr auto LARGE_POOL_SIZE{2048_umx};
+    /// @brief used to make sure that the PP cache is filled and drained
+    constexpr auto CACHE_TEST_SIZE{(BASIC_PAGE_POOL_CACHE_SIZE * 3_umx).checked()};
 
     /// @brief used for dump to prevent the unit test from running out of stack
     bsl::array<basic_page_pool_node_t, LARGE_POOL_SIZE.get()> g_mut_pool{};
@@ -184,6 +186,224 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"deallocate then allocate uses the pp cache"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    auto *const pmut_nd0{mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                    bsl::ut_required_step(pmut_nd0 == mut_pool.at_if(0_idx));
+                    mut_page_pool.deallocate<nd_t>(mut_tls, pmut_nd0);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd1{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd1 == mut_pool.at_if(0_idx));
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls) == HYPERVISOR_PAGE_SIZE);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate from more than one pp"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                bool mut_return_nullptr{true};
+                auto const expected{(2_umx * HYPERVISOR_PAGE_SIZE).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls1.ppid = bsl::safe_u16::magic_1().get();
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    auto *const pmut_nd0{
+                        mut_page_pool.allocate<nd_t>(mut_tls0, mut_return_nullptr)};
+                    bsl::ut_required_step(pmut_nd0 == mut_pool.at_if(0_idx));
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd1{
+                            mut_page_pool.allocate<nd_t>(mut_tls1, mut_return_nullptr)};
+                        bsl::ut_check(pmut_nd1 == mut_pool.at_if(1_idx));
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls1) == expected);
+                        mut_page_pool.deallocate<nd_t>(mut_tls1, pmut_nd0);
+                        mut_page_pool.deallocate<nd_t>(mut_tls1, pmut_nd1);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls1).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"allocate steals pre-zeroed pages from another pp"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls0{};
+                tls_t mut_tls1{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls1.ppid = bsl::safe_u16::magic_1().get();
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    mut_page_pool.zero_pages(mut_tls0, BASIC_PAGE_POOL_CACHE_BATCH);
+                    bsl::ut_then{} = [&]() noexcept {
+                        auto *const pmut_nd0{
+                            mut_page_pool.allocate<nd_t>(mut_tls1, mut_return_nullptr)};
+                        bsl::ut_check(nullptr != pmut_nd0);
+                        bsl::ut_check(nullptr == pmut_nd0->next);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls0) == HYPERVISOR_PAGE_SIZE);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"deallocate drains the pp cache"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::span mut_view{g_mut_pool};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::array<nd_t *, CACHE_TEST_SIZE.get()> mut_nds{};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    for (auto &mut_nd : mut_nds) {
+                        mut_nd = mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr);
+                        bsl::ut_required_step(nullptr != mut_nd);
+                    }
+                    bsl::ut_then{} = [&]() noexcept {
+                        for (auto &mut_nd : mut_nds) {
+                            mut_page_pool.deallocate<nd_t>(mut_tls, mut_nd);
+                        }
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+                        bsl::ut_check(mut_page_pool.remaining(mut_tls) == mut_page_pool.size());
+                        mut_page_pool.dump(mut_tls);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"zero_pages"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    mut_page_pool.zero_pages(mut_tls, BASIC_PAGE_POOL_CACHE_BATCH);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+                        auto *const pmut_nd0{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        auto *const pmut_nd1{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        auto *const pmut_nd2{
+                            mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                        bsl::ut_check(nullptr != pmut_nd0);
+                        bsl::ut_check(nullptr != pmut_nd1);
+                        bsl::ut_check(nullptr != pmut_nd2);
+                        bsl::ut_check(nullptr == pmut_nd0->next);
+                        bsl::ut_check(nullptr == pmut_nd1->next);
+                        bsl::ut_check(nullptr == pmut_nd2->next);
+                        bsl::ut_check(
+                            nullptr == mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"zero_pages is bounded"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    mut_page_pool.zero_pages(mut_tls, 1_umx);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr == mut_pool.at_if(0_idx)->next);
+                        bsl::ut_check(nullptr != mut_pool.at_if(1_idx)->next);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"zero_pages with dirty pages in the pp cache"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    auto *const pmut_nd0{mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                    bsl::ut_required_step(nullptr != pmut_nd0);
+                    mut_page_pool.deallocate<nd_t>(mut_tls, pmut_nd0);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_page_pool.zero_pages(mut_tls, BASIC_PAGE_POOL_CACHE_BATCH);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+                        bsl::ut_check(mut_page_pool.remaining(mut_tls) == mut_page_pool.size());
+                        mut_page_pool.dump(mut_tls);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"zero_cached_pages never refills"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    mut_page_pool.zero_cached_pages(mut_tls, BASIC_PAGE_POOL_CACHE_BATCH);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(nullptr != mut_pool.at_if(0_idx)->next);
+                        bsl::ut_check(nullptr != mut_pool.at_if(1_idx)->next);
+                        bsl::ut_check(mut_page_pool.remaining(mut_tls) == mut_page_pool.size());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"zero_cached_pages with dirty pages in the pp cache"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                pool_t mut_page_pool{};
+                bsl::array<basic_page_pool_node_t, POOL_SIZE.get()> mut_pool{};
+                bsl::span mut_view{mut_pool};
+                tls_t mut_tls{};
+                bool mut_return_nullptr{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    initialize_pool(mut_view);
+                    mut_page_pool.initialize(mut_view);
+                    auto *const pmut_nd0{mut_page_pool.allocate<nd_t>(mut_tls, mut_return_nullptr)};
+                    bsl::ut_required_step(nullptr != pmut_nd0);
+                    mut_page_pool.deallocate<nd_t>(mut_tls, pmut_nd0);
+                    bsl::ut_required_step(nullptr != pmut_nd0->next);
+                    bsl::ut_then{} = [&]() noexcept {
+                        mut_page_pool.zero_cached_pages(mut_tls, 1_umx);
+                        bsl::ut_check(nullptr == pmut_nd0->next);
+                        bsl::ut_check(mut_page_pool.allocated(mut_tls).is_zero());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"size"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 pool_t mut_page_pool{};
@@ -1229,6 +1229,551 @@ namespace lib
             };
         };
 
+        bsl::ut_scenario{"map_range across a 2m boundary"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1FE000_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x4_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                        for (bsl::safe_umx mut_i{}; mut_i < pages; ++mut_i) {
+                            auto const offs{(bsl::to_u64(mut_i) << BASIC_PAGE_4K_T_SHFT).checked()};
+                            auto const ents{mut_rpt.entries<l0e_t>(
+                                mut_tls, mut_page_pool, (virt + offs).checked())};
+                            bsl::ut_check(nullptr != ents.l0e);
+                            bsl::ut_check(ents.l0e->auto_release == disabled);
+                            bsl::ut_check(ents.l0e->points_to_block == enabled);
+                            bsl::ut_check(ents.l0e->explicit_unmap == disabled);
+                            bsl::ut_check(
+                                ents.l0e->phys == ((phys + offs) >> BASIC_PAGE_4K_T_SHFT));
+                        }
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range as explicit unmap"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x0_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x2_umx};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{true};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{mut_rpt.map_range(
+                        mut_tls, mut_page_pool, virt, phys, pages, flgs, explicit_unmap)};
+                    auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l0e->explicit_unmap == enabled);
+                    };
+                    bsl::ut_required_step(
+                        mut_rpt.unmap_range(mut_tls, mut_page_pool, virt, pages).ret);
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range on an already mapped page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x0_u64};
+                constexpr auto mapped{0x2000_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x4_umx};
+                constexpr auto expected{0x2_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l0e_t>(mut_tls, mut_page_pool, mapped, phys, flgs));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!ret.ret);
+                        bsl::ut_check(ret.pages == expected);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range add_table (l0t_t) fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x0_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x4_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_page_pool.set_allocate<helpers::l0t_t>(nullptr, phys);
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!ret.ret);
+                        bsl::ut_check(ret.pages.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range overflow"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0xFFFFFFFFFFFFF000_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x2_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!ret.ret);
+                        bsl::ut_check(ret.pages == bsl::safe_umx::magic_1());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range across a 2m boundary"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1FE000_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x4_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs).ret);
+                    auto const ret{mut_rpt.unmap_range(mut_tls, mut_page_pool, virt, pages)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr == ents.l0e);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range with pages that were never mapped"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x0_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto mapped{0x2_umx};
+                constexpr auto pages{0x4_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, mapped, flgs).ret);
+                    auto const ret{mut_rpt.unmap_range(mut_tls, mut_page_pool, virt, pages)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!ret.ret);
+                        bsl::ut_check(ret.pages == mapped);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range never mapped"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x0_u64};
+                constexpr auto pages{0x4_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{mut_rpt.unmap_range(mut_tls, mut_page_pool, virt, pages)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!ret.ret);
+                        bsl::ut_check(ret.pages.is_zero());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range promotes to a 2m page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x200000_u64};
+                constexpr auto phys{0x400000_u64};
+                constexpr auto pages{0x201_umx};
+                constexpr auto flgs{0x0_u64};
+                constexpr auto last{0x400000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                        auto const ents1{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents1.l1e);
+                        bsl::ut_check(ents1.l1e->points_to_block == enabled);
+                        bsl::ut_check(ents1.l1e->phys == (phys >> BASIC_PAGE_4K_T_SHFT));
+                        auto const ents0{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, last)};
+                        bsl::ut_check(nullptr != ents0.l0e);
+                        bsl::ut_check(
+                            ents0.l0e->phys == ((phys + (last - virt)) >> BASIC_PAGE_4K_T_SHFT));
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 4_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range promotes to a 1g page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x40000000_u64};
+                constexpr auto phys{0x80000000_u64};
+                constexpr auto pages{0x40000_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                        auto const ents{mut_rpt.entries<l2e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents.l2e);
+                        bsl::ut_check(ents.l2e->points_to_block == enabled);
+                        bsl::ut_check(ents.l2e->phys == (phys >> BASIC_PAGE_4K_T_SHFT));
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 2_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range does not promote when phys is not aligned"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x200000_u64};
+                constexpr auto phys{0x201000_u64};
+                constexpr auto pages{0x200_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l0e->phys == (phys >> BASIC_PAGE_4K_T_SHFT));
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 4_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"map_range does not promote over an existing map"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x200000_u64};
+                constexpr auto phys{0x400000_u64};
+                constexpr auto pages{0x200_umx};
+                constexpr auto flgs{0x0_u64};
+                constexpr auto last{0x3FF000_u64};
+                bsl::dontcare_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map<l0e_t>(mut_tls, mut_page_pool, last, phys, flgs, {}, mut_sys));
+                    auto const ret{
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!ret.ret);
+                        bsl::ut_check(ret.pages == (pages - bsl::safe_umx::magic_1()).checked());
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap splits a 2m page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x200000_u64};
+                constexpr auto phys{0x400000_u64};
+                constexpr auto pages{0x200_umx};
+                constexpr auto flgs{0x0_u64};
+                constexpr auto page{0x201000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs).ret);
+                    bsl::ut_required_step(mut_rpt.tables(mut_tls, mut_page_pool) == 3_umx);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, page));
+                        auto const ents{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents.l0e);
+                        bsl::ut_check(ents.l0e->points_to_block == enabled);
+                        bsl::ut_check(ents.l0e->phys == (phys >> BASIC_PAGE_4K_T_SHFT));
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 4_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap splits a 2m page add_table (l0t_t) fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x200000_u64};
+                constexpr auto phys{0x400000_u64};
+                constexpr auto pages{0x200_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_page_pool.set_allocate<helpers::l0t_t>(nullptr, phys);
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs).ret);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_rpt.unmap<l0e_t>(mut_tls, mut_page_pool, virt));
+                        auto const ents{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents.l1e);
+                        bsl::ut_check(ents.l1e->points_to_block == enabled);
+                        bsl::ut_check(ents.l1e->phys == (phys >> BASIC_PAGE_4K_T_SHFT));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range splits a 1g page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x40000000_u64};
+                constexpr auto phys{0x80000000_u64};
+                constexpr auto pages{0x40000_umx};
+                constexpr auto flgs{0x0_u64};
+                constexpr auto page{0x40001000_u64};
+                constexpr auto next{0x40200000_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs).ret);
+                    auto const ret{mut_rpt.unmap_range(mut_tls, mut_page_pool, page, 1_umx)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == 1_umx);
+                        auto const ents0{mut_rpt.entries<l0e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents0.l0e);
+                        bsl::ut_check(ents0.l0e->phys == (phys >> BASIC_PAGE_4K_T_SHFT));
+                        auto const ents1{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, next)};
+                        bsl::ut_check(nullptr != ents1.l1e);
+                        bsl::ut_check(ents1.l1e->points_to_block == enabled);
+                        bsl::ut_check(
+                            ents1.l1e->phys == ((phys + (next - virt)) >> BASIC_PAGE_4K_T_SHFT));
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 4_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range releases a 2m page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x200000_u64};
+                constexpr auto phys{0x400000_u64};
+                constexpr auto pages{0x200_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs).ret);
+                    auto const ret{mut_rpt.unmap_range(mut_tls, mut_page_pool, virt, pages)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == pages);
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 1_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"unmap_range releases a 2m page from a 1g page"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x40000000_u64};
+                constexpr auto phys{0x80000000_u64};
+                constexpr auto pages{0x40000_umx};
+                constexpr auto flgs{0x0_u64};
+                constexpr auto page{0x40200000_u64};
+                constexpr auto span{0x200_umx};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(
+                        mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs).ret);
+                    auto const ret{mut_rpt.unmap_range(mut_tls, mut_page_pool, page, span)};
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(ret.ret);
+                        bsl::ut_check(ret.pages == span);
+                        auto const ents{mut_rpt.entries<l1e_t>(mut_tls, mut_page_pool, virt)};
+                        bsl::ut_check(nullptr != ents.l1e);
+                        bsl::ut_check(ents.l1e->points_to_block == enabled);
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 3_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"tables"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1FE000_u64};
+                constexpr auto phys{0x1000_u64};
+                constexpr auto pages{0x4_umx};
+                constexpr auto flgs{0x0_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 1_umx);
+                        bsl::ut_check(
+                            mut_rpt.map_range(mut_tls, mut_page_pool, virt, phys, pages, flgs).ret);
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 5_umx);
+                        bsl::ut_check(mut_rpt.unmap_range(mut_tls, mut_page_pool, virt, pages).ret);
+                        bsl::ut_check(mut_rpt.tables(mut_tls, mut_page_pool) == 1_umx);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"add_tables removes stale aliases"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                root_page_table_t mut_rpt0{};
+                root_page_table_t mut_rpt1{};
+                tls_t mut_tls{};
+                page_pool_t mut_page_pool{};
+                constexpr auto virt{0x1000_u64};
+                constexpr auto phys{0x2000_u64};
+                constexpr auto flgs{0x0_u64};
+                bool const explicit_unmap{true};
+                bsl::dontcare_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_rpt0.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt1.initialize(mut_tls, mut_page_pool));
+                    bsl::ut_required_step(mut_rpt0.map<l0e_t>(
+                        mut_tls, mut_page_pool, virt, phys, flgs, explicit_unmap, mut_sys));
+                    mut_rpt1.add_tables(mut_tls, mut_rpt0);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(
+                            nullptr != mut_rpt1.entries<l0e_t>(mut_tls, mut_page_pool, virt).l0e);
+                        bsl::ut_check(mut_rpt0.unmap(mut_tls, mut_page_pool, virt));
+                        mut_rpt1.add_tables(mut_tls, mut_rpt0);
+                        bsl::ut_check(
+                            nullptr == mut_rpt1.entries<l0e_t>(mut_tls, mut_page_pool, virt).l0e);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        mut_rpt1.release(mut_tls, mut_page_pool);
+                        mut_rpt0.release(mut_tls, mut_page_pool);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"allocate_page"} = [&]() noexcept {
             bsl::ut_given{} = [&]() noexcept {
                 root_page_table_t mut_rpt{};
@@ -0,0 +1,245 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/basic_root_page_table_t.hpp"
+
+#include <basic_map_page_flags.hpp>
+#include <basic_page_4k_t.hpp>
+#include <basic_page_pool_t.hpp>
+#include <chrono>
+#include <intrinsic_t.hpp>
+#include <l0e_t.hpp>
+#include <l1e_t.hpp>
+#include <l2e_t.hpp>
+#include <l3e_t.hpp>
+#include <tls_t.hpp>
+
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/discard.hpp>
+#include <bsl/dontcare_t.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/touch.hpp>
+#include <bsl/unlikely.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the page_pool_t used by the microkernel
+    using page_pool_t = lib::basic_page_pool_t<tls_t>;
+
+    /// @brief defines the root_page_table_t used by the microkernel
+    using root_page_table_t = lib::basic_root_page_table_t<
+        tls_t,
+        bsl::dontcare_t,
+        page_pool_t,
+        intrinsic_t,
+        l3e_t,
+        l2e_t,
+        l1e_t,
+        l0e_t>;
+
+    /// @brief defines the number of 4k pages to map (256 MiB)
+    constexpr auto BENCHMARK_PAGES{0x10000_umx};
+    /// @brief defines the virtual address to start mapping at
+    constexpr auto BENCHMARK_VIRT{0x40000000_u64};
+    /// @brief defines the physical address to start mapping at
+    constexpr auto BENCHMARK_PHYS{0x80000000_u64};
+
+    /// <!-- description -->
+    ///   @brief Outputs how long it took to map and unmap
+    ///     BENCHMARK_PAGES pages, and how many pages were needed to store
+    ///     the page tables while the pages were mapped.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param name the name of the approach that was benchmarked
+    ///   @param map_us the number of microseconds it took to map
+    ///   @param unmap_us the number of microseconds it took to unmap
+    ///   @param tables the number of page table pages after the map
+    ///
+    void
+    output(
+        bsl::string_view const &name,
+        bsl::safe_u64 const &map_us,
+        bsl::safe_u64 const &unmap_us,
+        bsl::safe_umx const &tables) noexcept
+    {
+        bsl::print() << bsl::mag << bsl::fmt{"<18s", name};
+        bsl::print() << bsl::rst << "map: " << bsl::cyn << bsl::fmt{"10d", map_us} << " us";
+        bsl::print() << bsl::rst << ", unmap: ";
+        bsl::print() << bsl::cyn << bsl::fmt{"10d", unmap_us} << " us";
+        bsl::print() << bsl::rst << ", tables: ";
+        bsl::print() << bsl::cyn << bsl::fmt{"6d", tables};
+        bsl::print() << bsl::rst << bsl::endl;
+    }
+
+    /// <!-- description -->
+    ///   @brief Returns the number of microseconds between start and stop
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param start the start time
+    ///   @param stop the stop time
+    ///   @return Returns the number of microseconds between start and stop
+    ///
+    [[nodiscard]] auto
+    elapsed(
+        std::chrono::steady_clock::time_point const &start,
+        std::chrono::steady_clock::time_point const &stop) noexcept -> bsl::safe_u64
+    {
+        auto const total{std::chrono::duration_cast<std::chrono::microseconds>(stop - start)};
+        return bsl::to_u64(static_cast<bsl::uint64>(total.count()));
+    }
+
+    /// <!-- description -->
+    ///   @brief Maps and unmaps BENCHMARK_PAGES pages one page at a time
+    ///     using map()/unmap().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the number of pages that were mapped and unmapped
+    ///
+    [[nodiscard]] auto
+    benchmark_map() noexcept -> bsl::safe_umx
+    {
+        root_page_table_t mut_rpt{};
+        tls_t mut_tls{};
+        page_pool_t mut_page_pool{};
+        bsl::safe_umx mut_done{};
+
+        if (bsl::unlikely(!mut_rpt.initialize(mut_tls, mut_page_pool))) {
+            return {};
+        }
+
+        auto const map_start{std::chrono::steady_clock::now()};
+        for (bsl::safe_umx mut_i{}; mut_i < BENCHMARK_PAGES; ++mut_i) {
+            auto const offs{(bsl::to_u64(mut_i) << BASIC_PAGE_4K_T_SHFT).checked()};
+            auto const virt{(BENCHMARK_VIRT + offs).checked()};
+            auto const phys{(BENCHMARK_PHYS + offs).checked()};
+            if (mut_rpt.map(mut_tls, mut_page_pool, virt, phys, BASIC_MAP_PAGE_RW)) {
+                ++mut_done;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+        auto const map_stop{std::chrono::steady_clock::now()};
+        auto const tables{mut_rpt.tables(mut_tls, mut_page_pool)};
+
+        auto const unmap_start{std::chrono::steady_clock::now()};
+        for (bsl::safe_umx mut_i{}; mut_i < BENCHMARK_PAGES; ++mut_i) {
+            auto const offs{(bsl::to_u64(mut_i) << BASIC_PAGE_4K_T_SHFT).checked()};
+            auto const virt{(BENCHMARK_VIRT + offs).checked()};
+            bsl::discard(mut_rpt.unmap(mut_tls, mut_page_pool, virt));
+        }
+        auto const unmap_stop{std::chrono::steady_clock::now()};
+
+        output(
+            "map/unmap",
+            elapsed(map_start, map_stop),
+            elapsed(unmap_start, unmap_stop),
+            tables);
+
+        mut_rpt.release(mut_tls, mut_page_pool);
+        return mut_done;
+    }
+
+    /// <!-- description -->
+    ///   @brief Maps and unmaps BENCHMARK_PAGES pages using
+    ///     map_range()/unmap_range().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the number of pages that were mapped and unmapped
+    ///
+    [[nodiscard]] auto
+    benchmark_map_range() noexcept -> bsl::safe_umx
+    {
+        root_page_table_t mut_rpt{};
+        tls_t mut_tls{};
+        page_pool_t mut_page_pool{};
+
+        if (bsl::unlikely(!mut_rpt.initialize(mut_tls, mut_page_pool))) {
+            return {};
+        }
+
+        auto const map_start{std::chrono::steady_clock::now()};
+        auto const mapped{mut_rpt.map_range(
+            mut_tls,
+            mut_page_pool,
+            BENCHMARK_VIRT,
+            BENCHMARK_PHYS,
+            BENCHMARK_PAGES,
+            BASIC_MAP_PAGE_RW)};
+        auto const map_stop{std::chrono::steady_clock::now()};
+        auto const tables{mut_rpt.tables(mut_tls, mut_page_pool)};
+
+        auto const unmap_start{std::chrono::steady_clock::now()};
+        auto const unmapped{
+            mut_rpt.unmap_range(mut_tls, mut_page_pool, BENCHMARK_VIRT, BENCHMARK_PAGES)};
+        auto const unmap_stop{std::chrono::steady_clock::now()};
+
+        output(
+            "map/unmap_range",
+            elapsed(map_start, map_stop),
+            elapsed(unmap_start, unmap_stop),
+            tables);
+
+        mut_rpt.release(mut_tls, mut_page_pool);
+        if (mapped.pages != unmapped.pages) {
+            return {};
+        }
+
+        return mapped.pages;
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this benchmark. The same region is mapped
+///     and unmapped one page at a time, and then again using the range
+///     versions of map and unmap, so that the cost of walking (and
+///     locking) the page tables for every page can be compared. Since the
+///     region is 2m aligned, map_range() promotes it to 2m pages, which
+///     is reflected in the number of page table pages that are reported.
+///     If a call to bsl::ut_check() fails the application will fast fail.
+///     If all calls to bsl::ut_check() pass, this function will
+///     successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    bsl::ut_scenario{"map range"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                bsl::ut_check(lib::benchmark_map() == lib::BENCHMARK_PAGES);
+                bsl::ut_check(lib::benchmark_map_range() == lib::BENCHMARK_PAGES);
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
@@ -95,6 +95,8 @@ main() noexcept -> bsl::exit_code
                     mut_rpt.allocate_page<lib::basic_page_4k_t>(mut_tls, mut_page_pool, {}, {})));
                 static_assert(noexcept(mut_rpt.allocate_page<>(mut_tls, mut_page_pool)));
                 static_assert(noexcept(mut_rpt.unmap(mut_tls, mut_page_pool, {})));
+                static_assert(noexcept(mut_rpt.map_range(mut_tls, mut_page_pool, {}, {}, {}, {})));
+                static_assert(noexcept(mut_rpt.unmap_range(mut_tls, mut_page_pool, {}, {})));
                 static_assert(noexcept(mut_rpt.entries(mut_tls, mut_page_pool, {})));
                 static_assert(noexcept(mut_rpt.add_tables(mut_tls, &l3e)));
                 static_assert(noexcept(mut_rpt.add_tables(mut_tls, rpt)));
@@ -102,6 +104,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(rpt.is_initialized()));
                 static_assert(noexcept(rpt.is_inactive(mut_tls)));
                 static_assert(noexcept(rpt.spa()));
+                static_assert(noexcept(rpt.lock_stats()));
+                static_assert(noexcept(rpt.tables(mut_tls, mut_page_pool)));
             };
         };
     };
@@ -0,0 +1,197 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/basic_rwlock_t.hpp"
+
+#include <atomic>
+#include <thread>
+#include <tls_t.hpp>
+
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the global rwlock used for the thread tests
+    constinit basic_rwlock_t g_mut_lock{};
+    /// @brief stores whether or not the writer thread owns the lock
+    constinit std::atomic<bool> g_mut_writer_done{};
+
+    /// <!-- description -->
+    ///   @brief Used to test to make sure that writers wait for readers
+    ///
+    void
+    writer_func() noexcept
+    {
+        tls_t mut_tls{};
+        mut_tls.ppid = 1_u16.get();
+
+        g_mut_lock.lock(mut_tls);
+        g_mut_writer_done = true;
+        g_mut_lock.unlock();
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        bsl::ut_scenario{"lock/unlock"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                basic_rwlock_t mut_lock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_lock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_lock.is_locked());
+                        bsl::ut_check(mut_lock.readers().is_zero());
+                    };
+
+                    mut_lock.unlock();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_lock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock twice"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                basic_rwlock_t mut_lock{};
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_lock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_lock.is_locked());
+                    };
+
+                    mut_lock.lock(mut_tls);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_lock.is_locked());
+                    };
+
+                    mut_lock.unlock();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_lock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"lock_shared/unlock_shared"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                basic_rwlock_t mut_lock{};
+                tls_t mut_tls1{};
+                tls_t mut_tls2{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_tls2.ppid = 1_u16.get();
+
+                    mut_lock.lock_shared(mut_tls1);
+                    mut_lock.lock_shared(mut_tls2);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_lock.is_locked());
+                        bsl::ut_check(mut_lock.readers() == 2_u64);
+                    };
+
+                    mut_lock.unlock_shared();
+                    mut_lock.unlock_shared();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_lock.readers().is_zero());
+                    };
+
+                    mut_lock.lock(mut_tls1);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_lock.is_locked());
+                    };
+
+                    mut_lock.unlock();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_lock.is_locked());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"prove writers wait for readers"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                tls_t mut_tls{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_lock.lock_shared(mut_tls);
+                    std::thread mut_writer{&writer_func};
+
+                    // NOTE:
+                    // - Once the writer has claimed the lock, is_locked()
+                    //   returns true, but the writer cannot get in until
+                    //   this reader leaves, so it is safe to check that the
+                    //   writer is still waiting without racing.
+                    //
+
+                    while (!g_mut_lock.is_locked()) {
+                        helpers::yield();
+                    }
+
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(!g_mut_writer_done);
+                    };
+
+                    g_mut_lock.unlock_shared();
+                    mut_writer.join();
+
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_writer_done);
+                        bsl::ut_check(!g_mut_lock.is_locked());
+                        bsl::ut_check(g_mut_lock.readers().is_zero());
+                    };
+                };
+            };
+        };
+
+        return bsl::ut_success();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    helpers::yield();
+
+    static_assert(lib::tests() == bsl::ut_success());
+    return lib::tests();
+}
@@ -0,0 +1,259 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../../src/basic_rwlock_t.hpp"
+#include "../../../src/basic_spinlock_t.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <tls_t.hpp>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/debug.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/string_view.hpp>
+#include <bsl/ut.hpp>
+
+namespace lib
+{
+    /// @brief defines the max number of threads (i.e., PPs) to benchmark
+    constexpr auto BENCHMARK_MAX_THREADS{8_umx};
+    /// @brief defines the number of lookups each thread performs
+    constexpr auto BENCHMARK_ITERATIONS{200000_umx};
+    /// @brief defines the number of levels in the table being "walked"
+    constexpr auto BENCHMARK_LEVELS{4_umx};
+
+    /// @brief defines the basic_spinlock_t that is benchmarked
+    constinit basic_spinlock_t g_mut_spinlock{};
+    /// @brief defines the basic_rwlock_t that is benchmarked
+    constinit basic_rwlock_t g_mut_rwlock{};
+    /// @brief stores the entries that each lookup reads (one per level)
+    constinit bsl::array<bsl::safe_u64, BENCHMARK_LEVELS.get()> g_mut_table{};
+    /// @brief stores the number of lookups each thread completed
+    constinit bsl::array<bsl::safe_u64, BENCHMARK_MAX_THREADS.get()> g_mut_lookups{};
+    /// @brief used to release all of the threads at the same time
+    constinit std::atomic<bool> g_mut_go{};
+
+    /// <!-- description -->
+    ///   @brief Acquires the provided lock the way that the root page
+    ///     table used to lock itself for a query. A basic_spinlock_t only
+    ///     has an exclusive side, so every lookup is serialized.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_lock the lock to acquire
+    ///   @param tls the current TLS block
+    ///
+    void
+    lock_for_query(basic_spinlock_t *const pmut_lock, tls_t const &tls) noexcept
+    {
+        pmut_lock->lock(tls);
+    }
+
+    /// <!-- description -->
+    ///   @brief Releases the lock acquired by lock_for_query()
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_lock the lock to release
+    ///
+    void
+    unlock_for_query(basic_spinlock_t *const pmut_lock) noexcept
+    {
+        pmut_lock->unlock();
+    }
+
+    /// <!-- description -->
+    ///   @brief Acquires the shared side of the provided lock, which is
+    ///     how the root page table now locks itself for a query.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_lock the lock to acquire
+    ///   @param tls the current TLS block
+    ///
+    void
+    lock_for_query(basic_rwlock_t *const pmut_lock, tls_t const &tls) noexcept
+    {
+        pmut_lock->lock_shared(tls);
+    }
+
+    /// <!-- description -->
+    ///   @brief Releases the lock acquired by lock_for_query()
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_lock the lock to release
+    ///
+    void
+    unlock_for_query(basic_rwlock_t *const pmut_lock) noexcept
+    {
+        pmut_lock->unlock_shared();
+    }
+
+    /// <!-- description -->
+    ///   @brief Performs BENCHMARK_ITERATIONS lookups, each of which
+    ///     reads every level of g_mut_table while holding the provided
+    ///     lock, similar to a page walk performed by
+    ///     basic_root_page_table_t::entries().
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LOCK_TYPE the type of lock to benchmark
+    ///   @param pmut_lock the lock to benchmark
+    ///   @param ppid the ppid to use for this thread
+    ///
+    template<typename LOCK_TYPE>
+    void
+    benchmark_thread(LOCK_TYPE *const pmut_lock, bsl::safe_u16 const &ppid) noexcept
+    {
+        tls_t mut_tls{};
+        mut_tls.ppid = ppid.get();
+
+        while (!g_mut_go) {
+            helpers::yield();
+        }
+
+        bsl::safe_u64 mut_lookups{};
+        for (bsl::safe_idx mut_i{}; mut_i < BENCHMARK_ITERATIONS; ++mut_i) {
+            bsl::safe_u64 mut_entry{};
+
+            lock_for_query(pmut_lock, mut_tls);
+            for (auto const &elem : g_mut_table) {
+                mut_entry += elem;
+            }
+            unlock_for_query(pmut_lock);
+
+            if (mut_entry.is_zero()) {
+                ++mut_lookups;
+            }
+            else {
+                bsl::touch();
+            }
+        }
+
+        *g_mut_lookups.at_if(bsl::to_idx(ppid)) = mut_lookups;
+    }
+
+    /// <!-- description -->
+    ///   @brief Runs the benchmark for the provided lock using the
+    ///     provided number of threads and outputs the total lookup
+    ///     throughput.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @tparam LOCK_TYPE the type of lock to benchmark
+    ///   @param pmut_lock the lock to benchmark
+    ///   @param name the name of the lock to output
+    ///   @param threads the number of threads to use
+    ///   @return Returns the total number of lookups that were performed
+    ///
+    template<typename LOCK_TYPE>
+    [[nodiscard]] auto
+    benchmark(
+        LOCK_TYPE *const pmut_lock,
+        bsl::string_view const &name,
+        bsl::safe_umx const &threads) noexcept -> bsl::safe_u64
+    {
+        bsl::array<std::thread, BENCHMARK_MAX_THREADS.get()> mut_threads{};
+
+        g_mut_lookups = {};
+        g_mut_go = false;
+
+        for (bsl::safe_idx mut_i{}; mut_i < threads; ++mut_i) {
+            *mut_threads.at_if(mut_i) =
+                std::thread{&benchmark_thread<LOCK_TYPE>, pmut_lock, bsl::to_u16(mut_i)};
+        }
+
+        auto const start{std::chrono::steady_clock::now()};
+        g_mut_go = true;
+
+        for (bsl::safe_idx mut_i{}; mut_i < threads; ++mut_i) {
+            mut_threads.at_if(mut_i)->join();
+        }
+
+        auto const stop{std::chrono::steady_clock::now()};
+        auto const total{std::chrono::duration_cast<std::chrono::microseconds>(stop - start)};
+        auto mut_total_us{bsl::to_u64(static_cast<bsl::uint64>(total.count()))};
+
+        if (mut_total_us.is_zero()) {
+            mut_total_us = bsl::safe_u64::magic_1();
+        }
+        else {
+            bsl::touch();
+        }
+
+        bsl::safe_u64 mut_lookups{};
+        for (auto const &lookups : g_mut_lookups) {
+            mut_lookups += lookups;
+        }
+
+        constexpr auto us_per_ms{1000_u64};
+        auto const per_ms{((mut_lookups * us_per_ms) / mut_total_us).checked()};
+
+        bsl::print() << bsl::mag << bsl::fmt{"<18s", name};
+        bsl::print() << bsl::rst << "pps: " << bsl::cyn << bsl::fmt{"2d", threads};
+        bsl::print() << bsl::rst << ", lookups/ms: ";
+        bsl::print() << bsl::cyn << bsl::fmt{"10d", per_ms};
+        bsl::print() << bsl::rst << bsl::endl;
+
+        return mut_lookups.checked();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this benchmark. Each lock is used to guard
+///     read-only lookups from an increasing number of threads, showing
+///     how lookup throughput scales as the number of PPs grows. With a
+///     basic_spinlock_t, throughput stays flat (or drops) as PPs are
+///     added, while with a basic_rwlock_t it should grow. If a call to
+///     bsl::ut_check() fails the application will fast fail. If all calls
+///     to bsl::ut_check() pass, this function will successfully return
+///     with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+
+    bsl::ut_scenario{"lookup scaling"} = []() noexcept {
+        bsl::ut_given_at_runtime{} = []() noexcept {
+            bsl::ut_then{} = []() noexcept {
+                constexpr auto max{lib::BENCHMARK_MAX_THREADS};
+                for (auto mut_pps{1_umx}; mut_pps <= max; mut_pps *= 2_umx) {
+                    auto const expected{(lib::BENCHMARK_ITERATIONS * mut_pps).checked()};
+
+                    auto const spinlock{
+                        lib::benchmark(&lib::g_mut_spinlock, "basic_spinlock_t", mut_pps)};
+                    bsl::ut_check(spinlock == expected);
+
+                    auto const rwlock{lib::benchmark(&lib::g_mut_rwlock, "basic_rwlock_t", mut_pps)};
+                    bsl::ut_check(rwlock == expected);
+                }
+            };
+        };
+    };
+
+    return bsl::ut_success();
+}
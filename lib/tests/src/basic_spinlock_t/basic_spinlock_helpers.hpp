@@ -25,8 +25,12 @@
 #ifndef MOCK_BASIC_SPINLOCK_HELPERS_HPP
 #define MOCK_BASIC_SPINLOCK_HELPERS_HPP
 
+#include <chrono>
 #include <thread>
 
+#include <bsl/convert.hpp>
+#include <bsl/safe_integral.hpp>
+
 namespace helpers
 {
     /// <!-- description -->
@@ -37,6 +41,22 @@ namespace helpers
     {
         std::this_thread::yield();
     }
+
+    /// <!-- description -->
+    ///   @brief Returns the current value of the TSC. Since there is no
+    ///     portable way to read the TSC from a unit test, the steady
+    ///     clock is used instead.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Returns the current value of the TSC
+    ///
+    [[nodiscard]] inline auto
+    tsc() noexcept -> bsl::safe_u64
+    {
+        auto const now{std::chrono::steady_clock::now().time_since_epoch()};
+        return bsl::to_u64(static_cast<bsl::uint64>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now).count()));
+    }
 }
 
 #endif
@@ -410,6 +410,24 @@ platform_dump_vmm(void) NOEXCEPT
     console_write("\r\n");
 }
 
+/**
+ * <!-- description -->
+ *   @brief Locks the loader's global mutex. UEFI only ever runs the
+ *     loader on a single thread, so there is nothing to do.
+ */
+void
+platform_mutex_lock(void) NOEXCEPT
+{}
+
+/**
+ * <!-- description -->
+ *   @brief Unlocks the loader's global mutex. UEFI only ever runs the
+ *     loader on a single thread, so there is nothing to do.
+ */
+void
+platform_mutex_unlock(void) NOEXCEPT
+{}
+
 /**
  * <!-- description -->
  *   @brief Initializes the archiecture. Some platforms might need per CPU
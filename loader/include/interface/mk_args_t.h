@@ -32,6 +32,7 @@
 #include <debug_ring_t.h>
 #include <mutable_span_t.h>
 #include <state_save_t.h>
+#include <trace_ring_t.h>
 #include <types.h>
 
 #ifdef __cplusplus
@@ -74,6 +75,8 @@ extern "C"
         struct mutable_span_t page_pool;
         /** @brief stores the location of the microkernel's huge pool */
         struct mutable_span_t huge_pool;
+        /** @brief stores the location of the trace ring for this CPU */
+        struct trace_ring_t *trace_ring;
     };
 
 #pragma pack(pop)
@@ -32,6 +32,7 @@
 #include <debug_ring_t.hpp>
 #include <l3e_t.hpp>
 #include <state_save_t.hpp>
+#include <trace_ring_t.hpp>
 
 #include <bsl/array.hpp>
 #include <bsl/convert.hpp>    // IWYU pragma: keep
@@ -79,6 +80,8 @@ namespace loader
         bsl::span<lib::basic_page_pool_node_t> page_pool;
         /// @brief stores the location of the microkernel's huge pool
         bsl::span<lib::basic_page_4k_t> huge_pool;
+        /// @brief stores the location of the trace ring for this CPU
+        trace_ring_t *trace_ring;
     };
 }
 
@@ -0,0 +1,76 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRACE_RECORD_T_H
+#define TRACE_RECORD_T_H
+
+#include <types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+    /**
+     * <!-- description -->
+     *   @brief Defines a single entry in the microkernel's trace ring. One
+     *     of these is recorded every time a VMExit occurs, right before
+     *     the guest is resumed, so that it also carries what the VMExit
+     *     cost. The layout is also the format of the file written by
+     *     "vmmctl trace", so it must not change without also changing the
+     *     IOCTL version.
+     */
+    struct trace_record_t
+    {
+        /** @brief stores the TSC at the time of the VMExit */
+        uint64_t tsc;
+        /** @brief stores the VMExit reason */
+        uint64_t exit_reason;
+        /** @brief stores the exit qualification (Intel) or exitinfo1 (AMD) */
+        uint64_t exit_info;
+        /** @brief stores the guest's RIP at the time of the VMExit */
+        uint64_t rip;
+        /** @brief stores the number of cycles from the VMExit to the next VMEntry */
+        uint64_t cycles;
+        /** @brief stores the ID of the PP the VMExit occurred on */
+        uint16_t ppid;
+        /** @brief stores the ID of the VM that was running */
+        uint16_t vmid;
+        /** @brief stores the ID of the VP that was running */
+        uint16_t vpid;
+        /** @brief stores the ID of the VS that was running */
+        uint16_t vsid;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,67 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_RECORD_T_HPP
+#define TRACE_RECORD_T_HPP
+
+#include <bsl/cstdint.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// <!-- description -->
+    ///   @brief Defines a single entry in the microkernel's trace ring. One
+    ///     of these is recorded every time a VMExit occurs, right before
+    ///     the guest is resumed, so that it also carries what the VMExit
+    ///     cost. The layout is also the format of the file written by
+    ///     "vmmctl trace", so it must not change without also changing the
+    ///     IOCTL version.
+    ///
+    struct trace_record_t final
+    {
+        /// @brief stores the TSC at the time of the VMExit
+        bsl::uint64 tsc;
+        /// @brief stores the VMExit reason
+        bsl::uint64 exit_reason;
+        /// @brief stores the exit qualification (Intel) or exitinfo1 (AMD)
+        bsl::uint64 exit_info;
+        /// @brief stores the guest's RIP at the time of the VMExit
+        bsl::uint64 rip;
+        /// @brief stores the number of cycles from the VMExit to the next VMEntry
+        bsl::uint64 cycles;
+        /// @brief stores the ID of the PP the VMExit occurred on
+        bsl::uint16 ppid;
+        /// @brief stores the ID of the VM that was running
+        bsl::uint16 vmid;
+        /// @brief stores the ID of the VP that was running
+        bsl::uint16 vpid;
+        /// @brief stores the ID of the VS that was running
+        bsl::uint16 vsid;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,63 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#ifndef TRACE_RING_T_HPP
+#define TRACE_RING_T_HPP
+
+#include <trace_record_t.hpp>
+
+#include <bsl/carray.hpp>
+#include <bsl/cstdint.hpp>
+
+#pragma pack(push, 1)
+
+namespace loader
+{
+    /// <!-- description -->
+    ///   @brief Defines the structure of a PP's trace ring. Each PP has its
+    ///     own ring, which is only ever written by the microkernel running
+    ///     on that PP, and only ever read by the loader, so no locks are
+    ///     needed. epos and spos are free running counts of the records
+    ///     that have been written and read. A record lives at
+    ///     buf[pos % HYPERVISOR_TRACE_RING_SIZE]. If the ring is full, the
+    ///     microkernel drops the record and increments dropped instead of
+    ///     waiting for the reader.
+    ///
+    struct trace_ring_t final
+    {
+        /// @brief stores the total number of records written (producer)
+        bsl::uint64 epos;
+        /// @brief stores the total number of records read (consumer)
+        bsl::uint64 spos;
+        /// @brief stores the total number of records dropped
+        bsl::uint64 dropped;
+
+        /// @brief stores the records in the trace ring
+        bsl::carray<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> buf;
+    };
+}
+
+#pragma pack(pop)
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TRACE_VMM_ARGS_T_H
+#define TRACE_VMM_ARGS_T_H
+
+#include <trace_record_t.h>
+#include <types.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+#pragma pack(push, 1)
+
+/** @brief defines the IOCTL index for draining a PP's trace ring */
+#define LOADER_TRACE_VMM_CMD ((uint32_t)0xBF04)
+
+    /**
+     * <!-- description -->
+     *   @brief Defines the information that a userspace application needs to
+     *     provide to drain the trace ring of a PP. The records are copied
+     *     directly into the userspace buffer, so the IOCTL itself stays
+     *     small no matter how large the trace ring is.
+     */
+    struct trace_vmm_args_t
+    {
+        /** @brief set to HYPERVISOR_VERSION */
+        uint64_t ver;
+        /** @brief set to the ID of the PP whose trace ring should be drained */
+        uint64_t ppid;
+        /** @brief set to the userspace buffer the records are copied to */
+        struct trace_record_t *records;
+        /** @brief set to the number of records that "records" can hold */
+        uint64_t max;
+
+        /** @brief stores the number of records that were drained */
+        uint64_t num;
+        /** @brief stores the total number of records the PP has dropped */
+        uint64_t dropped;
+    };
+
+#pragma pack(pop)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -240,6 +240,22 @@ extern "C"
      */
     void platform_dump_vmm(void) NOEXCEPT;
 
+    /**
+     * <!-- description -->
+     *   @brief Locks the loader's global mutex. Starting, stopping and
+     *     tracing the VMM all hold this mutex, which is what keeps the
+     *     VMM's resources from being freed while another IOCTL is still
+     *     using them. The mutex is not recursive and might sleep.
+     */
+    void platform_mutex_lock(void) NOEXCEPT;
+
+    /**
+     * <!-- description -->
+     *   @brief Unlocks the loader's global mutex. See platform_mutex_lock
+     *     for more details.
+     */
+    void platform_mutex_unlock(void) NOEXCEPT;
+
     /**
      * <!-- description -->
      *   @brief Initializes the architecture. Some platforms might need per CPU
@@ -44,6 +44,8 @@
 #include <start_vmm_args_t.h>
 #include <stop_vmm.h>
 #include <stop_vmm_args_t.h>
+#include <trace_vmm.h>
+#include <trace_vmm_args_t.h>
 #include <types.h>
 
 static int
@@ -146,6 +148,41 @@ platform_copy_from_user_failed:
     return -EPERM;
 }
 
+static long
+dispatch_trace_vmm(void *const ioctl_args)
+{
+    int64_t ret;
+    struct trace_vmm_args_t args;
+
+    ret = platform_copy_from_user(
+        &args, ioctl_args, sizeof(struct trace_vmm_args_t));
+    if (ret) {
+        bferror("platform_copy_from_user failed");
+        return -EPERM;
+    }
+
+    /**
+     * NOTE:
+     * - trace_vmm fails without an error when the PP is not running, which
+     *   is how userspace learns that the VMM was stopped (or that there are
+     *   no more PPs), so there is nothing to report here.
+     */
+
+    ret = trace_vmm(&args);
+    if (ret) {
+        return -EPERM;
+    }
+
+    ret = platform_copy_to_user(
+        ioctl_args, &args, sizeof(struct trace_vmm_args_t));
+    if (ret) {
+        bferror("platform_copy_to_user failed");
+        return -EPERM;
+    }
+
+    return 0;
+}
+
 static long
 dev_unlocked_ioctl(
     struct file *file, unsigned int cmd, unsigned long ioctl_args)
@@ -160,6 +197,9 @@ dev_unlocked_ioctl(
         case LOADER_DUMP_VMM: {
             return dispatch_dump_vmm((void *)ioctl_args);
         }
+        case LOADER_TRACE_VMM: {
+            return dispatch_trace_vmm((void *)ioctl_args);
+        }
         default: {
             bferror_x64("invalid ioctl cmd", cmd);
             return -EINVAL;
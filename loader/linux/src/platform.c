@@ -30,6 +30,7 @@
 #include <debug.h>
 #include <linux/cpu.h>
 #include <linux/mm.h>
+#include <linux/mutex.h>
 #include <linux/slab.h>
 #include <linux/smp.h>
 #include <linux/vmalloc.h>
@@ -37,6 +38,9 @@
 #include <types.h>
 #include <work_on_cpu_callback_args.h>
 
+/** @brief stores the loader's global mutex */
+static DEFINE_MUTEX(g_mut_platform_mutex);
+
 /**
  * <!-- description -->
  *   @brief If test is false, a contract violation has occurred. This
@@ -448,6 +452,30 @@ void
 platform_dump_vmm(void) NOEXCEPT
 {}
 
+/**
+ * <!-- description -->
+ *   @brief Locks the loader's global mutex. Starting, stopping and
+ *     tracing the VMM all hold this mutex, which is what keeps the
+ *     VMM's resources from being freed while another IOCTL is still
+ *     using them. The mutex is not recursive and might sleep.
+ */
+void
+platform_mutex_lock(void) NOEXCEPT
+{
+    mutex_lock(&g_mut_platform_mutex);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Unlocks the loader's global mutex. See platform_mutex_lock
+ *     for more details.
+ */
+void
+platform_mutex_unlock(void) NOEXCEPT
+{
+    mutex_unlock(&g_mut_platform_mutex);
+}
+
 /**
  * <!-- description -->
  *   @brief Initializes the archiecture. Some platforms might need per CPU
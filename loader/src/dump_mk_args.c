@@ -68,4 +68,5 @@ dump_mk_args(struct mk_args_t const *const args, uint32_t const cpu) NOEXCEPT
     bfdebug_x64(" - page_pool.size", args->page_pool.size);
     bfdebug_ptr(" - huge_pool.addr", args->huge_pool.addr);
     bfdebug_x64(" - huge_pool.size", args->huge_pool.size);
+    bfdebug_ptr(" - trace_ring", args->trace_ring);
 }
@@ -285,10 +285,14 @@ start_vmm(struct start_vmm_args_t const *const args) NOEXCEPT
         return LOADER_FAILURE;
     }
 
+    platform_mutex_lock();
+
     if (alloc_and_start_the_vmm(args)) {
         bferror("alloc_and_start_the_vmm failed");
+        platform_mutex_unlock();
         return LOADER_FAILURE;
     }
 
+    platform_mutex_unlock();
     return LOADER_SUCCESS;
 }
@@ -28,6 +28,7 @@
 #include <alloc_and_copy_root_vp_state.h>
 #include <alloc_mk_args.h>
 #include <alloc_mk_stack.h>
+#include <alloc_mk_trace_ring.h>
 #include <bfelf/bfelf_elf64_ehdr_t.h>
 #include <check_cpu_configuration.h>
 #include <debug.h>
@@ -45,6 +46,7 @@
 #include <g_mut_mk_page_pool.h>
 #include <g_mut_mk_stack.h>
 #include <g_mut_mk_state.h>
+#include <g_mut_mk_trace_ring.h>
 #include <g_mut_root_vp_state.h>
 #include <g_pmut_mut_mk_debug_ring.h>
 #include <g_pmut_mut_mk_root_page_table.h>
@@ -53,6 +55,7 @@
 #include <map_mk_args.h>
 #include <map_mk_stack.h>
 #include <map_mk_state.h>
+#include <map_mk_trace_ring.h>
 #include <map_root_vp_state.h>
 #include <mk_args_t.h>
 #include <mutable_span_t.h>
@@ -133,6 +136,11 @@ start_vmm_per_cpu(uint32_t const cpu) NOEXCEPT
         goto alloc_mk_args_failed;
     }
 
+    if (alloc_mk_trace_ring(&g_mut_mk_trace_ring[cpu])) {
+        bferror("alloc_mk_trace_ring failed");
+        goto alloc_mk_trace_ring_failed;
+    }
+
     if (map_mk_stack(&g_mut_mk_stack[cpu], mut_mk_stack_virt, g_pmut_mut_mk_root_page_table)) {
         bferror("map_mk_stack failed");
         goto map_mk_stack_failed;
@@ -153,6 +161,11 @@ start_vmm_per_cpu(uint32_t const cpu) NOEXCEPT
         goto map_mk_args_failed;
     }
 
+    if (map_mk_trace_ring(g_mut_mk_trace_ring[cpu], g_pmut_mut_mk_root_page_table)) {
+        bferror("map_mk_trace_ring failed");
+        goto map_mk_trace_ring_failed;
+    }
+
     g_mut_mk_args[cpu]->ppid = ((uint16_t)cpu);
 
     /**
@@ -172,6 +185,7 @@ start_vmm_per_cpu(uint32_t const cpu) NOEXCEPT
     g_mut_mk_args[cpu]->mk_state = g_mut_mk_state[cpu];
     g_mut_mk_args[cpu]->root_vp_state = g_mut_root_vp_state[cpu];
     g_mut_mk_args[cpu]->debug_ring = g_pmut_mut_mk_debug_ring;
+    g_mut_mk_args[cpu]->trace_ring = g_mut_mk_trace_ring[cpu];
 
     g_mut_mk_args[cpu]->mk_elf_file = g_mut_mk_elf_file.addr;
     for (mut_i = ((uint64_t)0); mut_i < HYPERVISOR_MAX_EXTENSIONS; ++mut_i) {
@@ -224,10 +238,12 @@ start_vmm_per_cpu(uint32_t const cpu) NOEXCEPT
 demote_failed:
 get_mk_huge_pool_addr_failed:
 get_mk_page_pool_addr_failed:
+map_mk_trace_ring_failed:
 map_mk_args_failed:
 map_root_vp_state_failed:
 map_mk_state_failed:
 map_mk_stack_failed:
+alloc_mk_trace_ring_failed:
 alloc_mk_args_failed:
 alloc_and_copy_root_vp_state_failed:
 alloc_and_copy_mk_state_failed:
@@ -25,6 +25,7 @@
  */
 
 #include <debug.h>
+#include <platform.h>
 #include <stop_and_free_the_vmm.h>
 #include <stop_vmm_args_t.h>
 #include <types.h>
@@ -71,6 +72,9 @@ stop_vmm(struct stop_vmm_args_t const *const args) NOEXCEPT
         return LOADER_FAILURE;
     }
 
+    platform_mutex_lock();
     stop_and_free_the_vmm();
+    platform_mutex_unlock();
+
     return LOADER_SUCCESS;
 }
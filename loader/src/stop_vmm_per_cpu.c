@@ -28,11 +28,13 @@
 #include <free_mk_args.h>
 #include <free_mk_stack.h>
 #include <free_mk_state.h>
+#include <free_mk_trace_ring.h>
 #include <free_root_vp_state.h>
 #include <g_mut_cpu_status.h>
 #include <g_mut_mk_args.h>
 #include <g_mut_mk_stack.h>
 #include <g_mut_mk_state.h>
+#include <g_mut_mk_trace_ring.h>
 #include <g_mut_root_vp_state.h>
 #include <mk_args_t.h>
 #include <send_command_report_off.h>
@@ -80,6 +82,7 @@ stop_vmm_per_cpu(uint32_t const cpu) NOEXCEPT
         bf_touch();
     }
 
+    free_mk_trace_ring(&g_mut_mk_trace_ring[cpu]);
     free_mk_args(&g_mut_mk_args[cpu]);
     free_root_vp_state(&g_mut_root_vp_state[cpu]);
     free_mk_state(&g_mut_mk_state[cpu]);
@@ -0,0 +1,193 @@
+/**
+ * @copyright
+ * Copyright (C) 2020 Assured Information Security, Inc.
+ *
+ * @copyright
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * @copyright
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * @copyright
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <constants.h>
+#include <debug.h>
+#include <g_mut_cpu_status.h>
+#include <g_mut_mk_trace_ring.h>
+#include <platform.h>
+#include <trace_ring_t.h>
+#include <trace_vmm.h>
+#include <trace_vmm_args_t.h>
+#include <types.h>
+
+/**
+ * <!-- description -->
+ *   @brief Verifies that the arguments from the IOCTL are valid.
+ *
+ * <!-- inputs/outputs -->
+ *   @param args the arguments to verify
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD static int64_t
+verify_trace_vmm_args(struct trace_vmm_args_t const *const args) NOEXCEPT
+{
+    if (((uint64_t)1) != args->ver) {
+        bferror("IOCTL ABI version not supported");
+        return LOADER_FAILURE;
+    }
+
+    if (args->ppid >= HYPERVISOR_MAX_PPS) {
+        bferror("ppid out of range");
+        return LOADER_FAILURE;
+    }
+
+    if (NULLPTR == args->records) {
+        bferror("records was NULL");
+        return LOADER_FAILURE;
+    }
+
+    if (((uint64_t)0) == args->max) {
+        bferror("max is invalid");
+        return LOADER_FAILURE;
+    }
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief Copies the records that have not been read yet out of a PP's
+ *     trace ring and into the userspace buffer. This must be called
+ *     while holding the loader's mutex, as stop_vmm frees the trace ring.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_args arguments from the ioctl
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD static int64_t
+drain_trace_ring(struct trace_vmm_args_t *const pmut_args) NOEXCEPT
+{
+    uint64_t mut_i;
+    uint64_t mut_num;
+    uint64_t mut_chunk;
+    uint64_t mut_epos;
+    uint64_t mut_spos;
+    uint64_t const size = (uint64_t)sizeof(struct trace_record_t);
+    struct trace_ring_t *pmut_mut_ring;
+
+    if (CPU_STATUS_RUNNING != g_mut_cpu_status[pmut_args->ppid]) {
+        return LOADER_FAILURE;
+    }
+
+    pmut_mut_ring = g_mut_mk_trace_ring[pmut_args->ppid];
+    platform_expects(NULLPTR != pmut_mut_ring);
+
+    /**
+     * NOTE:
+     * - The microkernel only ever advances epos, and we only ever advance
+     *   spos. epos is read once, so any record written while we copy is
+     *   simply picked up by the next call. spos is only advanced once the
+     *   records have been copied, so the microkernel cannot overwrite a
+     *   record that we are still reading.
+     */
+
+    mut_epos = pmut_mut_ring->epos;
+    mut_spos = pmut_mut_ring->spos;
+
+    if (mut_epos - mut_spos > HYPERVISOR_TRACE_RING_SIZE) {
+        bferror("trace ring corrupt");
+        return LOADER_FAILURE;
+    }
+
+    mut_num = mut_epos - mut_spos;
+    if (mut_num > pmut_args->max) {
+        mut_num = pmut_args->max;
+    }
+    else {
+        bf_touch();
+    }
+
+    /**
+     * NOTE:
+     * - The records might wrap around the end of the ring, so they are
+     *   copied in contiguous chunks (at most two).
+     */
+
+    for (mut_i = ((uint64_t)0); mut_i < mut_num; mut_i += mut_chunk) {
+        uint64_t const pos = (mut_spos + mut_i) % HYPERVISOR_TRACE_RING_SIZE;
+
+        mut_chunk = HYPERVISOR_TRACE_RING_SIZE - pos;
+        if (mut_chunk > mut_num - mut_i) {
+            mut_chunk = mut_num - mut_i;
+        }
+        else {
+            bf_touch();
+        }
+
+        if (platform_copy_to_user(
+                &pmut_args->records[mut_i], &pmut_mut_ring->buf[pos], mut_chunk * size)) {
+            bferror("platform_copy_to_user failed");
+            return LOADER_FAILURE;
+        }
+
+        bf_touch();
+    }
+
+    pmut_mut_ring->spos = mut_spos + mut_num;
+
+    pmut_args->num = mut_num;
+    pmut_args->dropped = pmut_mut_ring->dropped;
+
+    return LOADER_SUCCESS;
+}
+
+/**
+ * <!-- description -->
+ *   @brief This function contains all of the code that is common between
+ *     all archiectures and all platforms for draining the trace ring of
+ *     a PP. The VMM keeps running while this happens.
+ *
+ * <!-- inputs/outputs -->
+ *   @param pmut_args arguments from the ioctl
+ *   @return LOADER_SUCCESS on success, LOADER_FAILURE on failure.
+ */
+NODISCARD int64_t
+trace_vmm(struct trace_vmm_args_t *const pmut_args) NOEXCEPT
+{
+    int64_t mut_ret;
+
+    platform_expects(NULLPTR != pmut_args);
+
+    if (verify_trace_vmm_args(pmut_args)) {
+        bferror("verify_trace_vmm_args failed");
+        return LOADER_FAILURE;
+    }
+
+    /**
+     * NOTE:
+     * - stop_vmm frees each PP's trace ring while holding the loader's
+     *   mutex, so holding it here, from checking that the PP is running
+     *   until the last record is copied, is what keeps the trace ring
+     *   from being freed while we are still reading it.
+     */
+
+    platform_mutex_lock();
+    mut_ret = drain_trace_ring(pmut_args);
+    platform_mutex_unlock();
+
+    return mut_ret;
+}
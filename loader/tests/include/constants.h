@@ -35,6 +35,7 @@
 #define HYPERVISOR_PAGE_SHIFT ((uint64_t)12)
 #define HYPERVISOR_SERIAL_PORT 0x03F8
 #define HYPERVISOR_DEBUG_RING_SIZE ((uint64_t)10)
+#define HYPERVISOR_TRACE_RING_SIZE ((uint64_t)4)
 #define HYPERVISOR_VMEXIT_LOG_SIZE ((uint64_t)2)
 #define HYPERVISOR_MAX_ELF_FILE_SIZE ((uint64_t)0x800000)
 #define HYPERVISOR_MAX_SEGMENTS ((uint64_t)3)
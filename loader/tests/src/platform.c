@@ -417,6 +417,22 @@ void
 platform_dump_vmm(void) NOEXCEPT
 {}
 
+/**
+ * <!-- description -->
+ *   @brief Locks the loader's global mutex.
+ */
+void
+platform_mutex_lock(void) NOEXCEPT
+{}
+
+/**
+ * <!-- description -->
+ *   @brief Unlocks the loader's global mutex.
+ */
+void
+platform_mutex_unlock(void) NOEXCEPT
+{}
+
 /**
  * <!-- description -->
  *   @brief Initializes the architecture. Some platforms might need per CPU
@@ -317,6 +317,8 @@ main() noexcept -> bsl::exit_code
     platform_ensures(1);
 
     platform_dump_vmm();
+    platform_mutex_lock();
+    platform_mutex_unlock();
     platform_mark_gdt_writable();
     platform_mark_gdt_readonly();
 
@@ -0,0 +1,331 @@
+/// @copyright
+/// Copyright (C) 2020 Assured Information Security, Inc.
+///
+/// @copyright
+/// Permission is hereby granted, free of charge, to any person obtaining a copy
+/// of this software and associated documentation files (the "Software"), to deal
+/// in the Software without restriction, including without limitation the rights
+/// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+/// copies of the Software, and to permit persons to whom the Software is
+/// furnished to do so, subject to the following conditions:
+///
+/// @copyright
+/// The above copyright notice and this permission notice shall be included in
+/// all copies or substantial portions of the Software.
+///
+/// @copyright
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+/// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+/// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+/// SOFTWARE.
+
+#include "../../include/g_mut_cpu_status.h"
+#include "../../include/g_mut_mk_trace_ring.h"
+#include "../../include/trace_vmm.h"
+
+#include <constants.h>
+#include <helpers.hpp>
+#include <trace_record_t.h>
+#include <trace_ring_t.h>
+#include <trace_vmm_args_t.h>
+
+#include <bsl/array.hpp>
+#include <bsl/convert.hpp>
+#include <bsl/safe_idx.hpp>
+#include <bsl/safe_integral.hpp>
+#include <bsl/ut.hpp>
+
+namespace loader
+{
+    /// @brief the number of records the microkernel has written in these tests
+    constexpr auto EPOS{6_u64};
+    /// @brief the number of records userspace has read in these tests
+    constexpr auto SPOS{3_u64};
+    /// @brief the number of records the microkernel has dropped in these tests
+    constexpr auto DROPPED{2_u64};
+    /// @brief spos once a single record has been read in these tests
+    constexpr auto NEXT_SPOS{4_u64};
+    /// @brief the record that wraps around to the start of the ring
+    constexpr auto WRAPPED{3_u64};
+
+    /// <!-- description -->
+    ///   @brief Tags each record in the provided ring with its index so that
+    ///     the order the records are drained in can be checked.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_ring the ring to fill
+    ///
+    constexpr void
+    fill_ring(trace_ring_t *const pmut_ring) noexcept
+    {
+        for (bsl::safe_u64 mut_i{}; mut_i < bsl::to_u64(HYPERVISOR_TRACE_RING_SIZE); ++mut_i) {
+            pmut_ring->buf[mut_i.get()].tsc = mut_i.get();
+        }
+
+        pmut_ring->epos = EPOS.get();
+        pmut_ring->spos = SPOS.get();
+        pmut_ring->dropped = DROPPED.get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Used to execute the actual checks. We put the checks in this
+    ///     function so that we can validate the tests both at compile-time
+    ///     and at run-time. If a bsl::ut_check fails, the tests will either
+    ///     fail fast at run-time, or will produce a compile-time error.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @return Always returns bsl::exit_success.
+    ///
+    [[nodiscard]] constexpr auto
+    tests() noexcept -> bsl::exit_code
+    {
+        helpers::init();
+        constexpr auto func{&trace_vmm};
+
+        bsl::ut_scenario{"success"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_ring_t mut_ring{};
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.records = mut_records.data();
+                    mut_args.max = HYPERVISOR_TRACE_RING_SIZE;
+                    fill_ring(&mut_ring);
+                    g_mut_mk_trace_ring[0] = &mut_ring;
+                    g_mut_cpu_status[0] = CPU_STATUS_RUNNING;
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_check(func(&mut_args));
+                        bsl::ut_check((EPOS - SPOS).checked().get() == mut_args.num);
+                        bsl::ut_check(DROPPED.get() == mut_args.dropped);
+                        bsl::ut_check(EPOS.get() == mut_ring.spos);
+                        auto const *const rec0{mut_records.at_if({})};
+                        auto const *const rec1{mut_records.at_if(bsl::safe_idx::magic_1())};
+                        auto const *const rec2{mut_records.at_if(bsl::safe_idx::magic_2())};
+                        bsl::ut_check(WRAPPED.get() == rec0->tsc);
+                        bsl::ut_check(bsl::safe_u64::magic_0().get() == rec1->tsc);
+                        bsl::ut_check(bsl::safe_u64::magic_1().get() == rec2->tsc);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mk_trace_ring[0] = nullptr;
+                        g_mut_cpu_status[0] = CPU_STATUS_STOPPED;
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"buffer smaller than the ring"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_ring_t mut_ring{};
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.records = mut_records.data();
+                    mut_args.max = bsl::safe_u64::magic_1().get();
+                    fill_ring(&mut_ring);
+                    g_mut_mk_trace_ring[0] = &mut_ring;
+                    g_mut_cpu_status[0] = CPU_STATUS_RUNNING;
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_check(func(&mut_args));
+                        bsl::ut_check(bsl::safe_u64::magic_1().get() == mut_args.num);
+                        auto const *const rec0{mut_records.at_if({})};
+                        auto const *const rec1{mut_records.at_if(bsl::safe_idx::magic_1())};
+                        bsl::ut_check(NEXT_SPOS.get() == mut_ring.spos);
+                        bsl::ut_check(WRAPPED.get() == rec0->tsc);
+                        bsl::ut_check(bsl::safe_u64::magic_0().get() == rec1->tsc);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mk_trace_ring[0] = nullptr;
+                        g_mut_cpu_status[0] = CPU_STATUS_STOPPED;
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"platform_copy_to_user fails"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_ring_t mut_ring{};
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.records = mut_records.data();
+                    mut_args.max = HYPERVISOR_TRACE_RING_SIZE;
+                    fill_ring(&mut_ring);
+                    g_mut_mk_trace_ring[0] = &mut_ring;
+                    g_mut_cpu_status[0] = CPU_STATUS_RUNNING;
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    helpers::g_mut_platform_copy_to_user = 1;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                        bsl::ut_check(SPOS.get() == mut_ring.spos);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mk_trace_ring[0] = nullptr;
+                        g_mut_cpu_status[0] = CPU_STATUS_STOPPED;
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"empty ring"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_ring_t mut_ring{};
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.records = mut_records.data();
+                    mut_args.max = HYPERVISOR_TRACE_RING_SIZE;
+                    g_mut_mk_trace_ring[0] = &mut_ring;
+                    g_mut_cpu_status[0] = CPU_STATUS_RUNNING;
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_check(func(&mut_args));
+                        bsl::ut_check(bsl::safe_u64::magic_0().get() == mut_args.num);
+                        bsl::ut_check(bsl::safe_u64::magic_0().get() == mut_args.dropped);
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mk_trace_ring[0] = nullptr;
+                        g_mut_cpu_status[0] = CPU_STATUS_STOPPED;
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid version"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.records = mut_records.data();
+                    mut_args.max = HYPERVISOR_TRACE_RING_SIZE;
+                    mut_args.ver = bsl::safe_u64::magic_0().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"invalid ppid"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.records = mut_records.data();
+                    mut_args.max = HYPERVISOR_TRACE_RING_SIZE;
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.ppid = HYPERVISOR_MAX_PPS;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"records is NULL"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_vmm_args_t mut_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.max = HYPERVISOR_TRACE_RING_SIZE;
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"max is 0"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    mut_args.records = mut_records.data();
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"pp not running"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.records = mut_records.data();
+                    mut_args.max = HYPERVISOR_TRACE_RING_SIZE;
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"corrupt ring"} = [&]() noexcept {
+            bsl::ut_given{} = [&]() noexcept {
+                trace_ring_t mut_ring{};
+                trace_vmm_args_t mut_args{};
+                bsl::array<trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_args.records = mut_records.data();
+                    mut_args.max = HYPERVISOR_TRACE_RING_SIZE;
+                    mut_ring.epos = EPOS.get();
+                    g_mut_mk_trace_ring[0] = &mut_ring;
+                    g_mut_cpu_status[0] = CPU_STATUS_RUNNING;
+                    mut_args.ver = bsl::safe_u64::magic_1().get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        helpers::ut_fails(func(&mut_args));
+                    };
+                    bsl::ut_cleanup{} = [&]() noexcept {
+                        g_mut_mk_trace_ring[0] = nullptr;
+                        g_mut_cpu_status[0] = CPU_STATUS_STOPPED;
+                        helpers::reset();
+                    };
+                };
+            };
+        };
+
+        return helpers::fini();
+    }
+}
+
+/// <!-- description -->
+///   @brief Main function for this unit test. If a call to bsl::ut_check() fails
+///     the application will fast fail. If all calls to bsl::ut_check() pass, this
+///     function will successfully return with bsl::exit_success.
+///
+/// <!-- inputs/outputs -->
+///   @return Always returns bsl::exit_success.
+///
+[[nodiscard]] auto
+main() noexcept -> bsl::exit_code
+{
+    bsl::enable_color();
+    return loader::tests();
+}
@@ -46,6 +46,7 @@
 #include <dump_vmm_args_t.hpp>
 #include <start_vmm_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <trace_vmm_args_t.hpp>
 
 #include <bsl/safe_integral.hpp>
 #include <bsl/string_view.hpp>
@@ -80,6 +81,10 @@ namespace loader
     /// @brief defines IOCTL for dumping a VMs debug ring
     constexpr bsl::safe_umx DUMP_VMM{static_cast<bsl::uintmx>(
         CTL_CODE(FILE_DEVICE_UNKNOWN, DUMP_VMM_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
+
+    /// @brief defines IOCTL for draining a PP's trace ring
+    constexpr bsl::safe_umx TRACE_VMM{static_cast<bsl::uintmx>(
+        CTL_CODE(FILE_DEVICE_UNKNOWN, TRACE_VMM_CMD.get(), METHOD_BUFFERED, FILE_READ_DATA | FILE_WRITE_DATA))};
 }
 
 #endif
@@ -26,6 +26,7 @@ Environment:
 
 #include <loader_fini.h>
 #include <loader_init.h>
+#include <platform_mutex_init.h>
 #include <serial_init.h>
 
 // clang-format on
@@ -75,6 +76,12 @@ Return Value:
 
     TraceEvents(TRACE_LEVEL_INFORMATION, TRACE_DRIVER, "%!FUNC! Entry");
 
+    //
+    // The loader's global mutex has to be ready before the device (and
+    // with it, the IOCTL queue) is created.
+    //
+    platform_mutex_init();
+
     //
     // Register a cleanup callback so that we can call WPP_CLEANUP when
     // the framework driver object is deleted during driver unload.
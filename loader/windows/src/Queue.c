@@ -31,6 +31,8 @@ Environment:
 #include <start_vmm_args_t.h>
 #include <stop_vmm.h>
 #include <stop_vmm_args_t.h>
+#include <trace_vmm.h>
+#include <trace_vmm_args_t.h>
 #include <loader_platform_interface.h>
 
 // clang-format on
@@ -183,6 +185,19 @@ Return Value:
             }
             break;
         }
+        case LOADER_TRACE_VMM: {
+            if (out_size < sizeof(struct trace_vmm_args_t)) {
+                bferror("trace_vmm args too small");
+                WdfRequestComplete(Request, STATUS_INVALID_PARAMETER);
+                return;
+            }
+
+            if (trace_vmm((struct trace_vmm_args_t *)out)) {
+                WdfRequestComplete(Request, STATUS_UNSUCCESSFUL);
+                return;
+            }
+            break;
+        }
         default: {
             bferror_x64("invalid ioctl cmd", IoControlCode);
             WdfRequestComplete(Request, STATUS_ACCESS_DENIED);
@@ -35,6 +35,7 @@
 
 #include <debug.h>
 #include <platform.h>
+#include <platform_mutex_init.h>
 #include <types.h>
 #include <work_on_cpu_callback_args.h>
 
@@ -42,6 +43,9 @@
 
 #define BF_TAG 'BFLK'
 
+/** @brief stores the loader's global mutex */
+static FAST_MUTEX g_mut_platform_mutex;
+
 /**
  * <!-- description -->
  *   @brief If test is false, a contract violation has occurred. This
@@ -568,6 +572,42 @@ void
 platform_dump_vmm(void) NOEXCEPT
 {}
 
+/**
+ * <!-- description -->
+ *   @brief Initializes the loader's global mutex (see
+ *     platform_mutex_lock). This must be called from DriverEntry,
+ *     before any IOCTL can be received.
+ */
+void
+platform_mutex_init(void) NOEXCEPT
+{
+    ExInitializeFastMutex(&g_mut_platform_mutex);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Locks the loader's global mutex. Starting, stopping and
+ *     tracing the VMM all hold this mutex, which is what keeps the
+ *     VMM's resources from being freed while another IOCTL is still
+ *     using them. The mutex is not recursive and might sleep.
+ */
+void
+platform_mutex_lock(void) NOEXCEPT
+{
+    ExAcquireFastMutex(&g_mut_platform_mutex);
+}
+
+/**
+ * <!-- description -->
+ *   @brief Unlocks the loader's global mutex. See platform_mutex_lock
+ *     for more details.
+ */
+void
+platform_mutex_unlock(void) NOEXCEPT
+{
+    ExReleaseFastMutex(&g_mut_platform_mutex);
+}
+
 /**
  * <!-- description -->
  *   @brief Initializes the archiecture. Some platforms might need per CPU
@@ -100,15 +100,19 @@ list(APPEND HEADERS
 if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STREQUAL "GenuineIntel")
     hypervisor_target_source(syscall src/x64/bf_callback_op_register_bootstrap_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_callback_op_register_fail_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_callback_op_register_fast_path_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_callback_op_register_vmexit_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_control_op_exit_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_control_op_wait_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_control_op_again_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_control_op_vmexit_return_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_ext_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_huge_pool_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_debug_op_dump_locks_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_page_pool_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vm_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vmexit_log_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vmexit_stats_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vp_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_dump_vs_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_debug_op_out_impl.S ${HEADERS})
@@ -120,8 +124,10 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_intrinsic_op_wrmsr_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_mem_op_alloc_huge_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_mem_op_alloc_page_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_mem_op_free_huge_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_extid_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_online_pps_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_tls_exit_info_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_ppid_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_rax_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_tls_rbx_impl.S ${HEADERS})
@@ -175,11 +181,15 @@ if(HYPERVISOR_TARGET_ARCH STREQUAL "AuthenticAMD" OR HYPERVISOR_TARGET_ARCH STRE
     hypervisor_target_source(syscall src/x64/bf_vs_op_migrate_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_promote_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_read_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vs_op_read_many_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_run_current_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_run_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_set_active_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_tlb_flush_impl.S ${HEADERS})
     hypervisor_target_source(syscall src/x64/bf_vs_op_write_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vs_op_write_many_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vs_op_set_exit_info_impl.S ${HEADERS})
+    hypervisor_target_source(syscall src/x64/bf_vs_op_tlb_flush_range_impl.S ${HEADERS})
 endif()
 
 # ------------------------------------------------------------------------------
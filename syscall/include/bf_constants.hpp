@@ -92,6 +92,8 @@ namespace syscall
     constexpr auto BF_STATUS_FAILURE_INVALID_HANDLE{0xDEAD000000020001_u64};
     /// @brief Indicates the provided handle is invalid
     constexpr auto BF_STATUS_FAILURE_UNSUPPORTED{0xDEAD000000040001_u64};
+    /// @brief Indicates the syscall did not complete, but can be retried
+    constexpr auto BF_STATUS_FAILURE_RETRY{0xDEAD000000080001_u64};
     /// @brief Indicates the policy engine denied the syscall
     constexpr auto BF_STATUS_INVALID_PERM_DENIED{0xDEAD000000010002_u64};
     /// @brief Indicates input reg0 is invalid
@@ -351,6 +353,8 @@ namespace syscall
     constexpr auto TLS_OFFSET_R14{0x868_u64};
     /// @brief stores the offset for r15
     constexpr auto TLS_OFFSET_R15{0x870_u64};
+    /// @brief stores the offset of the exit information (see BF_MAX_EXIT_INFO)
+    constexpr auto TLS_OFFSET_EXIT_INFO{0x900_u64};
     /// @brief stores the offset of the active extid
     constexpr auto TLS_OFFSET_ACTIVE_EXTID{0xFF0_u64};
     /// @brief stores the offset of the active vmid
@@ -371,6 +375,39 @@ namespace syscall
     /// @brief Defines an invalid handle
     constexpr auto BF_INVALID_HANDLE{0xFFFFFFFFFFFFFFFF_u64};
 
+    // -------------------------------------------------------------------------
+    // Fast Path Rules
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines a fast path rule that overrides the result of a CPUID leaf
+    constexpr auto BF_FAST_PATH_CPUID{0x0000000000000000_u64};
+    /// @brief Defines a fast path rule that passes an MSR read through
+    constexpr auto BF_FAST_PATH_RDMSR{0x0000000000000001_u64};
+    /// @brief Defines a fast path rule that passes an MSR write through
+    constexpr auto BF_FAST_PATH_WRMSR{0x0000000000000002_u64};
+    /// @brief Defines a fast path rule that advances the IP and resumes
+    constexpr auto BF_FAST_PATH_ADVANCE_IP{0x0000000000000003_u64};
+    /// @brief Defines a CPUID fast path subleaf that matches any subleaf
+    constexpr auto BF_FAST_PATH_CPUID_ANY_SUBLEAF{0x00000000FFFFFFFF_u64};
+
+    // -------------------------------------------------------------------------
+    // VMExit Return Codes
+    // -------------------------------------------------------------------------
+
+    /// @brief Tells bf_control_op_vmexit_return to resume the current VS
+    constexpr auto BF_VMEXIT_RETURN_RUN_CURRENT{0x0000000000000000_u64};
+    /// @brief Tells bf_control_op_vmexit_return to advance IP and resume the current VS
+    constexpr auto BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT{0x0000000000000001_u64};
+
+    // -------------------------------------------------------------------------
+    // Register Lists
+    // -------------------------------------------------------------------------
+
+    /// @brief Defines the max number of bf_reg_val_t pairs in a register list
+    constexpr auto BF_MAX_REG_VALS{0x0000000000000100_u64};
+    /// @brief Defines the max number of registers published on each VMExit
+    constexpr auto BF_MAX_EXIT_INFO{0x0000000000000010_u64};
+
     // -------------------------------------------------------------------------
     // Syscall Indexes
     // -------------------------------------------------------------------------
@@ -381,6 +418,8 @@ namespace syscall
     constexpr auto BF_CONTROL_OP_WAIT_IDX_VAL{0x0000000000000001_u64};
     /// @brief Defines the index for bf_control_op_again
     constexpr auto BF_CONTROL_OP_AGAIN_IDX_VAL{0x0000000000000002_u64};
+    /// @brief Defines the index for bf_control_op_vmexit_return
+    constexpr auto BF_CONTROL_OP_VMEXIT_RETURN_IDX_VAL{0x0000000000000003_u64};
 
     /// @brief Defines the index for bf_handle_op_open_handle
     constexpr auto BF_HANDLE_OP_OPEN_HANDLE_IDX_VAL{0x0000000000000000_u64};
@@ -407,6 +446,10 @@ namespace syscall
     constexpr auto BF_DEBUG_OP_DUMP_PAGE_POOL_IDX_VAL{0x0000000000000008_u64};
     /// @brief Defines the index for bf_debug_op_dump_huge_pool
     constexpr auto BF_DEBUG_OP_DUMP_HUGE_POOL_IDX_VAL{0x0000000000000009_u64};
+    /// @brief Defines the index for bf_debug_op_dump_locks
+    constexpr auto BF_DEBUG_OP_DUMP_LOCKS_IDX_VAL{0x000000000000000A_u64};
+    /// @brief Defines the index for bf_debug_op_dump_vmexit_stats
+    constexpr auto BF_DEBUG_OP_DUMP_VMEXIT_STATS_IDX_VAL{0x000000000000000B_u64};
 
     /// @brief Defines the index for bf_callback_op_register_bootstrap
     constexpr auto BF_CALLBACK_OP_REGISTER_BOOTSTRAP_IDX_VAL{0x0000000000000000_u64};
@@ -414,6 +457,8 @@ namespace syscall
     constexpr auto BF_CALLBACK_OP_REGISTER_VMEXIT_IDX_VAL{0x0000000000000001_u64};
     /// @brief Defines the index for bf_callback_op_register_fail
     constexpr auto BF_CALLBACK_OP_REGISTER_FAIL_IDX_VAL{0x0000000000000002_u64};
+    /// @brief Defines the index for bf_callback_op_register_fast_path
+    constexpr auto BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL{0x0000000000000003_u64};
 
     /// @brief Defines the index for bf_vm_op_create_vm
     constexpr auto BF_VM_OP_CREATE_VM_IDX_VAL{0x0000000000000000_u64};
@@ -463,6 +508,14 @@ namespace syscall
     constexpr auto BF_VS_OP_ADVANCE_IP_AND_SET_ACTIVE_IDX_VAL{0x000000000000000D_u64};
     /// @brief Defines the index for bf_vs_op_tlb_flush
     constexpr auto BF_VS_OP_TLB_FLUSH_IDX_VAL{0x000000000000000E_u64};
+    /// @brief Defines the index for bf_vs_op_read_many
+    constexpr auto BF_VS_OP_READ_MANY_IDX_VAL{0x000000000000000F_u64};
+    /// @brief Defines the index for bf_vs_op_write_many
+    constexpr auto BF_VS_OP_WRITE_MANY_IDX_VAL{0x0000000000000010_u64};
+    /// @brief Defines the index for bf_vs_op_set_exit_info
+    constexpr auto BF_VS_OP_SET_EXIT_INFO_IDX_VAL{0x0000000000000011_u64};
+    /// @brief Defines the index for bf_vs_op_tlb_flush_range
+    constexpr auto BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL{0x0000000000000012_u64};
 
     /// @brief Defines the index for bf_intrinsic_op_rdmsr
     constexpr auto BF_INTRINSIC_OP_RDMSR_IDX_VAL{0x0000000000000000_u64};
@@ -473,6 +526,8 @@ namespace syscall
     constexpr auto BF_MEM_OP_ALLOC_PAGE_IDX_VAL{0x0000000000000000_u64};
     /// @brief Defines the index for bf_mem_op_alloc_huge
     constexpr auto BF_MEM_OP_ALLOC_HUGE_IDX_VAL{0x0000000000000002_u64};
+    /// @brief Defines the index for bf_mem_op_free_huge
+    constexpr auto BF_MEM_OP_FREE_HUGE_IDX_VAL{0x0000000000000003_u64};
 }
 
 #endif
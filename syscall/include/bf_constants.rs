@@ -95,6 +95,8 @@ pub const BF_STATUS_FAILURE_UNKNOWN: bsl::SafeU64 = bsl::SafeU64::new(0xDEAD0000
 pub const BF_STATUS_FAILURE_INVALID_HANDLE: bsl::SafeU64 = bsl::SafeU64::new(0xDEAD000000020001);
 /// @brief Indicates the provided handle is invalid
 pub const BF_STATUS_FAILURE_UNSUPPORTED: bsl::SafeU64 = bsl::SafeU64::new(0xDEAD000000040001);
+/// @brief Indicates the syscall did not complete, but can be retried
+pub const BF_STATUS_FAILURE_RETRY: bsl::SafeU64 = bsl::SafeU64::new(0xDEAD000000080001);
 /// @brief Indicates the policy engine denied the syscall
 pub const BF_STATUS_INVALID_PERM_DENIED: bsl::SafeU64 = bsl::SafeU64::new(0xDEAD000000010002);
 /// @brief Indicates input reg0 is invalid
@@ -397,6 +399,8 @@ pub const TLS_OFFSET_R13: bsl::SafeU64 = bsl::SafeU64::new(0x860);
 pub const TLS_OFFSET_R14: bsl::SafeU64 = bsl::SafeU64::new(0x868);
 /// @brief stores the offset for r15
 pub const TLS_OFFSET_R15: bsl::SafeU64 = bsl::SafeU64::new(0x870);
+/// @brief stores the offset of the exit information (see BF_MAX_EXIT_INFO)
+pub const TLS_OFFSET_EXIT_INFO: bsl::SafeU64 = bsl::SafeU64::new(0x900);
 /// @brief stores the offset of the active extid
 pub const TLS_OFFSET_ACTIVE_EXTID: bsl::SafeU64 = bsl::SafeU64::new(0xFF0);
 /// @brief stores the offset of the active vmid
@@ -417,6 +421,40 @@ pub const TLS_OFFSET_ONLINE_PPS: bsl::SafeU64 = bsl::SafeU64::new(0xFFA);
 /// @brief Defines an invalid handle
 pub const BF_INVALID_HANDLE: bsl::SafeU64 = bsl::SafeU64::new(0xFFFFFFFFFFFFFFFF);
 
+// -----------------------------------------------------------------------------
+// Fast Path Rules
+// -----------------------------------------------------------------------------
+
+/// @brief Defines a fast path rule that overrides the result of a CPUID leaf
+pub const BF_FAST_PATH_CPUID: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
+/// @brief Defines a fast path rule that passes an MSR read through
+pub const BF_FAST_PATH_RDMSR: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000001);
+/// @brief Defines a fast path rule that passes an MSR write through
+pub const BF_FAST_PATH_WRMSR: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000002);
+/// @brief Defines a fast path rule that advances the IP and resumes
+pub const BF_FAST_PATH_ADVANCE_IP: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000003);
+/// @brief Defines a CPUID fast path subleaf that matches any subleaf
+pub const BF_FAST_PATH_CPUID_ANY_SUBLEAF: bsl::SafeU64 = bsl::SafeU64::new(0x00000000FFFFFFFF);
+
+// -----------------------------------------------------------------------------
+// VMExit Return Codes
+// -----------------------------------------------------------------------------
+
+/// @brief Tells bf_control_op_vmexit_return to resume the current VS
+pub const BF_VMEXIT_RETURN_RUN_CURRENT: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
+/// @brief Tells bf_control_op_vmexit_return to advance IP and resume the current VS
+pub const BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT: bsl::SafeU64 =
+    bsl::SafeU64::new(0x0000000000000001);
+
+// -----------------------------------------------------------------------------
+// Register Lists
+// -----------------------------------------------------------------------------
+
+/// @brief Defines the max number of BfRegValT pairs in a register list
+pub const BF_MAX_REG_VALS: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000100);
+/// @brief Defines the max number of registers published on each VMExit
+pub const BF_MAX_EXIT_INFO: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000010);
+
 // -----------------------------------------------------------------------------
 // Syscall Indexes
 // -----------------------------------------------------------------------------
@@ -427,6 +465,8 @@ pub const BF_CONTROL_OP_EXIT_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000
 pub const BF_CONTROL_OP_WAIT_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000001);
 /// @brief Defines the index for bf_control_op_again
 pub const BF_CONTROL_OP_AGAIN_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000002);
+/// @brief Defines the index for bf_control_op_vmexit_return
+pub const BF_CONTROL_OP_VMEXIT_RETURN_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000003);
 
 /// @brief Defines the index for bf_handle_op_open_handle
 pub const BF_HANDLE_OP_OPEN_HANDLE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
@@ -453,6 +493,11 @@ pub const BF_DEBUG_OP_DUMP_EXT_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x00000
 pub const BF_DEBUG_OP_DUMP_PAGE_POOL_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000008);
 /// @brief Defines the index for bf_debug_op_dump_huge_pool
 pub const BF_DEBUG_OP_DUMP_HUGE_POOL_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000009);
+/// @brief Defines the index for bf_debug_op_dump_locks
+pub const BF_DEBUG_OP_DUMP_LOCKS_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x000000000000000A);
+/// @brief Defines the index for bf_debug_op_dump_vmexit_stats
+pub const BF_DEBUG_OP_DUMP_VMEXIT_STATS_IDX_VAL: bsl::SafeU64 =
+    bsl::SafeU64::new(0x000000000000000B);
 
 /// @brief Defines the index for bf_callback_op_register_bootstrap
 pub const BF_CALLBACK_OP_REGISTER_BOOTSTRAP_IDX_VAL: bsl::SafeU64 =
@@ -463,6 +508,9 @@ pub const BF_CALLBACK_OP_REGISTER_VMEXIT_IDX_VAL: bsl::SafeU64 =
 /// @brief Defines the index for bf_callback_op_register_fail
 pub const BF_CALLBACK_OP_REGISTER_FAIL_IDX_VAL: bsl::SafeU64 =
     bsl::SafeU64::new(0x0000000000000002);
+/// @brief Defines the index for bf_callback_op_register_fast_path
+pub const BF_CALLBACK_OP_REGISTER_FAST_PATH_IDX_VAL: bsl::SafeU64 =
+    bsl::SafeU64::new(0x0000000000000003);
 
 /// @brief Defines the index for bf_vm_op_create_vm
 pub const BF_VM_OP_CREATE_VM_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
@@ -515,6 +563,14 @@ pub const BF_VS_OP_ADVANCE_IP_AND_SET_ACTIVE_IDX_VAL: bsl::SafeU64 =
     bsl::SafeU64::new(0x000000000000000D);
 /// @brief Defines the index for bf_vs_op_tlb_flush
 pub const BF_VS_OP_TLB_FLUSH_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x000000000000000E);
+/// @brief Defines the index for bf_vs_op_read_many
+pub const BF_VS_OP_READ_MANY_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x000000000000000F);
+/// @brief Defines the index for bf_vs_op_write_many
+pub const BF_VS_OP_WRITE_MANY_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000010);
+/// @brief Defines the index for bf_vs_op_set_exit_info
+pub const BF_VS_OP_SET_EXIT_INFO_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000011);
+/// @brief Defines the index for bf_vs_op_tlb_flush_range
+pub const BF_VS_OP_TLB_FLUSH_RANGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000012);
 
 /// @brief Defines the index for bf_intrinsic_op_rdmsr
 pub const BF_INTRINSIC_OP_RDMSR_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
@@ -525,3 +581,5 @@ pub const BF_INTRINSIC_OP_WRMSR_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000
 pub const BF_MEM_OP_ALLOC_PAGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000000);
 /// @brief Defines the index for bf_mem_op_alloc_huge
 pub const BF_MEM_OP_ALLOC_HUGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000002);
+/// @brief Defines the index for bf_mem_op_free_huge
+pub const BF_MEM_OP_FREE_HUGE_IDX_VAL: bsl::SafeU64 = bsl::SafeU64::new(0x0000000000000003);
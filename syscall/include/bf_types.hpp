@@ -25,6 +25,9 @@
 #ifndef BF_TYPES_HPP
 #define BF_TYPES_HPP
 
+#include <bf_constants.hpp>
+
+#include <bsl/array.hpp>
 #include <bsl/safe_integral.hpp>
 
 namespace syscall
@@ -35,6 +38,30 @@ namespace syscall
 
     /// @brief Defines the type used for returning status from a function
     using bf_status_t = bsl::safe_u64;
+
+    // -------------------------------------------------------------------------
+    // Structure Types
+    // -------------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Defines a single bf_reg_t/value pair. A page of these is
+    ///     shared with the microkernel by bf_vs_op_read_many and
+    ///     bf_vs_op_write_many so that many registers can be read from, or
+    ///     written to a VS using a single syscall.
+    ///
+    struct bf_reg_val_t final
+    {
+        /// @brief stores the bf_reg_t to read from or write to
+        bsl::uint64 reg;
+        /// @brief stores the value that was read, or the value to write
+        bsl::uint64 val;
+    };
+
+    /// @brief Defines the page of bf_reg_val_t pairs used by the _many ops
+    using bf_reg_vals_t = bsl::array<bf_reg_val_t, BF_MAX_REG_VALS.get()>;
+
+    /// @brief the list must fit in a single page
+    static_assert(sizeof(bf_reg_vals_t) == HYPERVISOR_PAGE_SIZE);
 }
 
 #endif
@@ -28,3 +28,26 @@
 
 /// @brief Defines the type used for returning status from a function
 pub type BfStatusT = bsl::SafeU64;
+
+// -------------------------------------------------------------------------
+// Structure Types
+// -------------------------------------------------------------------------
+
+/// <!-- description -->
+///   @brief Defines a single bf_reg_t/value pair. A page of these is
+///     shared with the microkernel by bf_vs_op_read_many and
+///     bf_vs_op_write_many so that many registers can be read from, or
+///     written to a VS using a single syscall.
+///
+#[repr(C)]
+#[derive(Debug, Default, Copy, Clone)]
+pub struct BfRegValT {
+    /// @brief stores the bf_reg_t to read from or write to
+    pub reg: u64,
+    /// @brief stores the value that was read, or the value to write
+    pub val: u64,
+}
+
+/// @brief Defines the page of BfRegValT pairs used by the _many ops
+/// (BF_MAX_REG_VALS entries)
+pub type BfRegValsT = [BfRegValT; 0x100];
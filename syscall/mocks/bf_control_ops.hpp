@@ -28,7 +28,9 @@
 #include <bf_syscall_impl.hpp>    // IWYU pragma: export
 // IWYU pragma: no_include "bf_syscall_impl.hpp"
 
+#include <bsl/expects.hpp>
 #include <bsl/is_constant_evaluated.hpp>
+#include <bsl/safe_integral.hpp>
 
 namespace syscall
 {
@@ -77,6 +79,32 @@ namespace syscall
 
         bf_control_op_again_impl();
     }
+
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel that the extension is
+    ///     done handling the current VMExit and that the current VS should
+    ///     be resumed (advancing its IP first if code is
+    ///     BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT). Unlike
+    ///     bf_vs_op_run_current, the microkernel does not dispatch or
+    ///     validate anything, it simply hands the code back to its VMExit
+    ///     loop. This syscall is a blocking syscall that never returns and
+    ///     must only be used to return from the vmexit_entry function.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param code BF_VMEXIT_RETURN_RUN_CURRENT or
+    ///     BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT
+    ///
+    constexpr void
+    bf_control_op_vmexit_return(bsl::safe_u64 const &code) noexcept
+    {
+        bsl::expects(code.is_valid_and_checked());
+
+        if (bsl::is_constant_evaluated()) {
+            return;
+        }
+
+        bf_control_op_vmexit_return_impl(code.get());
+    }
 }
 
 #endif
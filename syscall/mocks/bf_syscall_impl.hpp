@@ -27,6 +27,7 @@
 
 #include <bf_constants.hpp>
 #include <bf_reg_t.hpp>
+#include <bf_types.hpp>
 #include <iostream>
 #include <string>
 #include <string_view>
@@ -34,6 +35,7 @@
 #include <bsl/char_type.hpp>
 #include <bsl/convert.hpp>
 #include <bsl/discard.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unlikely.hpp>
@@ -86,6 +88,10 @@ namespace syscall
     constinit inline bool g_mut_bf_control_op_wait_impl_executed{};
     /// @brief stores whether or not bf_control_op_again_impl was executed
     constinit inline bool g_mut_bf_control_op_again_impl_executed{};
+    /// @brief stores whether or not bf_control_op_vmexit_return_impl was executed
+    constinit inline bool g_mut_bf_control_op_vmexit_return_impl_executed{};
+    /// @brief stores the code last given to bf_control_op_vmexit_return_impl
+    constinit inline bsl::safe_u64 g_mut_bf_control_op_vmexit_return_impl_code{};
 
     /// @brief stores whether or not bf_debug_op_out_impl was executed
     constinit inline bool g_mut_bf_debug_op_out_impl_executed{};
@@ -107,6 +113,10 @@ namespace syscall
     constinit inline bool g_mut_bf_debug_op_dump_page_pool_impl_executed{};
     /// @brief stores whether or not bf_debug_op_dump_huge_pool_impl was executed
     constinit inline bool g_mut_bf_debug_op_dump_huge_pool_impl_executed{};
+    /// @brief stores whether or not bf_debug_op_dump_locks_impl was executed
+    constinit inline bool g_mut_bf_debug_op_dump_locks_impl_executed{};
+    /// @brief stores whether or not bf_debug_op_dump_vmexit_stats_impl was executed
+    constinit inline bool g_mut_bf_debug_op_dump_vmexit_stats_impl_executed{};
 
     // -------------------------------------------------------------------------
     // Bootstrap Callback Handler Type
@@ -617,6 +627,20 @@ namespace syscall
         return bsl::to_u16(g_mut_data.at("bf_tls_online_pps")).get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param idx n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_tls_exit_info_impl(bsl::uint64 const idx) noexcept -> bsl::uint64
+    {
+        bsl::discard(idx);
+        return g_mut_data.at("bf_tls_exit_info").get();
+    }
+
     // -------------------------------------------------------------------------
     // bf_control_ops
     // -------------------------------------------------------------------------
@@ -648,6 +672,19 @@ namespace syscall
         g_mut_bf_control_op_again_impl_executed = true;
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_control_op_vmexit_return.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    extern "C" inline void
+    bf_control_op_vmexit_return_impl(bsl::uint64 const reg0_in) noexcept
+    {
+        g_mut_bf_control_op_vmexit_return_impl_executed = true;
+        g_mut_bf_control_op_vmexit_return_impl_code = reg0_in;
+    }
+
     // -------------------------------------------------------------------------
     // bf_handle_ops
     // -------------------------------------------------------------------------
@@ -831,6 +868,30 @@ namespace syscall
         std::cout << "huge pool dump: mock empty\n";
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_locks.
+    ///
+    extern "C" inline void
+    bf_debug_op_dump_locks_impl() noexcept
+    {
+        g_mut_bf_debug_op_dump_locks_impl_executed = true;
+        std::cout << "lock stats dump: mock empty\n";
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_vmexit_stats.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    extern "C" inline void
+    bf_debug_op_dump_vmexit_stats_impl(bsl::uint16 const reg0_in) noexcept
+    {
+        g_mut_bf_debug_op_dump_vmexit_stats_impl_executed = true;
+        // NOLINTNEXTLINE(bsl-function-name-use)
+        std::cout << std::hex << "vmexit stats for pp [0x" << reg0_in << "]: mock empty\n";
+    }
+
     // -------------------------------------------------------------------------
     // bf_callback_ops
     // -------------------------------------------------------------------------
@@ -892,6 +953,34 @@ namespace syscall
         return g_mut_errc.at("bf_callback_op_register_fail_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_callback_op_register_fast_path.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @param reg4_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_callback_op_register_fast_path_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint64 const reg1_in,
+        bsl::uint64 const reg2_in,
+        bsl::uint64 const reg3_in,
+        bsl::uint64 const reg4_in) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+        bsl::discard(reg2_in);
+        bsl::discard(reg3_in);
+        bsl::discard(reg4_in);
+
+        return g_mut_errc.at("bf_callback_op_register_fast_path_impl").get();
+    }
+
     // -------------------------------------------------------------------------
     // bf_vm_ops
     // -------------------------------------------------------------------------
@@ -1233,6 +1322,115 @@ namespace syscall
         return g_mut_errc.at("bf_vs_op_write_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_read_many.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param pmut_reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vs_op_read_many_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bf_reg_vals_t *const pmut_reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        if (bsl::unlikely(nullptr == pmut_reg2_in)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (bsl::unlikely(bsl::to_u64(reg3_in) > BF_MAX_REG_VALS)) {
+            return BF_STATUS_INVALID_INPUT_REG3.get();
+        }
+
+        if (g_mut_errc.at("bf_vs_op_read_many_impl") == BF_STATUS_SUCCESS) {
+            for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(reg3_in); ++mut_i) {
+                pmut_reg2_in->at_if(mut_i)->val =
+                    g_mut_data.at("bf_vs_op_read_many_impl_val").get();
+            }
+        }
+        else {
+            bsl::touch();
+        }
+
+        return g_mut_errc.at("bf_vs_op_read_many_impl").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_write_many.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vs_op_write_many_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bf_reg_vals_t const *const reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        if (bsl::unlikely(nullptr == reg2_in)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (g_mut_errc.at("bf_vs_op_write_many_impl") == BF_STATUS_SUCCESS) {
+            g_mut_data.at("bf_vs_op_write_many_impl") = reg3_in;
+        }
+        else {
+            bsl::touch();
+        }
+
+        return g_mut_errc.at("bf_vs_op_write_many_impl").get();
+    }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_set_exit_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vs_op_set_exit_info_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bf_reg_vals_t const *const reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        if (bsl::unlikely(nullptr == reg2_in)) {
+            return BF_STATUS_FAILURE_UNKNOWN.get();
+        }
+
+        if (g_mut_errc.at("bf_vs_op_set_exit_info_impl") == BF_STATUS_SUCCESS) {
+            g_mut_data.at("bf_vs_op_set_exit_info_impl") = reg3_in;
+        }
+        else {
+            bsl::touch();
+        }
+
+        return g_mut_errc.at("bf_vs_op_set_exit_info_impl").get();
+    }
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_vs_op_run.
     ///
@@ -1439,6 +1637,31 @@ namespace syscall
         return g_mut_errc.at("bf_vs_op_tlb_flush_impl").get();
     }
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_tlb_flush_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_vs_op_tlb_flush_range_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bsl::uint64 const reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+        bsl::discard(reg2_in);
+        bsl::discard(reg3_in);
+
+        return g_mut_errc.at("bf_vs_op_tlb_flush_range_impl").get();
+    }
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_ops
     // -------------------------------------------------------------------------
@@ -1580,6 +1803,24 @@ namespace syscall
 
         return g_mut_errc.at("bf_mem_op_alloc_huge_impl").get();
     }
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_huge.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] inline auto
+    bf_mem_op_free_huge_impl(bsl::uint64 const reg0_in, void *const reg1_in) noexcept
+        -> bsl::uint64
+    {
+        bsl::discard(reg0_in);
+        bsl::discard(reg1_in);
+
+        return g_mut_errc.at("bf_mem_op_free_huge_impl").get();
+    }
 }
 
 #endif
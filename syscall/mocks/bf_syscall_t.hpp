@@ -42,6 +42,7 @@
 #include <bsl/errc_type.hpp>
 #include <bsl/expects.hpp>
 #include <bsl/is_pod.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/touch.hpp>
 #include <bsl/unordered_map.hpp>
@@ -64,6 +65,8 @@ namespace syscall
         /// @brief stores TLS data
         bsl::unordered_map<bsl::safe_u64, bsl::safe_u64> m_tls{};
 
+        /// @brief stores the results for bf_callback_op_register_fast_path
+        bsl::unordered_map<std::tuple<bsl::safe_u64, bsl::safe_u64>, bsl::errc_type> m_bf_callback_op_register_fast_path{};
         /// @brief stores the results for bf_vm_op_create_vm
         bsl::safe_u16 m_bf_vm_op_create_vm{};
         /// @brief stores the results for bf_vm_op_destroy_vm
@@ -100,6 +103,8 @@ namespace syscall
         bsl::errc_type m_bf_vs_op_advance_ip_and_run_current{};
         /// @brief stores the results for bf_vs_op_promote
         bsl::unordered_map<bsl::safe_u16, bsl::errc_type> m_bf_vs_op_promote{};
+        /// @brief stores the results for bf_vs_op_set_exit_info
+        bsl::unordered_map<bsl::safe_u16, bsl::errc_type> m_bf_vs_op_set_exit_info{};
         /// @brief stores the results for bf_vs_op_clear
         bsl::unordered_map<bsl::safe_u16, bsl::errc_type> m_bf_vs_op_clear{};
         /// @brief stores the results for bf_vs_op_migrate
@@ -110,6 +115,8 @@ namespace syscall
         bsl::unordered_map<std::tuple<bsl::safe_u16, bsl::safe_u16, bsl::safe_u16>, bsl::errc_type> m_bf_vs_op_advance_ip_and_set_active{};
         /// @brief stores the results for bf_vs_op_tlb_flush
         bsl::unordered_map<std::tuple<bsl::safe_u16, bsl::safe_u64>, bsl::errc_type> m_bf_vs_op_tlb_flush{};
+        /// @brief stores the results for bf_vs_op_tlb_flush_range
+        bsl::unordered_map<std::tuple<bsl::safe_u16, bsl::safe_u64, bsl::safe_u64>, bsl::errc_type> m_bf_vs_op_tlb_flush_range{};
         /// @brief stores the results for bf_intrinsic_op_rdmsr
         bsl::unordered_map<bsl::safe_u32, bsl::safe_u64> m_bf_intrinsic_op_rdmsr{};
         /// @brief stores the results for bf_intrinsic_op_wrmsr
@@ -118,6 +125,8 @@ namespace syscall
         bsl::errc_type m_bf_mem_op_alloc_page{};
         /// @brief stores the results for bf_mem_op_alloc_huge
         bsl::errc_type m_bf_mem_op_alloc_huge{};
+        /// @brief stores the results for bf_mem_op_free_huge
+        bsl::errc_type m_bf_mem_op_free_huge{};
 
         /// @brief stores the call count for initialize
         bsl::safe_umx m_initialize_count{};
@@ -153,6 +162,8 @@ namespace syscall
         bsl::safe_umx m_bf_tls_set_r14_count{};
         /// @brief stores the call count for bf_tls_set_r15
         bsl::safe_umx m_bf_tls_set_r15_count{};
+        /// @brief stores the call count for bf_callback_op_register_fast_path
+        bsl::safe_umx m_bf_callback_op_register_fast_path_count{};
         /// @brief stores the call count for bf_vm_op_create_vm
         bsl::safe_umx m_bf_vm_op_create_vm_count{};
         /// @brief stores the call count for bf_vm_op_destroy_vm
@@ -189,6 +200,8 @@ namespace syscall
         bsl::safe_umx m_bf_vs_op_advance_ip_and_run_current_count{};
         /// @brief stores the call count for bf_vs_op_promote
         bsl::safe_umx m_bf_vs_op_promote_count{};
+        /// @brief stores the call count for bf_vs_op_set_exit_info
+        bsl::safe_umx m_bf_vs_op_set_exit_info_count{};
         /// @brief stores the call count for bf_vs_op_clear
         bsl::safe_umx m_bf_vs_op_clear_count{};
         /// @brief stores the call count for bf_vs_op_migrate
@@ -199,6 +212,8 @@ namespace syscall
         bsl::safe_umx m_bf_vs_op_advance_ip_and_set_active_count{};
         /// @brief stores the call count for bf_vs_op_tlb_flush
         bsl::safe_umx m_bf_vs_op_tlb_flush_count{};
+        /// @brief stores the call count for bf_vs_op_tlb_flush_range
+        bsl::safe_umx m_bf_vs_op_tlb_flush_range_count{};
         /// @brief stores the call count for bf_intrinsic_op_rdmsr
         bsl::safe_umx m_bf_intrinsic_op_rdmsr_count{};
         /// @brief stores the call count for bf_intrinsic_op_wrmsr
@@ -207,6 +222,8 @@ namespace syscall
         bsl::safe_umx m_bf_mem_op_alloc_page_count{};
         /// @brief stores the call count for bf_mem_op_alloc_huge
         bsl::safe_umx m_bf_mem_op_alloc_huge_count{};
+        /// @brief stores the call count for bf_mem_op_free_huge
+        bsl::safe_umx m_bf_mem_op_free_huge_count{};
 
 
         /// @brief stores the direct map with a phys to virt relationship
@@ -1078,6 +1095,38 @@ namespace syscall
             m_tls.at(TLS_OFFSET_ONLINE_PPS) = bsl::to_u64(val);
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the idx'th value of tls.exit_info
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the value to return
+        ///   @return Returns the idx'th value of tls.exit_info
+        ///
+        [[nodiscard]] constexpr auto
+        bf_tls_exit_info(bsl::safe_idx const &idx) const noexcept -> bsl::safe_u64
+        {
+            bsl::expects(bsl::to_u64(idx) < BF_MAX_EXIT_INFO);
+
+            constexpr auto size{8_u64};
+            return m_tls.at((TLS_OFFSET_EXIT_INFO + (bsl::to_u64(idx) * size)).checked());
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the idx'th value of tls.exit_info (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the value to set
+        ///   @param val The value to set tls.exit_info[idx] to
+        ///
+        constexpr void
+        bf_tls_set_exit_info(bsl::safe_idx const &idx, bsl::safe_u64 const &val) noexcept
+        {
+            bsl::expects(bsl::to_u64(idx) < BF_MAX_EXIT_INFO);
+
+            constexpr auto size{8_u64};
+            m_tls.at((TLS_OFFSET_EXIT_INFO + (bsl::to_u64(idx) * size)).checked()) = val;
+        }
+
         /// <!-- description -->
         ///   @brief Returns true if the active VM is the
         ///     root VM. Returns false otherwise.
@@ -1141,6 +1190,73 @@ namespace syscall
             return vsid < bf_tls_online_pps();
         }
 
+        // ---------------------------------------------------------------------
+        // bf_callback_ops
+        // ---------------------------------------------------------------------
+
+        /// <!-- description -->
+        ///   @brief Registers a fast path rule with the microkernel for the
+        ///     PP this syscall is executed on.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param kind the kind of rule to register (BF_FAST_PATH_xxx)
+        ///   @param key the CPUID leaf/subleaf, MSR or exit reason to match
+        ///   @param val0 the first value associated with the rule
+        ///   @param val1 the second value associated with the rule
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_callback_op_register_fast_path(
+            bsl::safe_u64 const &kind,
+            bsl::safe_u64 const &key,
+            bsl::safe_u64 const &val0,
+            bsl::safe_u64 const &val1) noexcept -> bsl::errc_type
+        {
+            bsl::expects(kind.is_valid_and_checked());
+            bsl::expects(kind <= BF_FAST_PATH_ADVANCE_IP);
+            bsl::expects(key.is_valid_and_checked());
+            bsl::expects(val0.is_valid_and_checked());
+            bsl::expects(val1.is_valid_and_checked());
+
+            ++m_bf_callback_op_register_fast_path_count;
+            return m_bf_callback_op_register_fast_path.at({kind, key});
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of
+        ///     bf_callback_op_register_fast_path. (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param kind the kind of rule to register (BF_FAST_PATH_xxx)
+        ///   @param key the CPUID leaf/subleaf, MSR or exit reason to match
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_callback_op_register_fast_path
+        ///
+        constexpr void
+        set_bf_callback_op_register_fast_path(
+            bsl::safe_u64 const &kind,
+            bsl::safe_u64 const &key,
+            bsl::errc_type const errc) noexcept
+        {
+            m_bf_callback_op_register_fast_path.at({kind, key}) = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times
+        ///     bf_callback_op_register_fast_path has been called
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times
+        ///     bf_callback_op_register_fast_path has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_callback_op_register_fast_path_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_callback_op_register_fast_path_count.checked();
+        }
+
         // ---------------------------------------------------------------------
         // bf_vm_ops
         // ---------------------------------------------------------------------
@@ -1899,6 +2015,96 @@ namespace syscall
             return m_bf_vs_op_write_count.checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Reads many CPU registers from the VS using a single
+        ///     syscall. regs must point to a page that was allocated using
+        ///     bf_mem_op_alloc_page. On input, the reg field of the first
+        ///     num entries of regs define which bf_reg_t to read. On
+        ///     success, the val field of each of these entries contains the
+        ///     value that was read. Note that the bf_reg_t is architecture
+        ///     specific.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to read from
+        ///   @param pmut_regs The page of bf_reg_t/value pairs to read
+        ///   @param num The number of pairs in pmut_regs to read
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_read_many(
+            bsl::safe_u16 const &vsid,
+            bf_reg_vals_t *const pmut_regs,
+            bsl::safe_u64 const &num) const noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(nullptr != pmut_regs);
+            bsl::expects(num.is_valid_and_checked());
+            bsl::expects(num.is_pos());
+            bsl::expects(num <= BF_MAX_REG_VALS);
+
+            for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(num); ++mut_i) {
+                auto *const pmut_reg{pmut_regs->at_if(mut_i)};
+                auto const reg{static_cast<bf_reg_t>(pmut_reg->reg)};
+
+                auto const val{this->bf_vs_op_read(vsid, reg)};
+                if (bsl::unlikely(val.is_invalid())) {
+                    return bsl::errc_failure;
+                }
+
+                pmut_reg->val = val.get();
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes to many CPU registers in the VS using a single
+        ///     syscall. regs must point to a page that was allocated using
+        ///     bf_mem_op_alloc_page. The first num entries of regs define
+        ///     which bf_reg_t to write to, and the value to write. The
+        ///     entries are written in order, and if an entry cannot be
+        ///     written, the remaining entries are not written. Note that
+        ///     the bf_reg_t is architecture specific.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to write to
+        ///   @param regs The page of bf_reg_t/value pairs to write
+        ///   @param num The number of pairs in regs to write
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_write_many(
+            bsl::safe_u16 const &vsid,
+            bf_reg_vals_t const *const regs,
+            bsl::safe_u64 const &num) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(nullptr != regs);
+            bsl::expects(num.is_valid_and_checked());
+            bsl::expects(num.is_pos());
+            bsl::expects(num <= BF_MAX_REG_VALS);
+
+            for (bsl::safe_idx mut_i{}; mut_i < bsl::to_umx(num); ++mut_i) {
+                auto const *const preg{regs->at_if(mut_i)};
+                auto const reg{static_cast<bf_reg_t>(preg->reg)};
+
+                auto const ret{this->bf_vs_op_write(vsid, reg, bsl::to_u64(preg->val))};
+                if (bsl::unlikely(!ret)) {
+                    return ret;
+                }
+
+                bsl::touch();
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief TODO
         ///
@@ -2160,6 +2366,66 @@ namespace syscall
             return m_bf_vs_op_promote_count.checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Tells the microkernel which registers to publish into
+        ///     the extension's TLS block (see bf_tls_exit_info) every time
+        ///     the VS exits. Only the bf_reg_t of the first num entries of
+        ///     regs are used. If num is 0, the microkernel stops publishing
+        ///     exit information for this VS.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to configure
+        ///   @param regs The page of bf_reg_t to publish on every VM exit
+        ///   @param num The number of bf_reg_t in regs to publish
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_set_exit_info(
+            bsl::safe_u16 const &vsid,
+            bf_reg_vals_t const *const regs,
+            bsl::safe_u64 const &num) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(nullptr != regs);
+            bsl::expects(num.is_valid_and_checked());
+            bsl::expects(num <= BF_MAX_EXIT_INFO);
+
+            ++m_bf_vs_op_set_exit_info_count;
+            return m_bf_vs_op_set_exit_info.at(vsid);
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_vs_op_set_exit_info.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to configure
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_vs_op_set_exit_info
+        ///
+        constexpr void
+        set_bf_vs_op_set_exit_info(bsl::safe_u16 const &vsid, bsl::errc_type const errc) noexcept
+        {
+            m_bf_vs_op_set_exit_info.at(vsid) = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times bf_vs_op_set_exit_info
+        ///     has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times bf_vs_op_set_exit_info
+        ///     has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_set_exit_info_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_vs_op_set_exit_info_count.checked();
+        }
+
         /// <!-- description -->
         ///   @brief bf_vs_op_clear tells the microkernel to clear the VS's
         ///     hardware cache, if one exists. How this is used depends entirely
@@ -2457,6 +2723,74 @@ namespace syscall
             return m_bf_vs_op_tlb_flush_count.checked();
         }
 
+        /// <!-- description -->
+        ///   @brief Given the ID of a VS, invalidates the TLB entries for
+        ///     num_pages pages starting at the provided GLA on the PP that
+        ///     this is executed on. The microkernel is free to flush every
+        ///     TLB entry associated with the VS instead if the range is
+        ///     large.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to invalidate
+        ///   @param gla The GLA of the first page to invalidate
+        ///   @param num_pages The number of pages to invalidate
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_tlb_flush_range(
+            bsl::safe_u16 const &vsid,
+            bsl::safe_u64 const &gla,
+            bsl::safe_u64 const &num_pages) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(gla.is_valid_and_checked());
+            bsl::expects(gla.is_pos());
+            bsl::expects(bf_is_page_aligned(gla));
+            bsl::expects(num_pages.is_valid_and_checked());
+            bsl::expects(num_pages.is_pos());
+
+            ++m_bf_vs_op_tlb_flush_range_count;
+            return m_bf_vs_op_tlb_flush_range.at({vsid, gla, num_pages});
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_vs_op_tlb_flush_range.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to invalidate
+        ///   @param gla The GLA of the first page to invalidate
+        ///   @param num_pages The number of pages to invalidate
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_vs_op_tlb_flush_range
+        ///
+        constexpr void
+        set_bf_vs_op_tlb_flush_range(
+            bsl::safe_u16 const &vsid,
+            bsl::safe_u64 const &gla,
+            bsl::safe_u64 const &num_pages,
+            bsl::errc_type const errc) noexcept
+        {
+            m_bf_vs_op_tlb_flush_range.at({vsid, gla, num_pages}) = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times bf_vs_op_tlb_flush_range
+        ///     has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times bf_vs_op_tlb_flush_range
+        ///     has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_tlb_flush_range_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_vs_op_tlb_flush_range_count.checked();
+        }
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -2775,6 +3109,54 @@ namespace syscall
         {
             return m_bf_mem_op_alloc_huge_count.checked();
         }
+
+        /// <!-- description -->
+        ///   @brief bf_mem_op_free_huge frees memory previously allocated
+        ///     by bf_mem_op_alloc_huge. Once this returns, the memory is no
+        ///     longer mapped into the extension on any PP, and must not be
+        ///     used.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_ptr the pointer returned by bf_mem_op_alloc_huge
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_huge(void *const pmut_ptr) noexcept -> bsl::errc_type
+        {
+            bsl::expects(nullptr != pmut_ptr);
+
+            ++m_bf_mem_op_free_huge_count;
+            return m_bf_mem_op_free_huge;
+        }
+
+        /// <!-- description -->
+        ///   @brief Sets the return value of bf_mem_op_free_huge.
+        ///     (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param errc the bsl::errc_type to return when executing
+        ///     bf_mem_op_free_huge
+        ///
+        constexpr void
+        set_bf_mem_op_free_huge(bsl::errc_type const errc) noexcept
+        {
+            m_bf_mem_op_free_huge = errc;
+        }
+
+        /// <!-- description -->
+        ///   @brief Returns the total number of times bf_mem_op_free_huge
+        ///     has been called (unit testing only)
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @return Returns the total number of times bf_mem_op_free_huge
+        ///     has been called
+        ///
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_huge_count() const noexcept -> bsl::safe_umx
+        {
+            return m_bf_mem_op_free_huge_count.checked();
+        }
     };
 }
 
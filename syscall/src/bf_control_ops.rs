@@ -55,3 +55,23 @@ pub fn bf_control_op_again() {
         crate::bf_syscall_impl::bf_control_op_again_impl();
     }
 }
+
+/// <!-- description -->
+///   @brief This syscall tells the microkernel that the extension is
+///     done handling the current VMExit and that the current VS should
+///     be resumed (advancing its IP first if code is
+///     BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT). Unlike
+///     bf_vs_op_run_current, the microkernel does not dispatch or
+///     validate anything, it simply hands the code back to its VMExit
+///     loop. This syscall is a blocking syscall that never returns and
+///     must only be used to return from the vmexit_entry function.
+///
+/// <!-- inputs/outputs -->
+///   @param code BF_VMEXIT_RETURN_RUN_CURRENT or
+///     BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT
+///
+pub fn bf_control_op_vmexit_return(code: bsl::SafeU64) {
+    unsafe {
+        crate::bf_syscall_impl::bf_control_op_vmexit_return_impl(code.get());
+    }
+}
@@ -222,6 +222,45 @@ namespace syscall
 
         bf_debug_op_dump_huge_pool_impl();
     }
+
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel to output the contention
+    ///     and hold time stats of the microkernel's locks to the console
+    ///     device the microkernel is currently using for debugging. These
+    ///     stats are only recorded if the microkernel was compiled with
+    ///     HYPERVISOR_DEBUG_LOCK_STATS enabled.
+    ///
+    constexpr void
+    bf_debug_op_dump_locks() noexcept
+    {
+        if (bsl::is_constant_evaluated()) {
+            return;
+        }
+
+        bf_debug_op_dump_locks_impl();
+    }
+
+    /// <!-- description -->
+    ///   @brief This syscall tells the microkernel to output the VMExit
+    ///     stats. For each exit reason seen on a specific physical
+    ///     processor, the stats hold the number of VMExits, the total
+    ///     number of cycles from VMExit to VMEntry and a log2 histogram
+    ///     of those cycles.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param ppid The PPID of the PP to dump the stats from
+    ///
+    constexpr void
+    bf_debug_op_dump_vmexit_stats(bsl::safe_u16 const &ppid) noexcept
+    {
+        bsl::expects(ppid.is_valid_and_checked());
+
+        if (bsl::is_constant_evaluated()) {
+            return;
+        }
+
+        bf_debug_op_dump_vmexit_stats_impl(ppid.get());
+    }
 }
 
 #endif
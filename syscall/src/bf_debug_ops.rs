@@ -154,3 +154,32 @@ pub fn bf_debug_op_dump_huge_pool() {
         crate::bf_debug_op_dump_huge_pool_impl();
     }
 }
+
+/// <!-- description -->
+///   @brief This syscall tells the microkernel to output the contention
+///     and hold time stats of the microkernel's locks to the console
+///     device the microkernel is currently using for debugging. These
+///     stats are only recorded if the microkernel was compiled with
+///     HYPERVISOR_DEBUG_LOCK_STATS enabled.
+///
+pub fn bf_debug_op_dump_locks() {
+    unsafe {
+        crate::bf_debug_op_dump_locks_impl();
+    }
+}
+
+/// <!-- description -->
+///   @brief This syscall tells the microkernel to output the VMExit
+///     stats. For each exit reason seen on a specific physical
+///     processor, the stats hold the number of VMExits, the total
+///     number of cycles from VMExit to VMEntry and a log2 histogram
+///     of those cycles.
+///
+/// <!-- inputs/outputs -->
+///   @param ppid The PPID of the PP to dump the stats from
+///
+pub fn bf_debug_op_dump_vmexit_stats(ppid: bsl::SafeU16) {
+    unsafe {
+        crate::bf_debug_op_dump_vmexit_stats_impl(ppid.get());
+    }
+}
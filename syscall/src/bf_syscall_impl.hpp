@@ -27,6 +27,8 @@
 
 #include "bf_reg_t.hpp"
 
+#include <bf_types.hpp>
+
 #include <bsl/char_type.hpp>
 #include <bsl/cstdint.hpp>
 
@@ -348,6 +350,16 @@ namespace syscall
     ///
     extern "C" [[nodiscard]] auto bf_tls_online_pps_impl() noexcept -> bsl::uint16;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param idx n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_tls_exit_info_impl(bsl::uint64 const idx) noexcept
+        -> bsl::uint64;
+
     // -------------------------------------------------------------------------
     // bf_control_ops
     // -------------------------------------------------------------------------
@@ -367,6 +379,14 @@ namespace syscall
     ///
     extern "C" void bf_control_op_again_impl() noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_control_op_vmexit_return.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    extern "C" void bf_control_op_vmexit_return_impl(bsl::uint64 const reg0_in) noexcept;
+
     // -------------------------------------------------------------------------
     // bf_handle_ops
     // -------------------------------------------------------------------------
@@ -475,6 +495,19 @@ namespace syscall
     ///
     extern "C" void bf_debug_op_dump_huge_pool_impl() noexcept;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_locks.
+    ///
+    extern "C" void bf_debug_op_dump_locks_impl() noexcept;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_vmexit_stats.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    extern "C" void bf_debug_op_dump_vmexit_stats_impl(bsl::uint16 const reg0_in) noexcept;
+
     // -------------------------------------------------------------------------
     // bf_callback_ops
     // -------------------------------------------------------------------------
@@ -515,6 +548,24 @@ namespace syscall
         bsl::uint64 const reg0_in, bf_callback_handler_fail_t const pmut_reg1_in) noexcept
         -> bsl::uint64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_callback_op_register_fast_path.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @param reg4_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_callback_op_register_fast_path_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint64 const reg1_in,
+        bsl::uint64 const reg2_in,
+        bsl::uint64 const reg3_in,
+        bsl::uint64 const reg4_in) noexcept -> bsl::uint64;
+
     // -------------------------------------------------------------------------
     // bf_vm_ops
     // -------------------------------------------------------------------------
@@ -703,6 +754,54 @@ namespace syscall
         bf_reg_t const reg2_in,
         bsl::uint64 const reg3_in) noexcept -> bsl::uint64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_read_many.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param pmut_reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vs_op_read_many_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bf_reg_vals_t *const pmut_reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_write_many.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vs_op_write_many_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bf_reg_vals_t const *const reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_set_exit_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vs_op_set_exit_info_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bf_reg_vals_t const *const reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_vs_op_run.
     ///
@@ -837,6 +936,22 @@ namespace syscall
         bsl::uint64 const reg0_in, bsl::uint16 const reg1_in, bsl::uint64 const reg2_in) noexcept
         -> bsl::uint64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_tlb_flush_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto bf_vs_op_tlb_flush_range_impl(
+        bsl::uint64 const reg0_in,
+        bsl::uint16 const reg1_in,
+        bsl::uint64 const reg2_in,
+        bsl::uint64 const reg3_in) noexcept -> bsl::uint64;
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_ops
     // -------------------------------------------------------------------------
@@ -901,6 +1016,18 @@ namespace syscall
         bsl::uint64 const reg1_in,
         void **const pmut_reg0_out,
         bsl::uint64 *const pmut_reg1_out) noexcept -> bsl::uint64;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_huge.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    extern "C" [[nodiscard]] auto
+    bf_mem_op_free_huge_impl(bsl::uint64 const reg0_in, void *const reg1_in) noexcept
+        -> bsl::uint64;
 }
 
 #endif
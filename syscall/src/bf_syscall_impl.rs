@@ -316,6 +316,15 @@ extern "C" {
     ///
     pub fn bf_tls_online_pps_impl() -> u16;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_tls_exit_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param idx n/a
+    ///   @return n/a
+    ///
+    pub fn bf_tls_exit_info_impl(idx: u64) -> u64;
+
     // -------------------------------------------------------------------------
     // bf_control_ops
     // -------------------------------------------------------------------------
@@ -335,6 +344,14 @@ extern "C" {
     ///
     pub fn bf_control_op_again_impl();
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_control_op_vmexit_return.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    pub fn bf_control_op_vmexit_return_impl(reg0_in: u64);
+
     // -------------------------------------------------------------------------
     // bf_handle_ops
     // -------------------------------------------------------------------------
@@ -442,6 +459,19 @@ extern "C" {
     ///
     pub fn bf_debug_op_dump_huge_pool_impl();
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_locks.
+    ///
+    pub fn bf_debug_op_dump_locks_impl();
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_debug_op_dump_vmexit_stats.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///
+    pub fn bf_debug_op_dump_vmexit_stats_impl(reg0_in: u16);
+
     // -------------------------------------------------------------------------
     // bf_callback_ops
     // -------------------------------------------------------------------------
@@ -476,6 +506,25 @@ extern "C" {
     ///
     pub fn bf_callback_op_register_fail_impl(reg0_in: u64, reg1_in: bsl::CPtrT) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_callback_op_register_fast_path.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @param reg4_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_callback_op_register_fast_path_impl(
+        reg0_in: u64,
+        reg1_in: u64,
+        reg2_in: u64,
+        reg3_in: u64,
+        reg4_in: u64,
+    ) -> u64;
+
     // -------------------------------------------------------------------------
     // bf_vm_ops
     // -------------------------------------------------------------------------
@@ -643,6 +692,57 @@ extern "C" {
     ///
     pub fn bf_vs_op_write_impl(reg0_in: u64, reg1_in: u16, reg2_in: u64, reg3_in: u64) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_read_many.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_vs_op_read_many_impl(
+        reg0_in: u64,
+        reg1_in: u16,
+        reg2_in: *mut crate::BfRegValsT,
+        reg3_in: u64,
+    ) -> u64;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_write_many.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_vs_op_write_many_impl(
+        reg0_in: u64,
+        reg1_in: u16,
+        reg2_in: *const crate::BfRegValsT,
+        reg3_in: u64,
+    ) -> u64;
+
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_set_exit_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_vs_op_set_exit_info_impl(
+        reg0_in: u64,
+        reg1_in: u16,
+        reg2_in: *const crate::BfRegValsT,
+        reg3_in: u64,
+    ) -> u64;
+
     /// <!-- description -->
     ///   @brief Implements the ABI for bf_vs_op_run.
     ///
@@ -761,6 +861,23 @@ extern "C" {
     ///
     pub fn bf_vs_op_tlb_flush_impl(reg0_in: u64, reg1_in: u16, reg2_in: u64) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_vs_op_tlb_flush_range.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @param reg2_in n/a
+    ///   @param reg3_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_vs_op_tlb_flush_range_impl(
+        reg0_in: u64,
+        reg1_in: u16,
+        reg2_in: u64,
+        reg3_in: u64,
+    ) -> u64;
+
     // -------------------------------------------------------------------------
     // bf_intrinsic_ops
     // -------------------------------------------------------------------------
@@ -823,4 +940,14 @@ extern "C" {
         pmut_reg1_out: *mut u64,
     ) -> u64;
 
+    /// <!-- description -->
+    ///   @brief Implements the ABI for bf_mem_op_free_huge.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param reg0_in n/a
+    ///   @param reg1_in n/a
+    ///   @return n/a
+    ///
+    pub fn bf_mem_op_free_huge_impl(reg0_in: u64, reg1_in: bsl::CPtrT) -> u64;
+
 }
@@ -39,6 +39,7 @@
 #include <bsl/expects.hpp>
 #include <bsl/finally.hpp>
 #include <bsl/is_pod.hpp>
+#include <bsl/safe_idx.hpp>
 #include <bsl/safe_integral.hpp>
 #include <bsl/unlikely.hpp>
 
@@ -619,6 +620,22 @@ namespace syscall
             return bsl::to_u16(bf_tls_online_pps_impl());
         }
 
+        /// <!-- description -->
+        ///   @brief Returns the idx'th value of tls.exit_info. The values
+        ///     are published by the microkernel on every VM exit, in the
+        ///     order the bf_reg_t were given to bf_vs_op_set_exit_info.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param idx the index of the value to return
+        ///   @return Returns the idx'th value of tls.exit_info
+        ///
+        [[nodiscard]] static constexpr auto
+        bf_tls_exit_info(bsl::safe_idx const &idx) noexcept -> bsl::safe_u64
+        {
+            bsl::expects(bsl::to_u64(idx) < BF_MAX_EXIT_INFO);
+            return bsl::to_u64(bf_tls_exit_info_impl(bsl::to_u64(idx).get()));
+        }
+
         /// <!-- description -->
         ///   @brief Returns true if the active VM is the
         ///     root VM. Returns false otherwise.
@@ -682,6 +699,53 @@ namespace syscall
             return vsid < bf_tls_online_pps();
         }
 
+        // ---------------------------------------------------------------------
+        // bf_callback_ops
+        // ---------------------------------------------------------------------
+
+        /// <!-- description -->
+        ///   @brief Registers a fast path rule with the microkernel for the
+        ///     PP this syscall is executed on. VMExits that match a fast path
+        ///     rule are handled by the microkernel without calling the
+        ///     extension's VMExit handler. See the Microkernel Syscall
+        ///     Specification for the meaning of key, val0 and val1 for each
+        ///     kind of rule.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param kind the kind of rule to register (BF_FAST_PATH_xxx)
+        ///   @param key the CPUID leaf/subleaf, MSR or exit reason to match
+        ///   @param val0 the first value associated with the rule
+        ///   @param val1 the second value associated with the rule
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_callback_op_register_fast_path(
+            bsl::safe_u64 const &kind,
+            bsl::safe_u64 const &key,
+            bsl::safe_u64 const &val0,
+            bsl::safe_u64 const &val1) noexcept -> bsl::errc_type
+        {
+            bsl::expects(kind.is_valid_and_checked());
+            bsl::expects(kind <= BF_FAST_PATH_ADVANCE_IP);
+            bsl::expects(key.is_valid_and_checked());
+            bsl::expects(val0.is_valid_and_checked());
+            bsl::expects(val1.is_valid_and_checked());
+
+            bf_status_t const ret{bf_callback_op_register_fast_path_impl(
+                m_hndl.get(), kind.get(), key.get(), val0.get(), val1.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_callback_op_register_fast_path failed with status "    // --
+                             << bsl::hex(ret)                                              // --
+                             << bsl::endl                                                  // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // bf_vm_ops
         // ---------------------------------------------------------------------
@@ -872,7 +936,11 @@ namespace syscall
         ///     which means it can be safely used on all direct mapped
         ///     addresses. The downside of using this function is that it can
         ///     be a lot slower than bf_vm_op_unmap_direct, especially on
-        ///     systems with a lot of PPs.
+        ///     systems with a lot of PPs. If another PP does not invalidate
+        ///     the address in time, the microkernel returns
+        ///     BF_STATUS_FAILURE_RETRY and this function fails. The address is
+        ///     still unmapped, but the memory behind it must not be reused
+        ///     until a call to this function with the same address succeeds.
         ///
         /// <!-- inputs/outputs -->
         ///   @tparam T the type of pointer to return. Must be a POD type and
@@ -1224,6 +1292,137 @@ namespace syscall
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Reads many CPU registers from the VS using a single
+        ///     syscall. regs must point to a page that was allocated using
+        ///     bf_mem_op_alloc_page. On input, the reg field of the first
+        ///     num entries of regs define which bf_reg_t to read. On
+        ///     success, the val field of each of these entries contains the
+        ///     value that was read. Note that the bf_reg_t is architecture
+        ///     specific.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to read from
+        ///   @param pmut_regs The page of bf_reg_t/value pairs to read
+        ///   @param num The number of pairs in pmut_regs to read
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_read_many(
+            bsl::safe_u16 const &vsid,
+            bf_reg_vals_t *const pmut_regs,
+            bsl::safe_u64 const &num) const noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(nullptr != pmut_regs);
+            bsl::expects(num.is_valid_and_checked());
+            bsl::expects(num.is_pos());
+            bsl::expects(num <= BF_MAX_REG_VALS);
+
+            bf_status_t const ret{
+                bf_vs_op_read_many_impl(m_hndl.get(), vsid.get(), pmut_regs, num.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vs_op_read_many failed with status "    // --
+                             << bsl::hex(ret)                               // --
+                             << bsl::endl                                   // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Writes to many CPU registers in the VS using a single
+        ///     syscall. regs must point to a page that was allocated using
+        ///     bf_mem_op_alloc_page. The first num entries of regs define
+        ///     which bf_reg_t to write to, and the value to write. The
+        ///     entries are written in order, and if an entry cannot be
+        ///     written, the remaining entries are not written. Note that
+        ///     the bf_reg_t is architecture specific.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to write to
+        ///   @param regs The page of bf_reg_t/value pairs to write
+        ///   @param num The number of pairs in regs to write
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_write_many(
+            bsl::safe_u16 const &vsid,
+            bf_reg_vals_t const *const regs,
+            bsl::safe_u64 const &num) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(nullptr != regs);
+            bsl::expects(num.is_valid_and_checked());
+            bsl::expects(num.is_pos());
+            bsl::expects(num <= BF_MAX_REG_VALS);
+
+            bf_status_t const ret{
+                bf_vs_op_write_many_impl(m_hndl.get(), vsid.get(), regs, num.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vs_op_write_many failed with status "    // --
+                             << bsl::hex(ret)                                // --
+                             << bsl::endl                                    // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
+        /// <!-- description -->
+        ///   @brief Tells the microkernel which registers to publish into
+        ///     the extension's TLS block (see bf_tls_exit_info) every time
+        ///     the VS exits. regs must point to a page that was allocated
+        ///     using bf_mem_op_alloc_page, and only the bf_reg_t of the
+        ///     first num entries are used (the values are ignored). If num
+        ///     is 0, the microkernel stops publishing exit information for
+        ///     this VS. Note that the bf_reg_t is architecture specific.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to configure
+        ///   @param regs The page of bf_reg_t to publish on every VM exit
+        ///   @param num The number of bf_reg_t in regs to publish
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_set_exit_info(
+            bsl::safe_u16 const &vsid,
+            bf_reg_vals_t const *const regs,
+            bsl::safe_u64 const &num) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(nullptr != regs);
+            bsl::expects(num.is_valid_and_checked());
+            bsl::expects(num <= BF_MAX_EXIT_INFO);
+
+            bf_status_t const ret{
+                bf_vs_op_set_exit_info_impl(m_hndl.get(), vsid.get(), regs, num.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vs_op_set_exit_info failed with status "    // --
+                             << bsl::hex(ret)                                   // --
+                             << bsl::endl                                       // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Executes a VS given the ID of the VM, VP and VS to
         ///     execute. The VS must be assigned to the provided VP and the
@@ -1577,6 +1776,49 @@ namespace syscall
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Given the ID of a VS, invalidates the TLB entries for
+        ///     num_pages pages starting at the provided GLA on the PP that
+        ///     this is executed on. The microkernel is free to flush every
+        ///     TLB entry associated with the VS instead if the range is
+        ///     large.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param vsid The ID of the VS to invalidate
+        ///   @param gla The GLA of the first page to invalidate
+        ///   @param num_pages The number of pages to invalidate
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_vs_op_tlb_flush_range(
+            bsl::safe_u16 const &vsid,
+            bsl::safe_u64 const &gla,
+            bsl::safe_u64 const &num_pages) noexcept -> bsl::errc_type
+        {
+            bsl::expects(vsid.is_valid_and_checked());
+            bsl::expects(vsid != BF_INVALID_ID);
+            bsl::expects(bsl::to_umx(vsid) < HYPERVISOR_MAX_VSS);
+            bsl::expects(gla.is_valid_and_checked());
+            bsl::expects(gla.is_pos());
+            bsl::expects(bf_is_page_aligned(gla));
+            bsl::expects(num_pages.is_valid_and_checked());
+            bsl::expects(num_pages.is_pos());
+
+            bf_status_t const ret{bf_vs_op_tlb_flush_range_impl(
+                m_hndl.get(), vsid.get(), gla.get(), num_pages.get())};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_vs_op_tlb_flush_range failed with status "    // --
+                             << bsl::hex(ret)                                     // --
+                             << bsl::endl                                         // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -1789,6 +2031,35 @@ namespace syscall
             bsl::safe_u64 mut_ignored{};
             return this->bf_mem_op_alloc_huge<T>(size, mut_ignored);
         }
+
+        /// <!-- description -->
+        ///   @brief bf_mem_op_free_huge frees memory previously allocated
+        ///     by bf_mem_op_alloc_huge. Once this returns, the memory is no
+        ///     longer mapped into the extension on any PP, and must not be
+        ///     used.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param pmut_ptr the pointer returned by bf_mem_op_alloc_huge
+        ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+        ///     otherwise
+        ///
+        [[nodiscard]] constexpr auto
+        bf_mem_op_free_huge(void *const pmut_ptr) noexcept -> bsl::errc_type
+        {
+            bsl::expects(nullptr != pmut_ptr);
+
+            bf_status_t const ret{bf_mem_op_free_huge_impl(m_hndl.get(), pmut_ptr)};
+            if (bsl::unlikely(ret != BF_STATUS_SUCCESS)) {
+                bsl::error() << "bf_mem_op_free_huge failed with status "    // --
+                             << bsl::hex(ret)                                // --
+                             << bsl::endl                                    // --
+                             << bsl::here();
+
+                return bsl::errc_failure;
+            }
+
+            return bsl::errc_success;
+        }
     };
 }
 
@@ -607,6 +607,22 @@ impl BfSyscallT {
         }
     }
 
+    /// <!-- description -->
+    ///   @brief Returns the idx'th value of tls.exit_info. The values
+    ///     are published by the microkernel on every VM exit, in the
+    ///     order the bf_reg_t were given to bf_vs_op_set_exit_info.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param idx the index of the value to return
+    ///   @return Returns the idx'th value of tls.exit_info
+    ///
+    pub fn bf_tls_exit_info(idx: bsl::SafeU64) -> bsl::SafeU64 {
+        bsl::expects(crate::BF_MAX_EXIT_INFO > idx);
+        unsafe {
+            return bsl::to_u64(crate::bf_tls_exit_info_impl(idx.get()));
+        }
+    }
+
     /// <!-- description -->
     ///   @brief Returns true if the active VM is the
     ///     root VM. Returns false otherwise.
@@ -668,6 +684,63 @@ impl BfSyscallT {
         }
     }
 
+    // ---------------------------------------------------------------------
+    // bf_callback_ops
+    // ---------------------------------------------------------------------
+
+    /// <!-- description -->
+    ///   @brief Registers a fast path rule with the microkernel for the
+    ///     PP this syscall is executed on. VMExits that match a fast path
+    ///     rule are handled by the microkernel without calling the
+    ///     extension's VMExit handler. See the Microkernel Syscall
+    ///     Specification for the meaning of key, val0 and val1 for each
+    ///     kind of rule.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param kind the kind of rule to register (BF_FAST_PATH_xxx)
+    ///   @param key the CPUID leaf/subleaf, MSR or exit reason to match
+    ///   @param val0 the first value associated with the rule
+    ///   @param val1 the second value associated with the rule
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_callback_op_register_fast_path(
+        &self,
+        kind: bsl::SafeU64,
+        key: bsl::SafeU64,
+        val0: bsl::SafeU64,
+        val1: bsl::SafeU64,
+    ) -> bsl::ErrcType {
+        let ret: u64;
+
+        bsl::expects(kind.is_valid_and_checked());
+        bsl::expects(crate::BF_FAST_PATH_ADVANCE_IP >= kind);
+        bsl::expects(key.is_valid_and_checked());
+        bsl::expects(val0.is_valid_and_checked());
+        bsl::expects(val1.is_valid_and_checked());
+
+        unsafe {
+            ret = crate::bf_callback_op_register_fast_path_impl(
+                self.m_hndl.get(),
+                kind.get(),
+                key.get(),
+                val0.get(),
+                val1.get(),
+            );
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_callback_op_register_fast_path failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
+
     // ---------------------------------------------------------------------
     // bf_vm_ops
     // ---------------------------------------------------------------------
@@ -851,7 +924,11 @@ impl BfSyscallT {
     ///     which means it can be safely used on all direct mapped
     ///     addresses. The downside of using this function is that it can
     ///     be a lot slower than bf_vm_op_unmap_direct, especially on
-    ///     systems with a lot of PPs.
+    ///     systems with a lot of PPs. If another PP does not invalidate
+    ///     the address in time, the microkernel returns
+    ///     BF_STATUS_FAILURE_RETRY and this function fails. The address is
+    ///     still unmapped, but the memory behind it must not be reused
+    ///     until a call to this function with the same address succeeds.
     ///
     /// <!-- inputs/outputs -->
     ///   @param vmid The ID of the VM to unmap the virtual address from
@@ -1213,6 +1290,150 @@ impl BfSyscallT {
         return bsl::errc_success;
     }
 
+    /// <!-- description -->
+    ///   @brief Reads many CPU registers from the VS using a single
+    ///     syscall. regs must point to a page that was allocated using
+    ///     bf_mem_op_alloc_page. On input, the reg field of the first
+    ///     num entries of regs define which bf_reg_t to read. On
+    ///     success, the val field of each of these entries contains the
+    ///     value that was read. Note that the bf_reg_t is architecture
+    ///     specific.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param vsid The ID of the VS to read from
+    ///   @param regs The page of bf_reg_t/value pairs to read
+    ///   @param num The number of pairs in regs to read
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_vs_op_read_many(
+        &self,
+        vsid: bsl::SafeU16,
+        regs: *mut crate::BfRegValsT,
+        num: bsl::SafeU64,
+    ) -> bsl::ErrcType {
+        let ret: u64;
+
+        bsl::expects(vsid.is_valid_and_checked());
+        bsl::expects(crate::BF_INVALID_ID != vsid);
+        bsl::expects(crate::HYPERVISOR_MAX_VSS > bsl::to_umx(vsid));
+        bsl::expects(!regs.is_null());
+        bsl::expects(num.is_valid_and_checked());
+        bsl::expects(num.is_pos());
+        bsl::expects(crate::BF_MAX_REG_VALS >= num);
+
+        unsafe {
+            ret = crate::bf_vs_op_read_many_impl(self.m_hndl.get(), vsid.get(), regs, num.get());
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_vs_op_read_many failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Writes to many CPU registers in the VS using a single
+    ///     syscall. regs must point to a page that was allocated using
+    ///     bf_mem_op_alloc_page. The first num entries of regs define
+    ///     which bf_reg_t to write to, and the value to write. The
+    ///     entries are written in order, and if an entry cannot be
+    ///     written, the remaining entries are not written. Note that
+    ///     the bf_reg_t is architecture specific.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param vsid The ID of the VS to write to
+    ///   @param regs The page of bf_reg_t/value pairs to write
+    ///   @param num The number of pairs in regs to write
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_vs_op_write_many(
+        &self,
+        vsid: bsl::SafeU16,
+        regs: *const crate::BfRegValsT,
+        num: bsl::SafeU64,
+    ) -> bsl::ErrcType {
+        let ret: u64;
+
+        bsl::expects(vsid.is_valid_and_checked());
+        bsl::expects(crate::BF_INVALID_ID != vsid);
+        bsl::expects(crate::HYPERVISOR_MAX_VSS > bsl::to_umx(vsid));
+        bsl::expects(!regs.is_null());
+        bsl::expects(num.is_valid_and_checked());
+        bsl::expects(num.is_pos());
+        bsl::expects(crate::BF_MAX_REG_VALS >= num);
+
+        unsafe {
+            ret = crate::bf_vs_op_write_many_impl(self.m_hndl.get(), vsid.get(), regs, num.get());
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_vs_op_write_many failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
+
+    /// <!-- description -->
+    ///   @brief Tells the microkernel which registers to publish into
+    ///     the extension's TLS block (see bf_tls_exit_info) every time
+    ///     the VS exits. regs must point to a page that was allocated
+    ///     using bf_mem_op_alloc_page, and only the bf_reg_t of the
+    ///     first num entries are used (the values are ignored). If num
+    ///     is 0, the microkernel stops publishing exit information for
+    ///     this VS. Note that the bf_reg_t is architecture specific.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param vsid The ID of the VS to configure
+    ///   @param regs The page of bf_reg_t to publish on every VM exit
+    ///   @param num The number of bf_reg_t in regs to publish
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_vs_op_set_exit_info(
+        &self,
+        vsid: bsl::SafeU16,
+        regs: *const crate::BfRegValsT,
+        num: bsl::SafeU64,
+    ) -> bsl::ErrcType {
+        let ret: u64;
+
+        bsl::expects(vsid.is_valid_and_checked());
+        bsl::expects(crate::BF_INVALID_ID != vsid);
+        bsl::expects(crate::HYPERVISOR_MAX_VSS > bsl::to_umx(vsid));
+        bsl::expects(!regs.is_null());
+        bsl::expects(num.is_valid_and_checked());
+        bsl::expects(crate::BF_MAX_EXIT_INFO >= num);
+
+        unsafe {
+            ret =
+                crate::bf_vs_op_set_exit_info_impl(self.m_hndl.get(), vsid.get(), regs, num.get());
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_vs_op_set_exit_info failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
+
     /// <!-- description -->
     ///   @brief Executes a VS given the ID of the VM, VP and VS to execute.
     ///     The VS must be assigned to the provided VP and the provided VP must
@@ -1610,6 +1831,58 @@ impl BfSyscallT {
         return bsl::errc_success;
     }
 
+    /// <!-- description -->
+    ///   @brief Given the ID of a VS, invalidates the TLB entries for
+    ///     num_pages pages starting at the provided GLA on the PP that
+    ///     this is executed on. The microkernel is free to flush every
+    ///     TLB entry associated with the VS instead if the range is
+    ///     large.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param vsid The ID of the VS to invalidate
+    ///   @param gla The GLA of the first page to invalidate
+    ///   @param num_pages The number of pages to invalidate
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_vs_op_tlb_flush_range(
+        &self,
+        vsid: bsl::SafeU16,
+        gla: bsl::SafeU64,
+        num_pages: bsl::SafeU64,
+    ) -> bsl::ErrcType {
+        let ret: u64;
+
+        bsl::expects(vsid.is_valid_and_checked());
+        bsl::expects(crate::BF_INVALID_ID != vsid);
+        bsl::expects(crate::HYPERVISOR_MAX_VSS > bsl::to_umx(vsid));
+        bsl::expects(gla.is_valid_and_checked());
+        bsl::expects(gla.is_pos());
+        bsl::expects(crate::bf_is_page_aligned(gla));
+        bsl::expects(num_pages.is_valid_and_checked());
+        bsl::expects(num_pages.is_pos());
+
+        unsafe {
+            ret = crate::bf_vs_op_tlb_flush_range_impl(
+                self.m_hndl.get(),
+                vsid.get(),
+                gla.get(),
+                num_pages.get(),
+            );
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_vs_op_tlb_flush_range failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
+
     // ---------------------------------------------------------------------
     // bf_intrinsic_ops
     // ---------------------------------------------------------------------
@@ -1776,4 +2049,36 @@ impl BfSyscallT {
 
         return ptr as *mut T;
     }
+
+    /// <!-- description -->
+    ///   @brief bf_mem_op_free_huge frees memory previously allocated
+    ///     by bf_mem_op_alloc_huge. Once this returns, the memory is no
+    ///     longer mapped into the extension on any PP, and must not be
+    ///     used.
+    ///
+    /// <!-- inputs/outputs -->
+    ///   @param pmut_ptr the pointer returned by bf_mem_op_alloc_huge
+    ///   @return Returns bsl::errc_success on success, bsl::errc_failure
+    ///     otherwise
+    ///
+    pub fn bf_mem_op_free_huge(&self, pmut_ptr: bsl::CPtrT) -> bsl::ErrcType {
+        let ret: u64;
+
+        bsl::expects(!pmut_ptr.is_null());
+
+        unsafe {
+            ret = crate::bf_mem_op_free_huge_impl(self.m_hndl.get(), pmut_ptr);
+        }
+        if crate::BF_STATUS_SUCCESS != ret {
+            error!(
+                "bf_mem_op_free_huge failed with status {:#018x}\n{}",
+                ret,
+                bsl::here()
+            );
+
+            return bsl::errc_failure;
+        }
+
+        return bsl::errc_success;
+    }
 }
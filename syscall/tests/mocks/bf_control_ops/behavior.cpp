@@ -24,6 +24,8 @@
 
 #include "../../../mocks/bf_control_ops.hpp"
 
+#include <bf_constants.hpp>
+
 #include <bsl/ut.hpp>
 
 namespace syscall
@@ -76,6 +78,22 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_control_op_vmexit_return"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                g_mut_bf_control_op_vmexit_return_impl_executed = {};
+                g_mut_bf_control_op_vmexit_return_impl_code = {};
+                bsl::ut_when{} = []() noexcept {
+                    bf_control_op_vmexit_return(BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT);
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_control_op_vmexit_return_impl_executed);
+                        bsl::ut_check(
+                            BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT ==
+                            g_mut_bf_control_op_vmexit_return_impl_code);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
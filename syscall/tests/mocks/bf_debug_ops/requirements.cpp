@@ -51,6 +51,8 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_debug_op_dump_ext({})));
             static_assert(noexcept(syscall::bf_debug_op_dump_page_pool()));
             static_assert(noexcept(syscall::bf_debug_op_dump_huge_pool()));
+            static_assert(noexcept(syscall::bf_debug_op_dump_locks()));
+            static_assert(noexcept(syscall::bf_debug_op_dump_vmexit_stats({})));
         };
     };
 
@@ -341,6 +341,18 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_tls_exit_info_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_tls_exit_info") = ANSWER64;
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(ANSWER64 == bf_tls_exit_info_impl({}));
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_control_op_exit_impl"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -377,6 +389,23 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_control_op_vmexit_return_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_bf_control_op_vmexit_return_impl_executed = {};
+                    g_mut_bf_control_op_vmexit_return_impl_code = {};
+                    bf_control_op_vmexit_return_impl(
+                        BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT.get());
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_control_op_vmexit_return_impl_executed);
+                        bsl::ut_check(
+                            BF_VMEXIT_RETURN_ADVANCE_IP_AND_RUN_CURRENT ==
+                            g_mut_bf_control_op_vmexit_return_impl_code);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_handle_op_open_handle_impl invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -584,6 +613,30 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_debug_op_dump_locks_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_bf_debug_op_dump_locks_impl_executed = {};
+                    bf_debug_op_dump_locks_impl();
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_debug_op_dump_locks_impl_executed);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_debug_op_dump_vmexit_stats_impl"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_bf_debug_op_dump_vmexit_stats_impl_executed = {};
+                    bf_debug_op_dump_vmexit_stats_impl({});
+                    bsl::ut_then{} = []() noexcept {
+                        bsl::ut_check(g_mut_bf_debug_op_dump_vmexit_stats_impl_executed);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_callback_op_register_bootstrap_impl failure"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -667,6 +720,36 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_callback_op_register_fast_path_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_callback_op_register_fast_path_impl") =
+                        BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{
+                            bf_callback_op_register_fast_path_impl({}, {}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_callback_op_register_fast_path_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{
+                            bf_callback_op_register_fast_path_impl({}, {}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vm_op_create_vm_impl invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -1115,6 +1198,164 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_read_many_impl invalid arg2"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vs_op_read_many_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_read_many_impl invalid arg3"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_reg_vals_t mut_regs{};
+                constexpr auto num{(BF_MAX_REG_VALS + bsl::safe_u64::magic_1()).checked()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vs_op_read_many_impl({}, {}, &mut_regs, num.get())};
+                        bsl::ut_check(BF_STATUS_INVALID_INPUT_REG3 == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_read_many_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_reg_vals_t mut_regs{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vs_op_read_many_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    g_mut_data.at("bf_vs_op_read_many_impl_val") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_vs_op_read_many_impl(
+                            {}, {}, &mut_regs, BF_MAX_REG_VALS.get())};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                        bsl::ut_check(bsl::to_u64(mut_regs.front().val).is_zero());
+                        bsl::ut_check(bsl::to_u64(mut_regs.back().val).is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_read_many_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_reg_vals_t mut_regs{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_vs_op_read_many_impl_val") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{bf_vs_op_read_many_impl(
+                            {}, {}, &mut_regs, BF_MAX_REG_VALS.get())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(ANSWER64 == bsl::to_u64(mut_regs.front().val));
+                        bsl::ut_check(ANSWER64 == bsl::to_u64(mut_regs.back().val));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_write_many_impl invalid arg2"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vs_op_write_many_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_write_many_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_reg_vals_t const regs{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vs_op_write_many_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vs_op_write_many_impl({}, {}, &regs, ANSWER64.get())};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                        bsl::ut_check(g_mut_data.at("bf_vs_op_write_many_impl").is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_write_many_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_reg_vals_t const regs{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vs_op_write_many_impl({}, {}, &regs, ANSWER64.get())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(g_mut_data.at("bf_vs_op_write_many_impl") == ANSWER64);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_set_exit_info_impl invalid arg2"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vs_op_set_exit_info_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_set_exit_info_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_reg_vals_t const regs{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vs_op_set_exit_info_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vs_op_set_exit_info_impl({}, {}, &regs, ANSWER64.get())};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                        bsl::ut_check(g_mut_data.at("bf_vs_op_set_exit_info_impl").is_zero());
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_set_exit_info_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_reg_vals_t const regs{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bf_status_t const ret{
+                            bf_vs_op_set_exit_info_impl({}, {}, &regs, ANSWER64.get())};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                        bsl::ut_check(g_mut_data.at("bf_vs_op_set_exit_info_impl") == ANSWER64);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vs_op_run_impl failure"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -1389,6 +1630,33 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_tlb_flush_range_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vs_op_tlb_flush_range_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vs_op_tlb_flush_range_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_tlb_flush_range_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_vs_op_tlb_flush_range_impl({}, {}, {}, {})};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_intrinsic_op_rdmsr_impl invalid arg0"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bsl::ut_when{} = []() noexcept {
@@ -1610,6 +1878,33 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_huge_impl failure"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_mem_op_free_huge_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_mem_op_free_huge_impl({}, {})};
+                        bsl::ut_check(BF_STATUS_FAILURE_UNKNOWN == ret);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_huge_impl success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bsl::ut_when{} = []() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = []() noexcept {
+                        bf_status_t const ret{bf_mem_op_free_huge_impl({}, {})};
+                        bsl::ut_check(BF_STATUS_SUCCESS == ret);
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -80,9 +80,11 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_tls_vsid_impl()));
             static_assert(noexcept(syscall::bf_tls_ppid_impl()));
             static_assert(noexcept(syscall::bf_tls_online_pps_impl()));
+            static_assert(noexcept(syscall::bf_tls_exit_info_impl({})));
             static_assert(noexcept(syscall::bf_control_op_exit_impl()));
             static_assert(noexcept(syscall::bf_control_op_wait_impl()));
             static_assert(noexcept(syscall::bf_control_op_again_impl()));
+            static_assert(noexcept(syscall::bf_control_op_vmexit_return_impl({})));
             static_assert(noexcept(syscall::bf_handle_op_open_handle_impl({}, {})));
             static_assert(noexcept(syscall::bf_handle_op_close_handle_impl({})));
             static_assert(noexcept(syscall::bf_debug_op_out_impl({}, {})));
@@ -96,9 +98,13 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_debug_op_dump_ext_impl({})));
             static_assert(noexcept(syscall::bf_debug_op_dump_page_pool_impl()));
             static_assert(noexcept(syscall::bf_debug_op_dump_huge_pool_impl()));
+            static_assert(noexcept(syscall::bf_debug_op_dump_locks_impl()));
+            static_assert(noexcept(syscall::bf_debug_op_dump_vmexit_stats_impl({})));
             static_assert(noexcept(syscall::bf_callback_op_register_bootstrap_impl({}, {})));
             static_assert(noexcept(syscall::bf_callback_op_register_vmexit_impl({}, {})));
             static_assert(noexcept(syscall::bf_callback_op_register_fail_impl({}, {})));
+            static_assert(
+                noexcept(syscall::bf_callback_op_register_fast_path_impl({}, {}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vm_op_create_vm_impl({}, {})));
             static_assert(noexcept(syscall::bf_vm_op_destroy_vm_impl({}, {})));
             static_assert(noexcept(syscall::bf_vm_op_map_direct_impl({}, {}, {}, {})));
@@ -112,6 +118,9 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_vs_op_init_as_root_impl({}, {})));
             static_assert(noexcept(syscall::bf_vs_op_read_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vs_op_write_impl({}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_vs_op_read_many_impl({}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_vs_op_write_many_impl({}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_vs_op_set_exit_info_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vs_op_run_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vs_op_run_current_impl({})));
             static_assert(noexcept(syscall::bf_vs_op_advance_ip_and_run_impl({}, {}, {}, {})));
@@ -123,10 +132,12 @@ main() noexcept -> bsl::exit_code
             static_assert(
                 noexcept(syscall::bf_vs_op_advance_ip_and_set_active_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_vs_op_tlb_flush_impl({}, {}, {})));
+            static_assert(noexcept(syscall::bf_vs_op_tlb_flush_range_impl({}, {}, {}, {})));
             static_assert(noexcept(syscall::bf_intrinsic_op_rdmsr_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_intrinsic_op_wrmsr_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_mem_op_alloc_page_impl({}, {}, {})));
             static_assert(noexcept(syscall::bf_mem_op_alloc_huge_impl({}, {}, {}, {})));
+            static_assert(noexcept(syscall::bf_mem_op_free_huge_impl({}, {})));
         };
     };
 
@@ -577,6 +577,25 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_tls_exit_info/bf_tls_set_exit_info"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                constexpr auto idx{bsl::safe_idx::magic_1()};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_info(idx));
+                        bsl::ut_check(mut_sys.bf_tls_exit_info(idx).is_zero());
+                    };
+
+                    mut_sys.bf_tls_set_exit_info(idx, ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_info(idx) == ANSWER64);
+                        bsl::ut_check(mut_sys.bf_tls_exit_info({}).is_zero());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_tls_online_pps/bf_tls_set_online_pps"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -665,6 +684,35 @@ namespace syscall
             };
         };
 
+        // ---------------------------------------------------------------------
+        // bf_callback_ops
+        // ---------------------------------------------------------------------
+
+        bsl::ut_scenario{"bf_callback_op_register_fast_path impl fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_callback_op_register_fast_path(
+                        BF_FAST_PATH_RDMSR, ANSWER64, bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_callback_op_register_fast_path(
+                            BF_FAST_PATH_RDMSR, ANSWER64, {}, {}));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_callback_op_register_fast_path success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_sys.bf_callback_op_register_fast_path(
+                        BF_FAST_PATH_RDMSR, ANSWER64, {}, {}));
+                    bsl::ut_check(mut_sys.bf_callback_op_register_fast_path_count().is_pos());
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_vm_ops
         // ---------------------------------------------------------------------
@@ -1037,6 +1085,78 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_read_many bf_vs_op_read fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t mut_arg1{};
+                bsl::safe_u64 const arg2{ANSWER64};
+                bf_reg_t const reg{bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arg1.front().reg = static_cast<bsl::uint64>(reg);
+                    mut_sys.set_bf_vs_op_read(arg0, reg, bsl::safe_u64::failure());
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vs_op_read_many(arg0, &mut_arg1, arg2));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_read_many success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t mut_arg1{};
+                bsl::safe_u64 const arg2{ANSWER64};
+                bf_reg_t const reg{bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arg1.front().reg = static_cast<bsl::uint64>(reg);
+                    mut_sys.set_bf_vs_op_read(arg0, reg, ANSWER64);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vs_op_read_many(arg0, &mut_arg1, arg2));
+                        bsl::ut_check(ANSWER64 == bsl::to_u64(mut_arg1.front().val));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_write_many bf_vs_op_write fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t mut_arg1{};
+                bsl::safe_u64 const arg2{ANSWER64};
+                bf_reg_t const reg{bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arg1.front().reg = static_cast<bsl::uint64>(reg);
+                    mut_arg1.front().val = ANSWER64.get();
+                    mut_sys.set_bf_vs_op_write(arg0, reg, ANSWER64, bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vs_op_write_many(arg0, &mut_arg1, arg2));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_write_many success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t mut_arg1{};
+                bsl::safe_u64 const arg2{ANSWER64};
+                bf_reg_t const reg{bf_reg_t::bf_reg_t_dummy};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_arg1.front().reg = static_cast<bsl::uint64>(reg);
+                    mut_arg1.front().val = ANSWER64.get();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vs_op_write_many(arg0, &mut_arg1, arg2));
+                        bsl::ut_check(mut_sys.bf_vs_op_read(arg0, reg) == ANSWER64);
+                        bsl::ut_check(mut_sys.bf_vs_op_write_count().is_pos());
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vs_op_run bf_vs_op_run_impl fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1164,6 +1284,34 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_set_exit_info fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t const arg1{};
+                bsl::safe_u64 const arg2{BF_MAX_EXIT_INFO};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_vs_op_set_exit_info(arg0, bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vs_op_set_exit_info(arg0, &arg1, arg2));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_set_exit_info success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t const arg1{};
+                bsl::safe_u64 const arg2{BF_MAX_EXIT_INFO};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_sys.bf_vs_op_set_exit_info(arg0, &arg1, arg2));
+                    bsl::ut_check(mut_sys.bf_vs_op_set_exit_info_count().is_pos());
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vs_op_clear bf_vs_op_clear_impl fails"} = []() noexcept {
             bsl::ut_given{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1300,6 +1448,35 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_tlb_flush_range bf_vs_op_tlb_flush_range_impl fails"} =
+            []() noexcept {
+                bsl::ut_given{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bsl::safe_u16 const arg0{};
+                    bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                    bsl::safe_u64 const arg2{bsl::safe_u64::magic_1()};
+                    bsl::ut_when{} = [&]() noexcept {
+                        mut_sys.set_bf_vs_op_tlb_flush_range(arg0, arg1, arg2, bsl::errc_failure);
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(!mut_sys.bf_vs_op_tlb_flush_range(arg0, arg1, arg2));
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vs_op_tlb_flush_range success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                bsl::safe_u64 const arg2{bsl::safe_u64::magic_1()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_sys.bf_vs_op_tlb_flush_range(arg0, arg1, arg2));
+                    bsl::ut_check(mut_sys.bf_vs_op_tlb_flush_range_count().is_pos());
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -1442,6 +1619,30 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_huge bf_mem_op_free_huge_impl fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                page_t mut_page{};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_sys.set_bf_mem_op_free_huge(bsl::errc_failure);
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_free_huge(&mut_page));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_huge success"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                page_t mut_page{};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(mut_sys.bf_mem_op_free_huge(&mut_page));
+                    bsl::ut_check(mut_sys.bf_mem_op_free_huge_count().is_pos());
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
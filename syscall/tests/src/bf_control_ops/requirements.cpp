@@ -44,6 +44,7 @@ main() noexcept -> bsl::exit_code
             static_assert(noexcept(syscall::bf_control_op_exit()));
             static_assert(noexcept(syscall::bf_control_op_wait()));
             static_assert(noexcept(syscall::bf_control_op_again()));
+            static_assert(noexcept(syscall::bf_control_op_vmexit_return({})));
         };
     };
 
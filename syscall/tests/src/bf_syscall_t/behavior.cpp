@@ -585,6 +585,25 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_tls_exit_info"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_data.clear();
+
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_info({}));
+                        bsl::ut_check(mut_sys.bf_tls_exit_info({}).is_zero());
+                    };
+
+                    g_mut_data.at("bf_tls_exit_info") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_tls_exit_info({}) == ANSWER64);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"is_the_active_vm_the_root_vm"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -656,6 +675,40 @@ namespace syscall
             };
         };
 
+        // ---------------------------------------------------------------------
+        // bf_callback_ops
+        // ---------------------------------------------------------------------
+
+        bsl::ut_scenario{"bf_callback_op_register_fast_path impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_callback_op_register_fast_path_impl") =
+                        BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_callback_op_register_fast_path(
+                            BF_FAST_PATH_CPUID, ANSWER64, ANSWER64, ANSWER64));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_callback_op_register_fast_path success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_callback_op_register_fast_path(
+                            BF_FAST_PATH_CPUID, ANSWER64, ANSWER64, ANSWER64));
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_vm_ops
         // ---------------------------------------------------------------------
@@ -1158,6 +1211,110 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_read_many bf_vs_op_read_many_impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t mut_arg1{};
+                bsl::safe_u64 const arg2{ANSWER64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vs_op_read_many_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vs_op_read_many(arg0, &mut_arg1, arg2));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_read_many success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t mut_arg1{};
+                bsl::safe_u64 const arg2{ANSWER64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_data.at("bf_vs_op_read_many_impl_val") = ANSWER64;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vs_op_read_many(arg0, &mut_arg1, arg2));
+                        bsl::ut_check(ANSWER64 == bsl::to_u64(mut_arg1.front().val));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_write_many bf_vs_op_write_many_impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t const arg1{};
+                bsl::safe_u64 const arg2{ANSWER64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    g_mut_errc.at("bf_vs_op_write_many_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_vs_op_write_many(arg0, &arg1, arg2));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_write_many success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t const arg1{};
+                bsl::safe_u64 const arg2{ANSWER64};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vs_op_write_many(arg0, &arg1, arg2));
+                        bsl::ut_check(g_mut_data.at("bf_vs_op_write_many_impl") == arg2);
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_vs_op_set_exit_info bf_vs_op_set_exit_info_impl fails"} =
+            []() noexcept {
+                bsl::ut_given_at_runtime{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bsl::safe_u16 const arg0{};
+                    bf_reg_vals_t const arg1{};
+                    bsl::safe_u64 const arg2{BF_MAX_EXIT_INFO};
+                    bsl::ut_when{} = [&]() noexcept {
+                        g_mut_errc.clear();
+                        g_mut_data.clear();
+                        g_mut_errc.at("bf_vs_op_set_exit_info_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(!mut_sys.bf_vs_op_set_exit_info(arg0, &arg1, arg2));
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vs_op_set_exit_info success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bf_reg_vals_t const arg1{};
+                bsl::safe_u64 const arg2{BF_MAX_EXIT_INFO};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_data.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vs_op_set_exit_info(arg0, &arg1, arg2));
+                        bsl::ut_check(g_mut_data.at("bf_vs_op_set_exit_info_impl") == arg2);
+                    };
+                };
+            };
+        };
+
         bsl::ut_scenario{"bf_vs_op_run bf_vs_op_run_impl fails"} = []() noexcept {
             bsl::ut_given_at_runtime{} = []() noexcept {
                 bf_syscall_t mut_sys{};
@@ -1452,6 +1609,39 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_vs_op_tlb_flush_range bf_vs_op_tlb_flush_range_impl fails"} =
+            []() noexcept {
+                bsl::ut_given_at_runtime{} = []() noexcept {
+                    bf_syscall_t mut_sys{};
+                    bsl::safe_u16 const arg0{};
+                    bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                    bsl::safe_u64 const arg2{bsl::safe_u64::magic_1()};
+                    bsl::ut_when{} = [&]() noexcept {
+                        g_mut_errc.clear();
+                        g_mut_errc.at("bf_vs_op_tlb_flush_range_impl") =
+                            BF_STATUS_FAILURE_UNKNOWN;
+                        bsl::ut_then{} = [&]() noexcept {
+                            bsl::ut_check(!mut_sys.bf_vs_op_tlb_flush_range(arg0, arg1, arg2));
+                        };
+                    };
+                };
+            };
+
+        bsl::ut_scenario{"bf_vs_op_tlb_flush_range success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                bsl::safe_u16 const arg0{};
+                bsl::safe_u64 const arg1{HYPERVISOR_PAGE_SIZE};
+                bsl::safe_u64 const arg2{bsl::safe_u64::magic_1()};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_vs_op_tlb_flush_range(arg0, arg1, arg2));
+                    };
+                };
+            };
+        };
+
         // ---------------------------------------------------------------------
         // bf_intrinsic_ops
         // ---------------------------------------------------------------------
@@ -1606,6 +1796,33 @@ namespace syscall
             };
         };
 
+        bsl::ut_scenario{"bf_mem_op_free_huge bf_mem_op_free_huge_impl fails"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                page_t mut_page{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    g_mut_errc.at("bf_mem_op_free_huge_impl") = BF_STATUS_FAILURE_UNKNOWN;
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_sys.bf_mem_op_free_huge(&mut_page));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"bf_mem_op_free_huge success"} = []() noexcept {
+            bsl::ut_given_at_runtime{} = []() noexcept {
+                bf_syscall_t mut_sys{};
+                page_t mut_page{};
+                bsl::ut_when{} = [&]() noexcept {
+                    g_mut_errc.clear();
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_sys.bf_mem_op_free_huge(&mut_page));
+                    };
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }
@@ -99,6 +99,8 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.bf_tls_vsid()));
                 static_assert(noexcept(mut_sys.bf_tls_ppid()));
                 static_assert(noexcept(mut_sys.bf_tls_online_pps()));
+                static_assert(noexcept(mut_sys.bf_tls_exit_info({})));
+                static_assert(noexcept(mut_sys.bf_callback_op_register_fast_path({}, {}, {}, {})));
                 static_assert(noexcept(mut_sys.bf_vm_op_create_vm()));
                 static_assert(noexcept(mut_sys.bf_vm_op_destroy_vm({})));
                 static_assert(noexcept(mut_sys.bf_vm_op_map_direct<page_t>({}, {})));
@@ -112,6 +114,9 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.bf_vs_op_init_as_root({})));
                 static_assert(noexcept(mut_sys.bf_vs_op_read({}, {})));
                 static_assert(noexcept(mut_sys.bf_vs_op_write({}, {}, {})));
+                static_assert(noexcept(mut_sys.bf_vs_op_read_many({}, {}, {})));
+                static_assert(noexcept(mut_sys.bf_vs_op_write_many({}, {}, {})));
+                static_assert(noexcept(mut_sys.bf_vs_op_set_exit_info({}, {}, {})));
                 static_assert(noexcept(mut_sys.bf_vs_op_run({}, {}, {})));
                 static_assert(noexcept(mut_sys.bf_vs_op_run_current()));
                 static_assert(noexcept(mut_sys.bf_vs_op_advance_ip_and_run({}, {}, {})));
@@ -122,12 +127,14 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(mut_sys.bf_vs_op_set_active({}, {}, {})));
                 static_assert(noexcept(mut_sys.bf_vs_op_advance_ip_and_set_active({}, {}, {})));
                 static_assert(noexcept(mut_sys.bf_vs_op_tlb_flush({}, {})));
+                static_assert(noexcept(mut_sys.bf_vs_op_tlb_flush_range({}, {}, {})));
                 static_assert(noexcept(mut_sys.bf_intrinsic_op_rdmsr({})));
                 static_assert(noexcept(mut_sys.bf_intrinsic_op_wrmsr({}, {})));
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_page<page_t>(mut_phys)));
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_page<page_t>()));
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_huge<page_t>({}, mut_phys)));
                 static_assert(noexcept(mut_sys.bf_mem_op_alloc_huge<page_t>({})));
+                static_assert(noexcept(mut_sys.bf_mem_op_free_huge({})));
 
                 static_assert(noexcept(sys.bf_tls_rax()));
                 static_assert(noexcept(sys.bf_tls_set_rax({})));
@@ -165,7 +172,9 @@ main() noexcept -> bsl::exit_code
                 static_assert(noexcept(sys.bf_tls_vsid()));
                 static_assert(noexcept(sys.bf_tls_ppid()));
                 static_assert(noexcept(sys.bf_tls_online_pps()));
+                static_assert(noexcept(sys.bf_tls_exit_info({})));
                 static_assert(noexcept(sys.bf_vs_op_read({}, {})));
+                static_assert(noexcept(sys.bf_vs_op_read_many({}, {}, {})));
                 static_assert(noexcept(sys.bf_intrinsic_op_rdmsr({})));
             };
         };
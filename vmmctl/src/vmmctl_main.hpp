@@ -30,8 +30,11 @@
 #include <ifmap_t.hpp>
 #include <ioctl_t.hpp>
 #include <loader_platform_interface.hpp>
+#include <ofile_t.hpp>
 #include <start_vmm_args_t.hpp>
 #include <stop_vmm_args_t.hpp>
+#include <trace_record_t.hpp>
+#include <trace_vmm_args_t.hpp>
 
 #include <bsl/arguments.hpp>
 #include <bsl/array.hpp>
@@ -55,7 +58,8 @@ namespace vmmctl
     ///   @brief Provides the main implementation of the vmmctl application.
     ///     This application is used to start and stop the VMM as well as
     ///     to dump the contents of the VMM's internal debug ring to the
-    ///     console for debugging.
+    ///     console for debugging and to stream the VMM's VM exit trace
+    ///     rings to a file.
     ///
     class vmmctl_main final
     {
@@ -68,6 +72,7 @@ namespace vmmctl
             bsl::print() << "Usage: vmmctl start microkernel ext1 <ext2> ..." << bsl::endl;
             bsl::print() << "  or:  vmmctl stop" << bsl::endl;
             bsl::print() << "  or:  vmmctl dump" << bsl::endl;
+            bsl::print() << "  or:  vmmctl trace file <passes>" << bsl::endl;
             bsl::print() << bsl::endl;
             bsl::print() << "A utility for managing the Bareflank Hypervisor's VMM";
             bsl::print() << bsl::endl;
@@ -219,6 +224,127 @@ namespace vmmctl
             return bsl::errc_success;
         }
 
+        /// <!-- description -->
+        ///   @brief Streams the VM exit trace ring of each PP to a file
+        ///     while the VMM continues to run. Each pass drains every PP
+        ///     once. If the number of passes is 0 (or is not provided), the
+        ///     trace rings are drained until the VMM is stopped. The
+        ///     resulting file is a packed array of loader::trace_record_t.
+        ///
+        /// <!-- inputs/outputs -->
+        ///   @param mut_args the command line arguments provided by the user.
+        ///   @param mut_ioctl the ioctl_t to use
+        ///   @return Returns bsl::errc_success if the trace rings were
+        ///     successfully streamed, otherwise returns bsl::errc_failure.
+        ///
+        [[nodiscard]] static constexpr auto
+        trace_vmm(bsl::arguments &mut_args, ioctl_t &mut_ioctl) noexcept -> bsl::errc_type
+        {
+            auto const filename{mut_args.front<bsl::string_view>()};
+            if (filename.empty()) {
+                bsl::error() << "the trace file's path is either missing or empty\n";
+                help();
+                return bsl::errc_failure;
+            }
+
+            ++mut_args;
+            auto mut_passes{0_umx};
+            if (!mut_args.front<bsl::string_view>().empty()) {
+                mut_passes = mut_args.front<bsl::safe_umx>();
+                if (bsl::unlikely(mut_passes.is_invalid())) {
+                    bsl::error() << "the number of passes is invalid\n";
+                    help();
+                    return bsl::errc_failure;
+                }
+
+                bsl::touch();
+            }
+            else {
+                bsl::touch();
+            }
+
+            ofile_t mut_file{filename};
+            if (bsl::unlikely(!mut_file)) {
+                return bsl::errc_failure;
+            }
+
+            loader::trace_vmm_args_t mut_trace_args{};
+            bsl::array<loader::trace_record_t, HYPERVISOR_TRACE_RING_SIZE> mut_records{};
+            bsl::array<bsl::safe_u64, HYPERVISOR_MAX_PPS.get()> mut_dropped{};
+            auto mut_total{0_umx};
+
+            for (auto mut_pass{0_umx}; mut_passes.is_zero() || mut_pass < mut_passes; ++mut_pass) {
+                bool mut_running{};
+
+                for (bsl::safe_idx mut_i{}; mut_i < HYPERVISOR_MAX_PPS; ++mut_i) {
+                    mut_trace_args.ver = IOCTL_VERSION.get();
+                    mut_trace_args.ppid = mut_i.get();
+                    mut_trace_args.records = mut_records.data();
+                    mut_trace_args.max = mut_records.size().get();
+                    mut_trace_args.num = {};
+
+                    /// NOTE:
+                    /// - The loader fails this IOCTL for any PP that is not
+                    ///   running the VMM, which is how we detect that the
+                    ///   VMM has been stopped (or was never started).
+                    ///
+
+                    auto const ret{mut_ioctl.read_write(loader::TRACE_VMM, &mut_trace_args)};
+                    if (ret.is_neg()) {
+                        break;
+                    }
+
+                    mut_running = true;
+
+                    auto const num{bsl::to_umx(mut_trace_args.num)};
+                    if (bsl::unlikely(num > mut_records.size())) {
+                        bsl::error() << "kernel returned an invalid trace ring\n";
+                        return bsl::errc_failure;
+                    }
+
+                    if (num.is_pos()) {
+                        auto const size{bsl::to_umx(sizeof(loader::trace_record_t))};
+                        auto const bytes{(num * size).checked()};
+                        if (bsl::unlikely(!mut_file.write(mut_records.data(), bytes))) {
+                            return bsl::errc_failure;
+                        }
+
+                        mut_total += num;
+                    }
+                    else {
+                        bsl::touch();
+                    }
+
+                    *mut_dropped.at_if(mut_i) = mut_trace_args.dropped;
+                }
+
+                if (mut_running) {
+                    continue;
+                }
+
+                if (bsl::unlikely(mut_pass.is_zero())) {
+                    bsl::error() << "vmmctl failed. check kernel logs details\n";
+                    return bsl::errc_failure;
+                }
+
+                break;
+            }
+
+            bsl::print() << "traced " << mut_total << " records to " << filename << bsl::endl;
+            for (bsl::safe_idx mut_i{}; mut_i < HYPERVISOR_MAX_PPS; ++mut_i) {
+                auto const dropped{*mut_dropped.at_if(mut_i)};
+                if (dropped.is_zero()) {
+                    continue;
+                }
+
+                bsl::alert() << "pp " << bsl::hex(bsl::to_u16(mut_i))    // --
+                             << " dropped " << dropped << " records"     // --
+                             << bsl::endl;
+            }
+
+            return bsl::errc_success;
+        }
+
         /// <!-- description -->
         ///   @brief Process the user provided command line arguments assuming
         ///     the first argument is the command while also ignoring "help".
@@ -251,6 +377,10 @@ namespace vmmctl
                 return this->dump_vmm(mut_ioctl);
             }
 
+            if (cmd == "trace") {
+                return this->trace_vmm(mut_args, mut_ioctl);
+            }
+
             if (cmd.empty()) {
                 bsl::error() << "missing command\n";
             }
@@ -45,6 +45,8 @@ namespace loader
     constexpr auto STOP_VMM{0x2_umx};
     /// @brief defines IOCTL for dumping a VMs debug ring
     constexpr auto DUMP_VMM{0x3_umx};
+    /// @brief defines IOCTL for draining a PP's VM exit trace ring
+    constexpr auto TRACE_VMM{0x4_umx};
 }
 
 #endif
@@ -28,6 +28,7 @@
 #include <dump_vmm_args_t.hpp>
 #include <ioctl_t.hpp>
 #include <loader_platform_interface.hpp>
+#include <trace_vmm_args_t.hpp>
 
 #include <bsl/arguments.hpp>
 #include <bsl/array.hpp>
@@ -316,6 +317,130 @@ namespace mk
             };
         };
 
+        bsl::ut_scenario{"trace"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace", "success", "1"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::trace_vmm_args_t mut_trace_args{};
+                constexpr auto num{2_u64};
+                constexpr auto dropped{1_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_trace_args.num = num.get();
+                    mut_trace_args.dropped = dropped.get();
+                    bsl::ut_required_step(mut_ioctl.write(loader::TRACE_VMM, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace nothing to trace"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace", "success", "2"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::trace_vmm_args_t mut_trace_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ioctl.write(loader::TRACE_VMM, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace missing file"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace invalid passes"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace", "success", "invalid"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace file fails to open"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace", "failure", "1"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::trace_vmm_args_t mut_trace_args{};
+                bsl::ut_when{} = [&]() noexcept {
+                    bsl::ut_required_step(mut_ioctl.write(loader::TRACE_VMM, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace write fails"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace", "write_failure", "1"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::trace_vmm_args_t mut_trace_args{};
+                constexpr auto num{2_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_trace_args.num = num.get();
+                    bsl::ut_required_step(mut_ioctl.write(loader::TRACE_VMM, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace invalid num"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace", "success", "1"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                loader::trace_vmm_args_t mut_trace_args{};
+                constexpr auto invalid{0xFFFFFFFFFFFFFFFF_u64};
+                bsl::ut_when{} = [&]() noexcept {
+                    mut_trace_args.num = invalid.get();
+                    bsl::ut_required_step(mut_ioctl.write(loader::TRACE_VMM, &mut_trace_args));
+                    bsl::ut_then{} = [&]() noexcept {
+                        bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                    };
+                };
+            };
+        };
+
+        bsl::ut_scenario{"trace vmm not running"} = []() noexcept {
+            bsl::ut_given{} = []() noexcept {
+                vmmctl::vmmctl_main mut_vmmctl{};
+                vmmctl::ioctl_t mut_ioctl{"success"};
+                bsl::array const argv{"trace", "success"};
+                bsl::arguments mut_args{bsl::to_umx(argv.size()), argv.data()};
+                bsl::ut_then{} = [&]() noexcept {
+                    bsl::ut_check(!mut_vmmctl.process(mut_args, mut_ioctl));
+                };
+            };
+        };
+
         return bsl::ut_success();
     }
 }